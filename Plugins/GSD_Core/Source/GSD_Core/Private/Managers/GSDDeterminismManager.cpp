@@ -1,5 +1,23 @@
 #include "Managers/GSDDeterminismManager.h"
 #include "GSDLog.h"
+#include "Misc/CoreDelegates.h"
+#include "Algo/Sort.h"
+
+namespace
+{
+    // Source of unique recorder ids
+    std::atomic<uint32> GNextRecorderId{1};
+
+    // Murmur3 finalizer - spreads value hashes before commutative accumulation
+    uint32 MixStateHash(uint32 H)
+    {
+        H ^= H >> 16;
+        H *= 0x85EBCA6Bu;
+        H ^= H >> 13;
+        H *= 0xC2B2AE35u;
+        return H ^ (H >> 16);
+    }
+}
 
 const FName UGSDDeterminismManager::SpawnCategory = TEXT("Spawn");
 const FName UGSDDeterminismManager::EventCategory = TEXT("Event");
@@ -14,6 +32,7 @@ const FName UGSDDeterminismManager::ZombieWanderCategory = TEXT("ZombieWander");
 const FName UGSDDeterminismManager::ZombieTargetCategory = TEXT("ZombieTarget");
 const FName UGSDDeterminismManager::ZombieBehaviorCategory = TEXT("ZombieBehavior");
 const FName UGSDDeterminismManager::ZombieSpeedCategory = TEXT("ZombieSpeed");
+const FName UGSDDeterminismManager::NavigationCategory = TEXT("Navigation");
 
 void UGSDDeterminismManager::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -33,10 +52,29 @@ void UGSDDeterminismManager::Initialize(FSubsystemCollectionBase& Collection)
     CreateCategoryStream(ZombieTargetCategory);
     CreateCategoryStream(ZombieBehaviorCategory);
     CreateCategoryStream(ZombieSpeedCategory);
+    CreateCategoryStream(NavigationCategory);
+
+    // Advance the counter-stream frame once per engine frame
+    BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddUObject(this, &UGSDDeterminismManager::OnBeginFrame);
+
+    // Merge per-thread recording buffers once processors are done for the frame
+    EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UGSDDeterminismManager::OnEndFrame);
 }
 
 void UGSDDeterminismManager::Deinitialize()
 {
+    FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+    BeginFrameHandle.Reset();
+    FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+    EndFrameHandle.Reset();
+
+    {
+        FScopeLock Lock(&ThreadBufferRegistryLock);
+        ThreadRecordBuffers.Empty();
+        RecorderId = AllocateRecorderId();  // Stale thread-local caches must not match freed buffers
+    }
+    CategoryCrcCache.Empty();
+
     CategoryStreams.Empty();
     RecordedCalls.Empty();
     bIsRecording = false;
@@ -47,7 +85,8 @@ void UGSDDeterminismManager::Deinitialize()
 void UGSDDeterminismManager::InitializeWithSeed(int32 InSeed)
 {
     CurrentSeed = InSeed;
-    StateHash = 0;
+    StateHash.store(0, std::memory_order_relaxed);
+    CounterFrame = 0;
 
     GSD_LOG(Log, TEXT("UGSDDeterminismManager seeded with %d"), CurrentSeed);
 
@@ -71,34 +110,45 @@ FRandomStream& UGSDDeterminismManager::GetStream(FName Category)
 
 int32 UGSDDeterminismManager::ComputeStateHash() const
 {
-    return StateHash;
+    return static_cast<int32>(StateHash.load(std::memory_order_relaxed));
+}
+
+uint32 UGSDDeterminismManager::AllocateRecorderId()
+{
+    return GNextRecorderId.fetch_add(1, std::memory_order_relaxed);
+}
+
+void UGSDDeterminismManager::AccumulateStateHash(uint32 ValueHash)
+{
+    // Commutative: the sum does not depend on which thread or order values were drawn in
+    StateHash.fetch_add(MixStateHash(ValueHash), std::memory_order_relaxed);
 }
 
 float UGSDDeterminismManager::RandomFloat(FName Category)
 {
     float Value = GetStream(Category).GetFraction();
-    StateHash = HashCombine(StateHash, GetTypeHash(Value));
+    AccumulateStateHash(GetTypeHash(Value));
     return Value;
 }
 
 int32 UGSDDeterminismManager::RandomInteger(FName Category, int32 Max)
 {
     int32 Value = GetStream(Category).RandHelper(Max);
-    StateHash = HashCombine(StateHash, Value);
+    AccumulateStateHash(static_cast<uint32>(Value));
     return Value;
 }
 
 bool UGSDDeterminismManager::RandomBool(FName Category)
 {
     bool Value = GetStream(Category).GetFraction() > 0.5f;
-    StateHash = HashCombine(StateHash, GetTypeHash(Value));
+    AccumulateStateHash(GetTypeHash(Value));
     return Value;
 }
 
 FVector UGSDDeterminismManager::RandomUnitVector(FName Category)
 {
     FVector Value = GetStream(Category).VRand();
-    StateHash = HashCombine(StateHash, GetTypeHash(Value));
+    AccumulateStateHash(GetTypeHash(Value));
     return Value;
 }
 
@@ -111,7 +161,7 @@ void UGSDDeterminismManager::ShuffleArray(FName Category, TArray<T>& Array)
         int32 j = Stream.RandHelper(i + 1);
         Array.Swap(i, j);
     }
-    StateHash = HashCombine(StateHash, Array.Num());
+    AccumulateStateHash(static_cast<uint32>(Array.Num()));
 }
 
 void UGSDDeterminismManager::ResetStream(FName Category)
@@ -134,6 +184,17 @@ void UGSDDeterminismManager::ResetAllStreams()
     GSD_LOG(Log, TEXT("Reset all streams with seed %d"), CurrentSeed);
 }
 
+void UGSDDeterminismManager::OnBeginFrame()
+{
+    ++CounterFrame;
+}
+
+void UGSDDeterminismManager::OnEndFrame()
+{
+    // Always merge - records made before recording was disabled mid-frame still land
+    MergeThreadRecordings();
+}
+
 void UGSDDeterminismManager::CreateCategoryStream(FName Category)
 {
     int32 CategorySeed = CurrentSeed + GetTypeHash(Category);
@@ -141,42 +202,190 @@ void UGSDDeterminismManager::CreateCategoryStream(FName Category)
     CategoryStreams.Add(Category, NewStream);
 }
 
-void UGSDDeterminismManager::RecordRandomCall(FName Category, float Value)
+UGSDDeterminismManager::FThreadRecordBuffer& UGSDDeterminismManager::GetThreadRecordBuffer()
 {
-    if (bIsRecording)
+    // Small per-thread cache of (recorder id -> buffer). Ids are never reused, so
+    // entries for deinitialized managers are simply never matched again. Evicted
+    // entries are found again in the registry, which is keyed by thread id.
+    struct FCachedBuffer
     {
-        FGSDRandomCallRecord Record;
-        Record.Category = Category;
-        Record.CallIndex = CallCounter++;
-        Record.FloatValue = Value;
-        Record.bIsVector = false;
-        RecordedCalls.Add(Record);
+        uint32 OwnerId;
+        FThreadRecordBuffer* Buffer;
+    };
+    static thread_local TArray<FCachedBuffer, TInlineAllocator<4>> CachedBuffers;
+
+    for (const FCachedBuffer& Cached : CachedBuffers)
+    {
+        if (Cached.OwnerId == RecorderId)
+        {
+            return *Cached.Buffer;
+        }
+    }
+
+    // Cache miss - find this thread's buffer, registering it on the thread's first record
+    FThreadRecordBuffer* Buffer = nullptr;
+    {
+        FScopeLock Lock(&ThreadBufferRegistryLock);
+        TUniquePtr<FThreadRecordBuffer>& Registered = ThreadRecordBuffers.FindOrAdd(FPlatformTLS::GetCurrentThreadId());
+        if (!Registered)
+        {
+            Registered = MakeUnique<FThreadRecordBuffer>();
+        }
+        Buffer = Registered.Get();
+    }
 
-        GSD_LOG(Verbose, TEXT("Recorded random call [%d] %s: %f"),
-            Record.CallIndex, *Category.ToString(), Value);
+    if (CachedBuffers.Num() >= 4)
+    {
+        CachedBuffers.RemoveAt(0);
     }
+    CachedBuffers.Add({ RecorderId, Buffer });
+    return *Buffer;
+}
+
+void UGSDDeterminismManager::RecordRandomCallInternal(
+    FName Category,
+    float FloatValue,
+    const FVector& VectorValue,
+    bool bIsVector,
+    uint64 SortKey)
+{
+    FThreadRecordBuffer& Buffer = GetThreadRecordBuffer();
+
+    FGSDRandomCallRecord& Record = Buffer.Records.AddDefaulted_GetRef();
+    Record.Category = Category;
+    Record.CallIndex = Buffer.Records.Num() - 1;  // Per-thread order until merged
+    Record.FloatValue = FloatValue;
+    Record.VectorValue = VectorValue;
+    Record.bIsVector = bIsVector;
+    Record.SortKey = SortKey;
 }
 
-void UGSDDeterminismManager::RecordRandomCall(FName Category, FVector Value)
+void UGSDDeterminismManager::MergeThreadRecordings()
 {
-    if (bIsRecording)
+    TArray<FGSDRandomCallRecord> Pending;
+    {
+        FScopeLock Lock(&ThreadBufferRegistryLock);
+
+        int32 NumPending = 0;
+        for (const TPair<uint32, TUniquePtr<FThreadRecordBuffer>>& Pair : ThreadRecordBuffers)
+        {
+            NumPending += Pair.Value->Records.Num();
+        }
+        if (NumPending == 0)
+        {
+            return;
+        }
+
+        Pending.Reserve(NumPending);
+        for (const TPair<uint32, TUniquePtr<FThreadRecordBuffer>>& Pair : ThreadRecordBuffers)
+        {
+            Pending.Append(Pair.Value->Records);
+            Pair.Value->Records.Reset();  // Keep capacity for next frame
+        }
+    }
+
+    // Deterministic order: category name, then caller sort key, then per-thread order.
+    // Keyed records sharing a category and sort key come from one entity on one thread.
+    // Unkeyed records may come from several threads, so their per-thread order is not
+    // comparable - order them by value (identical records are interchangeable).
+    Algo::Sort(Pending, [](const FGSDRandomCallRecord& A, const FGSDRandomCallRecord& B)
+    {
+        if (A.Category != B.Category)
+        {
+            return A.Category.LexicalLess(B.Category);
+        }
+        if (A.SortKey != B.SortKey)
+        {
+            return A.SortKey < B.SortKey;
+        }
+        if (A.SortKey != 0)
+        {
+            return A.CallIndex < B.CallIndex;
+        }
+        if (A.bIsVector != B.bIsVector)
+        {
+            return B.bIsVector;
+        }
+
+        // Compare bit patterns so the order is total (NaN, -0)
+        const float ValuesA[] = { A.FloatValue, float(A.VectorValue.X), float(A.VectorValue.Y), float(A.VectorValue.Z) };
+        const float ValuesB[] = { B.FloatValue, float(B.VectorValue.X), float(B.VectorValue.Y), float(B.VectorValue.Z) };
+        uint32 BitsA[UE_ARRAY_COUNT(ValuesA)];
+        uint32 BitsB[UE_ARRAY_COUNT(ValuesB)];
+        FMemory::Memcpy(BitsA, ValuesA, sizeof(BitsA));
+        FMemory::Memcpy(BitsB, ValuesB, sizeof(BitsB));
+        for (int32 i = 0; i < UE_ARRAY_COUNT(BitsA); ++i)
+        {
+            if (BitsA[i] != BitsB[i])
+            {
+                return BitsA[i] < BitsB[i];
+            }
+        }
+        return false;
+    });
+
+    if (FrameRecordingHashFrame != CounterFrame)
+    {
+        FrameRecordingHash = 0;
+        FrameRecordingHashFrame = CounterFrame;
+    }
+
+    RecordedCalls.Reserve(RecordedCalls.Num() + Pending.Num());
+    for (FGSDRandomCallRecord& Record : Pending)
     {
-        FGSDRandomCallRecord Record;
-        Record.Category = Category;
         Record.CallIndex = CallCounter++;
-        Record.VectorValue = Value;
-        Record.bIsVector = true;
-        RecordedCalls.Add(Record);
 
-        GSD_LOG(Verbose, TEXT("Recorded random call [%d] %s: %s"),
-            Record.CallIndex, *Category.ToString(), *Value.ToString());
+        // Commutative frame hash over (category, sort key, value, frame)
+        uint32* CategoryCrc = CategoryCrcCache.Find(Record.Category);
+        if (!CategoryCrc)
+        {
+            CategoryCrc = &CategoryCrcCache.Add(Record.Category, FCrc::StrCrc32(*Record.Category.ToString()));
+        }
+
+        uint64 ValueHash = 0;
+        if (Record.bIsVector)
+        {
+            const FVector3f Value(Record.VectorValue);
+            ValueHash = FCrc::MemCrc32(&Value, sizeof(Value));
+        }
+        else
+        {
+            FMemory::Memcpy(&ValueHash, &Record.FloatValue, sizeof(float));
+        }
+
+        const uint64 RecordHash = FGSDCounterRandom::SplitMix64(
+            (static_cast<uint64>(*CategoryCrc) << 32 | CounterFrame)
+            ^ FGSDCounterRandom::SplitMix64(Record.SortKey ^ (ValueHash << 1)));
+        FrameRecordingHash += RecordHash;
+        RecordingHash += RecordHash;
+
+        RecordedCalls.Add(Record);
     }
+
+    GSD_LOG(Verbose, TEXT("Merged %d random calls (frame %u, hash %016llx)"),
+        Pending.Num(), CounterFrame, FrameRecordingHash);
+}
+
+int32 UGSDDeterminismManager::GetNumThreadRecordBuffers() const
+{
+    FScopeLock Lock(&ThreadBufferRegistryLock);
+    return ThreadRecordBuffers.Num();
 }
 
 void UGSDDeterminismManager::ClearRecordedCalls()
 {
+    {
+        FScopeLock Lock(&ThreadBufferRegistryLock);
+        for (const TPair<uint32, TUniquePtr<FThreadRecordBuffer>>& Pair : ThreadRecordBuffers)
+        {
+            Pair.Value->Records.Reset();
+        }
+    }
+
     RecordedCalls.Empty();
     CallCounter = 0;
+    FrameRecordingHash = 0;
+    RecordingHash = 0;
     GSD_LOG(Log, TEXT("Cleared all recorded random calls"));
 }
 
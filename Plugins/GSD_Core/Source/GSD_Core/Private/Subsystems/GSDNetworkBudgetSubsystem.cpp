@@ -3,6 +3,7 @@
 #include "Subsystems/GSDNetworkBudgetSubsystem.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "Misc/CoreDelegates.h"
 
 DEFINE_LOG_CATEGORY(LogGSDNetworkBudget);
 
@@ -17,11 +18,19 @@ void UGSDNetworkBudgetSubsystem::Initialize(FSubsystemCollectionBase& Collection
         Config->AddToRoot();  // Prevent GC
     }
 
+    RefreshBudgetCache();
+
+    // Budgets are per frame; reset before any processor spends this frame's budget
+    BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddUObject(this, &UGSDNetworkBudgetSubsystem::OnBeginFrame);
+
     UE_LOG(LogGSDNetworkBudget, Log, TEXT("GSDNetworkBudgetSubsystem initialized"));
 }
 
 void UGSDNetworkBudgetSubsystem::Deinitialize()
 {
+    FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+    BeginFrameHandle.Reset();
+
     Super::Deinitialize();
 
     if (Config)
@@ -30,9 +39,9 @@ void UGSDNetworkBudgetSubsystem::Deinitialize()
         Config = nullptr;
     }
 
-    FrameUsage.Empty();
+    ResetFrameCounters();
     UsageHistory.Empty();
-    LODReplicationCounts.Empty();
+    Schedules.Empty();
 
     UE_LOG(LogGSDNetworkBudget, Log, TEXT("GSDNetworkBudgetSubsystem deinitialized"));
 }
@@ -41,23 +50,25 @@ void UGSDNetworkBudgetSubsystem::TrackReplication(EGSDBudgetCategory Category, i
 {
     if (!Config) return;
 
-    FrameUsage.FindOrAdd(Category) += Bits;
+    const int32 CategoryIndex = GetCategoryIndex(Category);
+    const int32 Used = FrameUsage[CategoryIndex].fetch_add(Bits, std::memory_order_relaxed) + Bits;
 
     // Check budget
-    int32 Budget = Config->GetCategoryBudget(Category);
-    int32 Used = FrameUsage[Category];
+    const int32 Budget = CachedCategoryBudgets[CategoryIndex].load(std::memory_order_relaxed);
 
     if (Config->bLogBandwidthWarnings && Used > Budget * Config->WarningThreshold)
     {
-        float Now = FPlatformTime::Seconds();
-        if (Now - LastWarningTime > 5.0f)  // Throttle warnings
+        const double Now = FPlatformTime::Seconds();
+        double LastWarning = LastWarningTime.load(std::memory_order_relaxed);
+
+        // Throttle warnings; only the thread that wins the exchange logs
+        if (Now - LastWarning > 5.0 && LastWarningTime.compare_exchange_strong(LastWarning, Now))
         {
             UE_LOG(LogGSDNetworkBudget, Warning,
                 TEXT("Category %s at %.1f%% bandwidth budget (%d/%d bits)"),
                 *UEnum::GetValueAsString(Category),
                 Budget > 0 ? (static_cast<float>(Used) / Budget * 100.0f) : 0.0f,
                 Used, Budget);
-            LastWarningTime = Now;
         }
     }
 }
@@ -67,42 +78,37 @@ bool UGSDNetworkBudgetSubsystem::CanReplicateThisFrame(EGSDBudgetCategory Catego
     if (!Config) return true;
 
     // Check budget
-    int32 Remaining = GetRemainingBudget(Category);
+    const int32 CategoryIndex = GetCategoryIndex(Category);
+    const int32 Remaining = CachedCategoryBudgets[CategoryIndex].load(std::memory_order_relaxed)
+        - FrameUsage[CategoryIndex].load(std::memory_order_relaxed);
     if (Remaining <= 0)
     {
         return false;
     }
 
-    // Check LOD limits
-    const FGSDLODReplicationConfig& LODConfig = Config->GetLODConfig(LODLevel);
-    int32 CurrentCount = LODReplicationCounts.IsValidIndex(LODLevel) ? LODReplicationCounts[LODLevel] : 0;
-
-    if (CurrentCount >= LODConfig.MaxEntitiesPerFrame)
+    // Check LOD limits: reserve a slot, roll back if over the limit
+    const int32 LODIndex = GetLODIndex(LODLevel);
+    const int32 MaxEntities = CachedLODMaxEntities[LODIndex].load(std::memory_order_relaxed);
+    if (LODReplicationCounts[LODIndex].fetch_add(1, std::memory_order_relaxed) >= MaxEntities)
     {
+        LODReplicationCounts[LODIndex].fetch_sub(1, std::memory_order_relaxed);
         return false;
     }
 
-    // Increment count
-    if (LODReplicationCounts.Num() <= LODLevel)
-    {
-        LODReplicationCounts.SetNum(LODLevel + 1);
-    }
-    LODReplicationCounts[LODLevel]++;
-
     return true;
 }
 
 float UGSDNetworkBudgetSubsystem::GetCurrentBandwidthUsage(EGSDBudgetCategory Category) const
 {
-    return static_cast<float>(FrameUsage.FindRef(Category));
+    return static_cast<float>(FrameUsage[GetCategoryIndex(Category)].load(std::memory_order_relaxed));
 }
 
 float UGSDNetworkBudgetSubsystem::GetTotalBandwidthUsage() const
 {
     int32 Total = 0;
-    for (const auto& Pair : FrameUsage)
+    for (const std::atomic<int32>& Usage : FrameUsage)
     {
-        Total += Pair.Value;
+        Total += Usage.load(std::memory_order_relaxed);
     }
     return static_cast<float>(Total);
 }
@@ -111,8 +117,9 @@ int32 UGSDNetworkBudgetSubsystem::GetRemainingBudget(EGSDBudgetCategory Category
 {
     if (!Config) return MAX_int32;
 
-    int32 Budget = Config->GetCategoryBudget(Category);
-    int32 Used = FrameUsage.FindRef(Category);
+    const int32 CategoryIndex = GetCategoryIndex(Category);
+    const int32 Budget = CachedCategoryBudgets[CategoryIndex].load(std::memory_order_relaxed);
+    const int32 Used = FrameUsage[CategoryIndex].load(std::memory_order_relaxed);
     return FMath::Max(0, Budget - Used);
 }
 
@@ -129,12 +136,180 @@ void UGSDNetworkBudgetSubsystem::SetConfig(UGSDNetworkBudgetConfig* InConfig)
     {
         Config->AddToRoot();
     }
+
+    RefreshBudgetCache();
+}
+
+void UGSDNetworkBudgetSubsystem::RefreshBudgetCache()
+{
+    for (int32 CategoryIndex = 0; CategoryIndex < NumCategories; ++CategoryIndex)
+    {
+        const int32 Budget = Config ? Config->GetCategoryBudget(static_cast<EGSDBudgetCategory>(CategoryIndex)) : MAX_int32;
+        CachedCategoryBudgets[CategoryIndex].store(Budget, std::memory_order_relaxed);
+    }
+
+    for (int32 LODIndex = 0; LODIndex < MaxLODLevels; ++LODIndex)
+    {
+        const int32 MaxEntities = Config ? Config->GetLODConfig(LODIndex).MaxEntitiesPerFrame : MAX_int32;
+        CachedLODMaxEntities[LODIndex].store(MaxEntities, std::memory_order_relaxed);
+    }
 }
 
 void UGSDNetworkBudgetSubsystem::ResetFrameCounters()
 {
-    FrameUsage.Empty();
-    LODReplicationCounts.Empty();
+    for (std::atomic<int32>& Usage : FrameUsage)
+    {
+        Usage.store(0, std::memory_order_relaxed);
+    }
+    for (std::atomic<int32>& Count : LODReplicationCounts)
+    {
+        Count.store(0, std::memory_order_relaxed);
+    }
+
+    // Pick up config edits made at runtime
+    RefreshBudgetCache();
+}
+
+void UGSDNetworkBudgetSubsystem::OnBeginFrame()
+{
+    ResetFrameCounters();
+}
+
+void UGSDNetworkBudgetSubsystem::SubmitReplicationCandidates(EGSDBudgetCategory Category, TConstArrayView<FGSDReplicationCandidate> Candidates)
+{
+    if (Candidates.Num() == 0) return;
+
+    FScopeLock Lock(&BudgetLock);
+    Schedules.FindOrAdd(Category).Pending.Append(Candidates.GetData(), Candidates.Num());
+}
+
+float UGSDNetworkBudgetSubsystem::ComputeReplicationPriority(const FGSDReplicationCandidate& Candidate, int32 StarvationFrames) const
+{
+    const float SignificanceWeight = Config ? Config->SignificanceWeight : 1.0f;
+    const float DistanceWeight = Config ? Config->DistanceWeight : 0.5f;
+    const float DistanceFalloff = Config ? Config->DistanceFalloff : 5000.0f;
+    const float StalenessWeight = Config ? Config->StalenessWeight : 0.25f;
+
+    // Significance 0..3 -> 1..0
+    const float SignificanceTerm = 1.0f - FMath::Clamp(Candidate.Significance / 3.0f, 0.0f, 1.0f);
+
+    // 1 at the viewer, 0.5 at DistanceFalloff, tending to 0
+    const float FalloffSq = FMath::Max(FMath::Square(DistanceFalloff), 1.0f);
+    const float DistanceTerm = FalloffSq / (FalloffSq + Candidate.DistanceSquared);
+
+    return SignificanceWeight * SignificanceTerm
+        + DistanceWeight * DistanceTerm
+        + StalenessWeight * static_cast<float>(StarvationFrames);
+}
+
+int32 UGSDNetworkBudgetSubsystem::ScheduleReplication(EGSDBudgetCategory Category, TArray<FGSDReplicationCandidate>& OutApproved)
+{
+    OutApproved.Reset();
+
+    FScopeLock Lock(&BudgetLock);
+
+    FCategorySchedule& Schedule = Schedules.FindOrAdd(Category);
+    Schedule.ScheduleCounter++;
+
+    TArray<FGSDReplicationCandidate>& Candidates = Schedule.Pending;
+    FGSDReplicationScheduleStats Stats;
+    Stats.NumCandidates = Candidates.Num();
+
+    // Rank: priority desc, key asc for a deterministic order regardless of submission order
+    for (FGSDReplicationCandidate& Candidate : Candidates)
+    {
+        FStarvationEntry& Entry = Schedule.Starvation.FindOrAdd(Candidate.EntityKey);
+        Entry.LastSeenSchedule = Schedule.ScheduleCounter;
+        Candidate.Priority = ComputeReplicationPriority(Candidate, Entry.FramesStarved);
+    }
+
+    Candidates.Sort([](const FGSDReplicationCandidate& A, const FGSDReplicationCandidate& B)
+    {
+        if (A.Priority != B.Priority)
+        {
+            return A.Priority > B.Priority;
+        }
+        return A.EntityKey < B.EntityKey;
+    });
+
+    // Spend the budget in priority order; smaller candidates may still fit after a miss
+    const int32 CategoryIndex = GetCategoryIndex(Category);
+    int32 Remaining = CachedCategoryBudgets[CategoryIndex].load(std::memory_order_relaxed)
+        - FrameUsage[CategoryIndex].load(std::memory_order_relaxed);
+    for (const FGSDReplicationCandidate& Candidate : Candidates)
+    {
+        FStarvationEntry& Entry = Schedule.Starvation.FindChecked(Candidate.EntityKey);
+
+        const int32 LODIndex = GetLODIndex(Candidate.LODLevel);
+        const bool bApproved = Candidate.EstimatedBits <= Remaining
+            && LODReplicationCounts[LODIndex].load(std::memory_order_relaxed)
+                < CachedLODMaxEntities[LODIndex].load(std::memory_order_relaxed);
+
+        if (bApproved)
+        {
+            LODReplicationCounts[LODIndex].fetch_add(1, std::memory_order_relaxed);
+            FrameUsage[CategoryIndex].fetch_add(Candidate.EstimatedBits, std::memory_order_relaxed);
+            Remaining -= Candidate.EstimatedBits;
+
+            Entry.FramesStarved = 0;
+            OutApproved.Add(Candidate);
+        }
+        else
+        {
+            Entry.FramesStarved++;
+            Stats.MaxStarvationFrames = FMath::Max(Stats.MaxStarvationFrames, Entry.FramesStarved);
+        }
+    }
+
+    // Forget entities that were not submitted this frame (despawned or no longer replicated)
+    for (auto It = Schedule.Starvation.CreateIterator(); It; ++It)
+    {
+        if (It->Value.LastSeenSchedule != Schedule.ScheduleCounter)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    Candidates.Reset();
+
+    Stats.NumApproved = OutApproved.Num();
+    Schedule.LastStats = Stats;
+
+    if (Config && Config->bLogBandwidthWarnings && Stats.MaxStarvationFrames >= Config->StarvationWarningFrames)
+    {
+        const float Now = FPlatformTime::Seconds();
+        if (Now - Schedule.LastStarvationWarningTime > 5.0f)  // Throttle warnings
+        {
+            UE_LOG(LogGSDNetworkBudget, Warning,
+                TEXT("Category %s: candidate starved for %d frames (%d/%d approved)"),
+                *UEnum::GetValueAsString(Category), Stats.MaxStarvationFrames, Stats.NumApproved, Stats.NumCandidates);
+            Schedule.LastStarvationWarningTime = Now;
+        }
+    }
+
+    return Stats.NumApproved;
+}
+
+int32 UGSDNetworkBudgetSubsystem::GetStarvationFrames(EGSDBudgetCategory Category, uint64 EntityKey) const
+{
+    FScopeLock Lock(&BudgetLock);
+
+    if (const FCategorySchedule* Schedule = Schedules.Find(Category))
+    {
+        if (const FStarvationEntry* Entry = Schedule->Starvation.Find(EntityKey))
+        {
+            return Entry->FramesStarved;
+        }
+    }
+    return 0;
+}
+
+FGSDReplicationScheduleStats UGSDNetworkBudgetSubsystem::GetLastScheduleStats(EGSDBudgetCategory Category) const
+{
+    FScopeLock Lock(&BudgetLock);
+
+    const FCategorySchedule* Schedule = Schedules.Find(Category);
+    return Schedule ? Schedule->LastStats : FGSDReplicationScheduleStats();
 }
 
 void UGSDNetworkBudgetSubsystem::LogStatus() const
@@ -151,7 +326,7 @@ void UGSDNetworkBudgetSubsystem::LogStatus() const
     for (const auto& Pair : Config->CategoryAllocations)
     {
         int32 Budget = Config->GetCategoryBudget(Pair.Key);
-        int32 Used = FrameUsage.FindRef(Pair.Key);
+        int32 Used = static_cast<int32>(GetCurrentBandwidthUsage(Pair.Key));
         float PercentUsed = Budget > 0 ? (static_cast<float>(Used) / Budget * 100.0f) : 0.0f;
 
         UE_LOG(LogGSDNetworkBudget, Log, TEXT("  %s: %d/%d bits (%.1f%%)"),
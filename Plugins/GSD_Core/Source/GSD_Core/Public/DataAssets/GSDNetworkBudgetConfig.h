@@ -68,6 +68,26 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Monitoring")
     bool bLogBandwidthWarnings = true;
 
+    // Warn when a candidate has been denied this many consecutive schedules
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Monitoring")
+    int32 StarvationWarningFrames = 60;
+
+    // Priority weight for LOD significance (closer LOD = higher priority)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Scheduling")
+    float SignificanceWeight = 1.0f;
+
+    // Priority weight for viewer distance (falls off with DistanceFalloff)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Scheduling")
+    float DistanceWeight = 0.5f;
+
+    // Distance at which the distance priority term halves
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Scheduling")
+    float DistanceFalloff = 5000.0f;
+
+    // Priority added per consecutive denied schedule, so starved candidates always win eventually
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Scheduling")
+    float StalenessWeight = 0.25f;
+
     // Get allocated bandwidth for a category
     int32 GetCategoryBudget(EGSDBudgetCategory Category) const;
 
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include <atomic>
 #include "GSDDeterminismManager.generated.h"
 
 /**
@@ -26,6 +27,97 @@ struct GSD_CORE_API FGSDRandomCallRecord
 
     UPROPERTY()
     bool bIsVector = false;
+
+    /** Merge ordering key supplied by the caller (e.g. packed entity handle) */
+    UPROPERTY()
+    uint64 SortKey = 0;
+};
+
+/**
+ * Stateless counter-based random generator (Squares RNG).
+ *
+ * Each value is a pure function of (stream key, entity key, frame, draw index),
+ * so results do not depend on the order entities or chunks are visited.
+ * Safe to use from worker threads - no shared state is touched.
+ *
+ * Usage:
+ *   const uint64 StreamKey = Manager->GetCounterStreamKey(UGSDDeterminismManager::NavigationCategory);
+ *   FGSDCounterRandom Rng(StreamKey, EntityKey, Manager->GetCounterFrame());
+ *   const float Value = Rng.FRandRange(-1.0f, 1.0f);
+ */
+struct FGSDCounterRandom
+{
+    FGSDCounterRandom(uint64 StreamKey, uint64 InEntityKey, uint32 Frame)
+        : Key(SplitMix64(StreamKey ^ SplitMix64(InEntityKey)) | 1ull)  // Squares keys must be odd
+        , Counter(static_cast<uint64>(Frame) << 32)
+        , EntityKey(InEntityKey)
+    {
+    }
+
+    /** Entity key this generator was created for (used as the recording sort key) */
+    uint64 GetEntityKey() const { return EntityKey; }
+
+    /** Derive a stream key from a seed and category name (stable across runs and processes) */
+    static uint64 MakeStreamKey(int32 Seed, FName Category)
+    {
+        const uint32 CategoryHash = FCrc::StrCrc32(*Category.ToString());
+        return SplitMix64((static_cast<uint64>(static_cast<uint32>(Seed)) << 32) | CategoryHash);
+    }
+
+    /** Pack an entity index/serial pair (e.g. FMassEntityHandle) into a stable entity key */
+    static uint64 MakeEntityKey(int32 Index, int32 SerialNumber)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(SerialNumber)) << 32) | static_cast<uint32>(Index);
+    }
+
+    /** Next raw 32-bit value */
+    uint32 NextUInt32()
+    {
+        return Squares32(Counter++, Key);
+    }
+
+    /** Random float in [0, 1) */
+    float FRand()
+    {
+        return static_cast<float>(NextUInt32() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /** Random float in [Min, Max) */
+    float FRandRange(float Min, float Max)
+    {
+        return Min + (Max - Min) * FRand();
+    }
+
+    /** Random integer in [0, Max) - returns 0 if Max <= 0 */
+    int32 RandHelper(int32 Max)
+    {
+        return Max > 0 ? static_cast<int32>((static_cast<uint64>(NextUInt32()) * static_cast<uint64>(Max)) >> 32) : 0;
+    }
+
+    /** 64-bit finalizer used for key derivation and record hashing */
+    static uint64 SplitMix64(uint64 X)
+    {
+        X += 0x9E3779B97F4A7C15ull;
+        X = (X ^ (X >> 30)) * 0xBF58476D1CE4E5B9ull;
+        X = (X ^ (X >> 27)) * 0x94D049BB133111EBull;
+        return X ^ (X >> 31);
+    }
+
+private:
+    uint64 Key;
+    uint64 Counter;
+    uint64 EntityKey;
+
+    static uint32 Squares32(uint64 Ctr, uint64 InKey)
+    {
+        uint64 X = Ctr * InKey;
+        const uint64 Y = X;
+        const uint64 Z = Y + InKey;
+        X = X * X + Y; X = (X >> 32) | (X << 32);
+        X = X * X + Z; X = (X >> 32) | (X << 32);
+        X = X * X + Y; X = (X >> 32) | (X << 32);
+        return static_cast<uint32>((X * X + Z) >> 32);
+    }
 };
 
 /**
@@ -63,7 +155,7 @@ public:
     UFUNCTION(BlueprintPure, Category = "GSD|Determinism")
     int32 GetCurrentSeed() const { return CurrentSeed; }
 
-    // Compute state hash for verification
+    // Compute state hash for verification (commutative - independent of call order)
     UFUNCTION(BlueprintCallable, Category = "GSD|Determinism")
     int32 ComputeStateHash() const;
 
@@ -87,6 +179,30 @@ public:
     template<typename T>
     void ShuffleArray(FName Category, TArray<T>& Array);
 
+    //-- Counter-Based Streams (order-independent, thread-safe) --
+
+    /**
+     * Get the counter-RNG stream key for a category under the current seed.
+     * Resolve once per processor Execute and reuse for every entity.
+     */
+    uint64 GetCounterStreamKey(FName Category) const { return FGSDCounterRandom::MakeStreamKey(CurrentSeed, Category); }
+
+    /**
+     * Get the frame index used for counter-based streams.
+     * Reset to 0 by InitializeWithSeed, advanced once per engine frame.
+     */
+    uint32 GetCounterFrame() const { return CounterFrame; }
+
+    /**
+     * Build a per-entity counter-based generator for this frame.
+     * @param Category Random category (isolates streams like GetCategoryStream)
+     * @param EntityKey Stable per-entity key (e.g. packed Mass entity handle)
+     */
+    FGSDCounterRandom MakeEntityRandom(FName Category, uint64 EntityKey) const
+    {
+        return FGSDCounterRandom(GetCounterStreamKey(Category), EntityKey, CounterFrame);
+    }
+
     // Reset a specific category stream
     UFUNCTION(BlueprintCallable, Category = "GSD|Determinism")
     void ResetStream(FName Category);
@@ -99,21 +215,65 @@ public:
 
     /**
      * Record a random float call for replay validation.
-     * Only records when bIsRecording is true.
+     * Only records when bIsRecording is true (the flag check is the only cost otherwise).
+     * Lock-free: appends to a per-thread buffer that is merged at end of frame.
+     *
+     * @param SortKey Merge ordering key - pass the entity key when calling from
+     *                parallel chunks so the merged order is deterministic.
+     *                Unkeyed (0) records are ordered by value.
      */
-    void RecordRandomCall(FName Category, float Value);
+    void RecordRandomCall(FName Category, float Value, uint64 SortKey = 0)
+    {
+        if (bIsRecording)
+        {
+            RecordRandomCallInternal(Category, Value, FVector::ZeroVector, false, SortKey);
+        }
+    }
 
     /**
      * Record a random vector call for replay validation.
-     * Only records when bIsRecording is true.
+     * Only records when bIsRecording is true (the flag check is the only cost otherwise).
+     * Lock-free: appends to a per-thread buffer that is merged at end of frame.
+     *
+     * @param SortKey Merge ordering key - pass the entity key when calling from
+     *                parallel chunks so the merged order is deterministic.
+     *                Unkeyed (0) records are ordered by value.
      */
-    void RecordRandomCall(FName Category, FVector Value);
+    void RecordRandomCall(FName Category, FVector Value, uint64 SortKey = 0)
+    {
+        if (bIsRecording)
+        {
+            RecordRandomCallInternal(Category, 0.0f, Value, true, SortKey);
+        }
+    }
+
+    /**
+     * Merge per-thread recording buffers into the recorded call list.
+     * Records are ordered by (category name, sort key, per-thread call order); unkeyed
+     * records, which may come from any thread, are ordered by value instead of call
+     * order. The result does not depend on thread scheduling. Runs automatically at end of frame.
+     * Game thread only - do not call while processors are running.
+     */
+    void MergeThreadRecordings();
 
     /**
      * Get all recorded random calls for debugging.
+     * Contains calls merged so far - call MergeThreadRecordings() first for the current frame.
      */
     const TArray<FGSDRandomCallRecord>& GetRecordedCalls() const { return RecordedCalls; }
 
+    /**
+     * Commutative hash of the records merged during the current frame.
+     * Independent of record order and of how many merges happened within the frame.
+     */
+    uint64 GetFrameRecordingHash() const { return FrameRecordingHash; }
+
+    /**
+     * Commutative hash of all merged records since the last ClearRecordedCalls.
+     * Each record is hashed with its frame, so two runs match only if every frame matched.
+     */
+    uint64 GetRecordingHash() const { return RecordingHash; }
+
     /**
      * Clear all recorded calls.
      */
@@ -132,6 +292,9 @@ public:
     UFUNCTION(BlueprintPure, Category = "GSD|Determinism")
     bool IsRecordingEnabled() const { return bIsRecording; }
 
+    /** Number of per-thread recording buffers (one per thread that has recorded) */
+    int32 GetNumThreadRecordBuffers() const;
+
     // Predefined categories
     static const FName SpawnCategory;
     static const FName EventCategory;
@@ -146,14 +309,14 @@ public:
     static const FName ZombieTargetCategory;
     static const FName ZombieBehaviorCategory;
     static const FName ZombieSpeedCategory;
+    static const FName NavigationCategory;
 
 private:
     int32 CurrentSeed = 0;
     TMap<FName, FRandomStream> CategoryStreams;
 
-    // Hash accumulator for state verification
-    UPROPERTY()
-    int32 StateHash = 0;
+    // Hash accumulator for state verification (commutative sum, lock-free)
+    std::atomic<uint32> StateHash{0};
 
     //-- Recording State --
     UPROPERTY()
@@ -164,5 +327,42 @@ private:
 
     int32 CallCounter = 0;
 
+    //-- Per-Thread Recording Buffers --
+
+    /** Append-only record buffer owned by a single thread until the next merge */
+    struct FThreadRecordBuffer
+    {
+        TArray<FGSDRandomCallRecord> Records;
+    };
+
+    // Keyed by thread id, so a thread always reuses its buffer (bounded by thread count)
+    TMap<uint32, TUniquePtr<FThreadRecordBuffer>> ThreadRecordBuffers;
+
+    // Taken only on a thread-local cache miss and during merge
+    mutable FCriticalSection ThreadBufferRegistryLock;
+
+    // Unique per instance (renewed on Deinitialize) - keys the thread-local buffer caches
+    uint32 RecorderId = AllocateRecorderId();
+
+    // Category name CRCs (stable across processes) for record hashing
+    TMap<FName, uint32> CategoryCrcCache;
+
+    uint64 FrameRecordingHash = 0;
+    uint64 RecordingHash = 0;
+    uint32 FrameRecordingHashFrame = 0;
+
+    FDelegateHandle EndFrameHandle;
+
+    //-- Counter-Based Stream State --
+    uint32 CounterFrame = 0;
+    FDelegateHandle BeginFrameHandle;
+
     void CreateCategoryStream(FName Category);
+    void OnBeginFrame();
+    void OnEndFrame();
+
+    static uint32 AllocateRecorderId();
+    void AccumulateStateHash(uint32 ValueHash);
+    FThreadRecordBuffer& GetThreadRecordBuffer();
+    void RecordRandomCallInternal(FName Category, float FloatValue, const FVector& VectorValue, bool bIsVector, uint64 SortKey);
 };
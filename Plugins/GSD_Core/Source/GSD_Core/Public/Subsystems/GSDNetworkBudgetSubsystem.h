@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/EngineSubsystem.h"
 #include "DataAssets/GSDNetworkBudgetConfig.h"
+#include <atomic>
 #include "GSDNetworkBudgetSubsystem.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogGSDNetworkBudget, Log, All);
@@ -24,9 +25,74 @@ struct FGSDReplicationRecord
     float Timestamp = 0.0f;
 };
 
+/**
+ * A replication request submitted to the per-frame scheduler.
+ */
+USTRUCT()
+struct GSD_CORE_API FGSDReplicationCandidate
+{
+    GENERATED_BODY()
+
+    // Stable key of the replicated object (e.g. packed Mass entity index/serial)
+    UPROPERTY()
+    uint64 EntityKey = 0;
+
+    UPROPERTY()
+    int32 LODLevel = 0;
+
+    // LOD significance (0.0 = closest, 3.0 = farthest)
+    UPROPERTY()
+    float Significance = 0.0f;
+
+    // Squared distance to the nearest viewer
+    UPROPERTY()
+    float DistanceSquared = 0.0f;
+
+    UPROPERTY()
+    int32 EstimatedBits = 0;
+
+    // Filled in by ScheduleReplication
+    UPROPERTY()
+    float Priority = 0.0f;
+};
+
+/**
+ * Result of the last ScheduleReplication call.
+ */
+USTRUCT(BlueprintType)
+struct GSD_CORE_API FGSDReplicationScheduleStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly)
+    int32 NumCandidates = 0;
+
+    UPROPERTY(BlueprintReadOnly)
+    int32 NumApproved = 0;
+
+    // Longest run of consecutive denied schedules among current candidates
+    UPROPERTY(BlueprintReadOnly)
+    int32 MaxStarvationFrames = 0;
+};
+
 /**
  * Network bandwidth budget tracking subsystem.
  * Monitors replication and enforces budget limits.
+ *
+ * Two ways to spend the budget:
+ * - CanReplicateThisFrame: immediate first-come-first-served check
+ * - SubmitReplicationCandidates + ScheduleReplication: candidates are collected
+ *   for the frame, ranked by significance, distance and staleness, and the budget
+ *   is spent in priority order. Per-entity starvation counters raise the priority
+ *   of candidates that keep losing, so no entity is denied forever.
+ *
+ * Frame counters reset automatically at the start of every engine frame.
+ *
+ * Per-frame accounting lives in fixed arrays of atomics indexed by category and
+ * LOD level, with budgets cached from the config, so TrackReplication,
+ * CanReplicateThisFrame and the usage queries take no lock, do no map lookups
+ * and never reallocate. They are safe to call from parallel Mass processor chunks.
+ * Candidate submission is thread-safe (one short lock per batch).
  */
 UCLASS()
 class GSD_CORE_API UGSDNetworkBudgetSubsystem : public UEngineSubsystem
@@ -55,9 +121,39 @@ public:
     // Set configuration
     void SetConfig(UGSDNetworkBudgetConfig* InConfig);
 
-    // Reset frame counters (call at end of frame)
+    // Re-read category budgets and LOD limits from the config (also done every frame reset)
+    void RefreshBudgetCache();
+
+    // Reset frame counters (called automatically at the start of each frame)
     void ResetFrameCounters();
 
+    //-- Priority Scheduling --
+
+    /**
+     * Submit replication candidates for this frame's schedule. Thread-safe; submit
+     * one batch per chunk to keep lock traffic low.
+     */
+    void SubmitReplicationCandidates(EGSDBudgetCategory Category, TConstArrayView<FGSDReplicationCandidate> Candidates);
+
+    /**
+     * Rank this frame's submitted candidates and spend the category budget in priority
+     * order (respecting per-LOD MaxEntitiesPerFrame). Clears the pending candidates.
+     *
+     * @param Category Budget category to schedule
+     * @param OutApproved Approved candidates, highest priority first (reset by this call)
+     * @return Number of approved candidates
+     */
+    int32 ScheduleReplication(EGSDBudgetCategory Category, TArray<FGSDReplicationCandidate>& OutApproved);
+
+    // Consecutive schedules a candidate has been denied (0 if approved last time or unknown)
+    int32 GetStarvationFrames(EGSDBudgetCategory Category, uint64 EntityKey) const;
+
+    // Stats from the last ScheduleReplication for a category
+    FGSDReplicationScheduleStats GetLastScheduleStats(EGSDBudgetCategory Category) const;
+
+    // Priority of a candidate given its starvation count (higher replicates first)
+    float ComputeReplicationPriority(const FGSDReplicationCandidate& Candidate, int32 StarvationFrames) const;
+
     // Log current status
     void LogStatus() const;
 
@@ -66,17 +162,60 @@ protected:
     UPROPERTY()
     TObjectPtr<UGSDNetworkBudgetConfig> Config = nullptr;
 
-    // Current frame usage per category
-    TMap<EGSDBudgetCategory, int32> FrameUsage;
+    //-- Fixed-size frame accounting --
+    static constexpr int32 NumCategories = static_cast<int32>(EGSDBudgetCategory::Other) + 1;
+    static constexpr int32 MaxLODLevels = 8;  // Higher LOD levels share the last slot
+
+    static int32 GetCategoryIndex(EGSDBudgetCategory Category)
+    {
+        return FMath::Clamp(static_cast<int32>(Category), 0, NumCategories - 1);
+    }
+
+    static int32 GetLODIndex(int32 LODLevel)
+    {
+        return FMath::Clamp(LODLevel, 0, MaxLODLevels - 1);
+    }
+
+    // Current frame usage per category (bits)
+    std::atomic<int32> FrameUsage[NumCategories] = {};
+
+    // Entity counts per LOD this frame
+    std::atomic<int32> LODReplicationCounts[MaxLODLevels] = {};
+
+    // Budgets resolved from Config (bits per frame / max entities per frame)
+    std::atomic<int32> CachedCategoryBudgets[NumCategories] = {};
+    std::atomic<int32> CachedLODMaxEntities[MaxLODLevels] = {};
 
     // Rolling average usage (1 second window)
     TMap<EGSDBudgetCategory, TArray<int32>> UsageHistory;
 
-    // Entity counts per LOD
-    TArray<int32> LODReplicationCounts;
-
-    // Last warning time
-    float LastWarningTime = 0.0f;
+    // Last warning time (throttles budget warnings across threads)
+    std::atomic<double> LastWarningTime = 0.0;
+
+    //-- Scheduler State --
+    struct FStarvationEntry
+    {
+        int32 FramesStarved = 0;
+        uint32 LastSeenSchedule = 0;
+    };
+
+    struct FCategorySchedule
+    {
+        TArray<FGSDReplicationCandidate> Pending;
+        TMap<uint64, FStarvationEntry> Starvation;
+        FGSDReplicationScheduleStats LastStats;
+        uint32 ScheduleCounter = 0;
+        float LastStarvationWarningTime = 0.0f;
+    };
+
+    TMap<EGSDBudgetCategory, FCategorySchedule> Schedules;
+
+    // Guards Schedules (frame counters are atomics)
+    mutable FCriticalSection BudgetLock;
+
+    // Automatic per-frame reset
+    void OnBeginFrame();
+    FDelegateHandle BeginFrameHandle;
 
     // Update interval for history
     static constexpr float HistoryInterval = 1.0f;
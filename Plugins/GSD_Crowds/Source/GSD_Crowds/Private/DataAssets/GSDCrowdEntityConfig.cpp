@@ -2,8 +2,10 @@
 
 #include "DataAssets/GSDCrowdEntityConfig.h"
 #include "Fragments/GSDZombieStateFragment.h"
+#include "Fragments/GSDZombieMovementFragment.h"
 #include "Fragments/GSDNavigationFragment.h"
 #include "Fragments/GSDSmartObjectFragment.h"
+#include "Fragments/GSDFlowFieldFragment.h"
 #include "MassRepresentationFragments.h"
 #include "MassCommonFragments.h"
 #include "GSDCrowdLog.h"
@@ -31,9 +33,13 @@ void UGSDCrowdEntityConfig::ConfigureFragmentTypes()
     // Core transform fragment (required by Mass Entity)
     AddFragment<FDataFragment_Transform>();
 
-    // Custom zombie state
+    // Custom zombie state, split hot (per-frame movement/timers) and cold (stats)
+    AddFragment<FGSDZombieMovementFragment>();
     AddFragment<FGSDZombieStateFragment>();
 
+    // Pursuit flow field binding (only sampled when bEnableFlowFieldPursuit is set)
+    AddFragment<FGSDFlowFieldFragment>();
+
     // LOD representation fragments
     AddFragment<FMassRepresentationFragment>();
     AddFragment<FMassRepresentationLODFragment>();
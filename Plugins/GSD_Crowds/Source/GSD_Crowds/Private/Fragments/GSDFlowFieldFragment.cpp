@@ -0,0 +1,5 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#include "Fragments/GSDFlowFieldFragment.h"
+
+// Header-only struct - no implementation needed
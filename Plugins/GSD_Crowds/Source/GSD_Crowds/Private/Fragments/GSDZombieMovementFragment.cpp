@@ -0,0 +1,5 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#include "Fragments/GSDZombieMovementFragment.h"
+
+// Fragment is header-only - no implementation needed
@@ -4,13 +4,48 @@
 #include "DataAssets/GSDCrowdConfig.h"
 #include "Subsystems/GSDNetworkBudgetSubsystem.h"
 #include "Subsystems/GSDCrowdManagerSubsystem.h"
+#include "Fragments/GSDBehaviorLODTags.h"
+#include "Managers/GSDDeterminismManager.h"
 #include "MassRepresentationFragments.h"
 #include "MassCommonFragments.h"
 #include "GameFramework/PlayerController.h"
 #include "Camera/PlayerCameraManager.h"
-#include "Engine/GameInstance.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
 #include "GSDCrowdLog.h"
 
+namespace GSDBehaviorLODHelpers
+{
+    /** Bucket of the chunk's archetype (all entities in a chunk share tags). */
+    int32 GetChunkBucket(const FMassExecutionContext& Context)
+    {
+        if (Context.DoesArchetypeHaveTag<FGSDBehaviorLODBucket1Tag>()) return 1;
+        if (Context.DoesArchetypeHaveTag<FGSDBehaviorLODBucket2Tag>()) return 2;
+        if (Context.DoesArchetypeHaveTag<FGSDBehaviorLODBucket3Tag>()) return 3;
+        return 0;
+    }
+
+    /** Defer the tag change moving an entity between buckets (bucket 0 has no tag). */
+    void MoveToBucket(FMassExecutionContext& Context, const FMassEntityHandle Entity, int32 FromBucket, int32 ToBucket)
+    {
+        switch (FromBucket)
+        {
+        case 1: Context.Defer().RemoveTag<FGSDBehaviorLODBucket1Tag>(Entity); break;
+        case 2: Context.Defer().RemoveTag<FGSDBehaviorLODBucket2Tag>(Entity); break;
+        case 3: Context.Defer().RemoveTag<FGSDBehaviorLODBucket3Tag>(Entity); break;
+        default: break;
+        }
+
+        switch (ToBucket)
+        {
+        case 1: Context.Defer().AddTag<FGSDBehaviorLODBucket1Tag>(Entity); break;
+        case 2: Context.Defer().AddTag<FGSDBehaviorLODBucket2Tag>(Entity); break;
+        case 3: Context.Defer().AddTag<FGSDBehaviorLODBucket3Tag>(Entity); break;
+        default: break;
+        }
+    }
+}
+
 UGSDCrowdLODProcessor::UGSDCrowdLODProcessor()
 {
     // Execute LATE - After all behavior updates complete
@@ -34,68 +69,148 @@ void UGSDCrowdLODProcessor::Execute(FMassEntityManager& EntityManager, FMassExec
         CachedConfig = UGSDCrowdConfig::GetDefaultConfig();
     }
 
-    // Get budget subsystem
-    UGSDNetworkBudgetSubsystem* BudgetSubsystem = nullptr;
-    if (UWorld* World = Context.GetWorld())
-    {
-        if (UGameInstance* GI = World->GetGameInstance())
-        {
-            BudgetSubsystem = GI->GetSubsystem<UGSDNetworkBudgetSubsystem>();
-        }
-    }
-
     // Get crowd manager for cell checking
     UGSDCrowdManagerSubsystem* CrowdManager = nullptr;
-    if (UWorld* World = Context.GetWorld())
+    UWorld* World = Context.GetWorld();
+    if (World)
     {
         CrowdManager = World->GetSubsystem<UGSDCrowdManagerSubsystem>();
     }
 
-    const FVector ViewerLocation = GetViewerLocation(Context);
-
-    EntityQuery.ForEachEntityChunk(EntityManager, Context,
-        [&](FMassExecutionContext& Context)
+    // Get budget subsystem (engine subsystem - shared by all worlds). Only servers
+    // replicate crowds, so standalone and clients skip scheduling entirely
+    const ENetMode NetMode = World ? World->GetNetMode() : NM_Standalone;
+    const bool bScheduleReplication = NetMode == NM_DedicatedServer || NetMode == NM_ListenServer;
+    UGSDNetworkBudgetSubsystem* BudgetSubsystem = (bScheduleReplication && GEngine)
+        ? GEngine->GetEngineSubsystem<UGSDNetworkBudgetSubsystem>()
+        : nullptr;
+    ApprovedReplication.Reset();
+
+    // Viewers and squared thresholds are resolved once per frame, not per entity
+    TArray<FVector, TInlineAllocator<4>> ViewerLocations;
+    GetViewerLocations(Context, ViewerLocations);
+    const FGSDLODSquaredThresholds Thresholds = GetSquaredLODThresholds();
+
+    const bool bParallel = CachedConfig && CachedConfig->bParallelLOD;
+    const bool bAssignBehaviorBuckets = CachedConfig ? CachedConfig->bEnableBehaviorLODBuckets : true;
+    const bool bHibernateUnloaded = CachedConfig ? CachedConfig->bEnableCellHibernation : true;
+
+    // Entities found in unloaded cells; rare, so a lock around the append is fine
+    TArray<FMassEntityHandle> UnloadedEntities;
+    FCriticalSection UnloadedEntitiesLock;
+
+    // Cell residency reads and candidate submission are thread-safe; scratch buffers
+    // are chunk-local so chunks may run in parallel
+    auto ProcessChunk =
+        [BudgetSubsystem, CrowdManager, &ViewerLocations, Thresholds, bAssignBehaviorBuckets, bHibernateUnloaded,
+         &UnloadedEntities, &UnloadedEntitiesLock](FMassExecutionContext& Context)
         {
             auto LODFragments = Context.GetMutableFragmentView<FMassRepresentationLODFragment>();
             const auto& Transforms = Context.GetFragmentView<FDataFragment_Transform>();
+            const int32 NumEntities = Context.GetNumEntities();
 
-            for (int32 i = 0; i < Context.GetNumEntities(); ++i)
+            // Behavior bucket is an archetype tag, so it is uniform across the chunk
+            const int32 ChunkBucket = GSDBehaviorLODHelpers::GetChunkBucket(Context);
+            auto UpdateBehaviorBucket = [&Context, ChunkBucket, bAssignBehaviorBuckets](int32 EntityIndex, float LODSignificance)
             {
-                const FVector EntityLocation = Transforms[i].GetTransform().GetLocation();
+                const int32 NewBucket = GSDBehaviorLOD::GetBucketForSignificance(LODSignificance);
+                if (bAssignBehaviorBuckets && NewBucket != ChunkBucket)
+                {
+                    GSDBehaviorLODHelpers::MoveToBucket(Context, Context.GetEntity(EntityIndex), ChunkBucket, NewBucket);
+                }
+            };
 
+            // Chunk-local scratch: positions feed both the residency batch and the SIMD kernel
+            TArray<FVector, TInlineAllocator<128>> ChunkPositions;
+            TArray<float, TInlineAllocator<128>> ChunkSignificance;
+            TArray<float, TInlineAllocator<128>> ChunkDistanceSq;
+            TArray<FGSDReplicationCandidate, TInlineAllocator<128>> ChunkCandidates;
+            TBitArray<> ChunkCellLoaded;
+
+            ChunkPositions.SetNumUninitialized(NumEntities);
+            for (int32 i = 0; i < NumEntities; ++i)
+            {
+                ChunkPositions[i] = Transforms[i].GetTransform().GetLocation();
+            }
+
+            // Resolve streaming cell residency for the whole chunk at once
+            if (CrowdManager)
+            {
+                CrowdManager->ArePositionsInLoadedCells(ChunkPositions, ChunkCellLoaded);
+            }
+
+            // Significance for the whole chunk in one pass
+            ChunkSignificance.SetNumUninitialized(NumEntities);
+            ChunkDistanceSq.SetNumUninitialized(NumEntities);
+            UGSDCrowdLODProcessor::CalculateLODSignificanceBatch(ChunkPositions, ViewerLocations, Thresholds, ChunkSignificance, ChunkDistanceSq);
+
+            for (int32 i = 0; i < NumEntities; ++i)
+            {
                 // Skip if in unloaded cell (cell-aware LOD)
-                if (CrowdManager && !CrowdManager->IsPositionInLoadedCell(EntityLocation))
+                if (CrowdManager && !ChunkCellLoaded[i])
                 {
                     // Mark for culling - entity is in unloaded streaming cell
                     LODFragments[i].LODSignificance = 3.0f;  // Max LOD = culled
+                    UpdateBehaviorBucket(i, 3.0f);
+
+                    // Wandered into an unloaded cell: hibernate after the chunk pass
+                    if (bHibernateUnloaded)
+                    {
+                        FScopeLock Lock(&UnloadedEntitiesLock);
+                        UnloadedEntities.Add(Context.GetEntity(i));
+                    }
                     continue;
                 }
 
-                const float Distance = FVector::Dist(EntityLocation, ViewerLocation);
-
                 // Calculate LOD level (0-3)
-                const float LODSignificance = CalculateLODSignificance(Distance);
+                const float LODSignificance = ChunkSignificance[i];
                 const int32 LODLevel = FMath::FloorToInt(LODSignificance);
 
-                // Check if we can replicate this frame
-                if (BudgetSubsystem && !BudgetSubsystem->CanReplicateThisFrame(EGSDBudgetCategory::Crowd, LODLevel))
+                // Render LOD and behavior buckets are local simulation, never gated by the network budget
+                LODFragments[i].LODSignificance = LODSignificance;
+                UpdateBehaviorBucket(i, LODSignificance);
+
+                if (!BudgetSubsystem)
                 {
-                    // Skip this entity this frame - bandwidth budget exceeded
                     continue;
                 }
 
-                // Update LOD significance
-                LODFragments[i].LODSignificance = LODSignificance;
+                // Queue for the frame's replication schedule; the budget only picks who replicates
+                const FMassEntityHandle Entity = Context.GetEntity(i);
+                FGSDReplicationCandidate& Candidate = ChunkCandidates.AddDefaulted_GetRef();
+                Candidate.EntityKey = FGSDCounterRandom::MakeEntityKey(Entity.Index, Entity.SerialNumber);
+                Candidate.LODLevel = LODLevel;
+                Candidate.Significance = LODSignificance;
+                Candidate.DistanceSquared = ChunkDistanceSq[i];
+                Candidate.EstimatedBits = EstimatedBitsPerEntity;
+            }
 
-                // Track bandwidth usage
-                if (BudgetSubsystem)
-                {
-                    // Estimate bits used: Position (FVector = 3 floats = 96 bits) + State (uint8 = 8 bits)
-                    constexpr int32 EstimatedBitsPerEntity = 96 + 8;
-                    BudgetSubsystem->TrackReplication(EGSDBudgetCategory::Crowd, EstimatedBitsPerEntity);
-                }
+            if (BudgetSubsystem)
+            {
+                BudgetSubsystem->SubmitReplicationCandidates(EGSDBudgetCategory::Crowd, ChunkCandidates);
             }
-        });
+        };
+
+    if (bParallel)
+    {
+        EntityQuery.ParallelForEachEntityChunk(EntityManager, Context, ProcessChunk);
+    }
+    else
+    {
+        EntityQuery.ForEachEntityChunk(EntityManager, Context, ProcessChunk);
+    }
+
+    // Take entities in unloaded cells out of the simulation until their cell loads
+    if (CrowdManager && UnloadedEntities.Num() > 0)
+    {
+        CrowdManager->HibernateEntities(UnloadedEntities);
+    }
+
+    // Spend the crowd budget in priority order (advisory - see GetApprovedReplication)
+    if (BudgetSubsystem)
+    {
+        BudgetSubsystem->ScheduleReplication(EGSDBudgetCategory::Crowd, ApprovedReplication);
+    }
 }
 
 float UGSDCrowdLODProcessor::CalculateLODSignificance(float Distance) const
@@ -115,6 +230,128 @@ float UGSDCrowdLODProcessor::CalculateLODSignificance(float Distance) const
     return 3.0f;                                    // Far culled
 }
 
+float UGSDCrowdLODProcessor::CalculateLODSignificanceSquared(float DistanceSquared, const FGSDLODSquaredThresholds& Thresholds)
+{
+    // Same bands as CalculateLODSignificance, compared against squared thresholds
+    if (DistanceSquared < Thresholds.HighActor) return 0.0f;
+    if (DistanceSquared < Thresholds.LowActor) return 0.75f;
+    if (DistanceSquared < Thresholds.ISM) return 1.75f;
+    if (DistanceSquared < Thresholds.Cull) return 2.5f;
+    return 3.0f;
+}
+
+void UGSDCrowdLODProcessor::CalculateLODSignificanceBatch(TConstArrayView<FVector> Positions, TConstArrayView<FVector> ViewerLocations,
+    const FGSDLODSquaredThresholds& Thresholds, TArrayView<float> OutSignificance,
+    TArrayView<float> OutMinDistanceSquared)
+{
+    check(Positions.Num() == OutSignificance.Num());
+    check(OutMinDistanceSquared.Num() == 0 || OutMinDistanceSquared.Num() == Positions.Num());
+    const bool bWriteDistance = OutMinDistanceSquared.Num() > 0;
+    check(ViewerLocations.Num() > 0);
+
+    const int32 Num = Positions.Num();
+    const int32 NumSimd = Num & ~3;
+
+    const VectorRegister4Float HighActorSq = VectorSetFloat1(Thresholds.HighActor);
+    const VectorRegister4Float LowActorSq = VectorSetFloat1(Thresholds.LowActor);
+    const VectorRegister4Float ISMSq = VectorSetFloat1(Thresholds.ISM);
+    const VectorRegister4Float CullSq = VectorSetFloat1(Thresholds.Cull);
+
+    const VectorRegister4Float Sig0 = VectorSetFloat1(0.0f);
+    const VectorRegister4Float Sig1 = VectorSetFloat1(0.75f);
+    const VectorRegister4Float Sig2 = VectorSetFloat1(1.75f);
+    const VectorRegister4Float Sig3 = VectorSetFloat1(2.5f);
+    const VectorRegister4Float SigFar = VectorSetFloat1(3.0f);
+
+    // 4 entities per iteration, transposed to SoA registers
+    for (int32 i = 0; i < NumSimd; i += 4)
+    {
+        const FVector& P0 = Positions[i];
+        const FVector& P1 = Positions[i + 1];
+        const FVector& P2 = Positions[i + 2];
+        const FVector& P3 = Positions[i + 3];
+        const VectorRegister4Float X = MakeVectorRegisterFloat((float)P0.X, (float)P1.X, (float)P2.X, (float)P3.X);
+        const VectorRegister4Float Y = MakeVectorRegisterFloat((float)P0.Y, (float)P1.Y, (float)P2.Y, (float)P3.Y);
+        const VectorRegister4Float Z = MakeVectorRegisterFloat((float)P0.Z, (float)P1.Z, (float)P2.Z, (float)P3.Z);
+
+        // Squared distance to nearest viewer
+        VectorRegister4Float MinDistSq = VectorSetFloat1(MAX_flt);
+        for (const FVector& Viewer : ViewerLocations)
+        {
+            const VectorRegister4Float DX = VectorSubtract(X, VectorSetFloat1((float)Viewer.X));
+            const VectorRegister4Float DY = VectorSubtract(Y, VectorSetFloat1((float)Viewer.Y));
+            const VectorRegister4Float DZ = VectorSubtract(Z, VectorSetFloat1((float)Viewer.Z));
+            VectorRegister4Float DistSq = VectorMultiply(DX, DX);
+            DistSq = VectorMultiplyAdd(DY, DY, DistSq);
+            DistSq = VectorMultiplyAdd(DZ, DZ, DistSq);
+            MinDistSq = VectorMin(MinDistSq, DistSq);
+        }
+
+        // Select bands from far to near so the nearest matching band wins
+        VectorRegister4Float Significance = SigFar;
+        Significance = VectorSelect(VectorCompareLT(MinDistSq, CullSq), Sig3, Significance);
+        Significance = VectorSelect(VectorCompareLT(MinDistSq, ISMSq), Sig2, Significance);
+        Significance = VectorSelect(VectorCompareLT(MinDistSq, LowActorSq), Sig1, Significance);
+        Significance = VectorSelect(VectorCompareLT(MinDistSq, HighActorSq), Sig0, Significance);
+
+        VectorStore(Significance, &OutSignificance[i]);
+        if (bWriteDistance)
+        {
+            VectorStore(MinDistSq, &OutMinDistanceSquared[i]);
+        }
+    }
+
+    // Scalar tail
+    for (int32 i = NumSimd; i < Num; ++i)
+    {
+        float MinDistSq = MAX_flt;
+        for (const FVector& Viewer : ViewerLocations)
+        {
+            MinDistSq = FMath::Min(MinDistSq, (float)FVector::DistSquared(Positions[i], Viewer));
+        }
+        OutSignificance[i] = CalculateLODSignificanceSquared(MinDistSq, Thresholds);
+        if (bWriteDistance)
+        {
+            OutMinDistanceSquared[i] = MinDistSq;
+        }
+    }
+}
+
+FGSDLODSquaredThresholds UGSDCrowdLODProcessor::GetSquaredLODThresholds() const
+{
+    FGSDLODSquaredThresholds Thresholds;
+    Thresholds.HighActor = FMath::Square(GetHighActorDistance());
+    Thresholds.LowActor = FMath::Square(GetLowActorDistance());
+    Thresholds.ISM = FMath::Square(GetISMDistance());
+    Thresholds.Cull = FMath::Square(GetCullDistance());
+    return Thresholds;
+}
+
+void UGSDCrowdLODProcessor::GetViewerLocations(FMassExecutionContext& Context, TArray<FVector, TInlineAllocator<4>>& OutViewerLocations) const
+{
+    OutViewerLocations.Reset();
+
+    if (UWorld* World = Context.GetWorld())
+    {
+        for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+        {
+            if (const APlayerController* PC = It->Get())
+            {
+                // View point covers local cameras and remote players on a server
+                FVector ViewLocation;
+                FRotator ViewRotation;
+                PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+                OutViewerLocations.Add(ViewLocation);
+            }
+        }
+    }
+
+    if (OutViewerLocations.Num() == 0)
+    {
+        OutViewerLocations.Add(FVector::ZeroVector);
+    }
+}
+
 FVector UGSDCrowdLODProcessor::GetViewerLocation(FMassExecutionContext& Context) const
 {
     if (UWorld* World = Context.GetWorld())
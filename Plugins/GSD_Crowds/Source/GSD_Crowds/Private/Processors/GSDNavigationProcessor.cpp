@@ -2,13 +2,19 @@
 
 #include "Processors/GSDNavigationProcessor.h"
 #include "Fragments/GSDNavigationFragment.h"
-#include "Fragments/GSDZombieStateFragment.h"
+#include "Fragments/GSDZombieMovementFragment.h"
+#include "Fragments/GSDFlowFieldFragment.h"
+#include "Subsystems/GSDFlowFieldSubsystem.h"
 #include "MassEntity/DataFragmentTypes.h"
 #include "MassRepresentation/RepresentationFragment.h"
 #include "ZoneGraph/ZoneGraphSubsystem.h"
 #include "ZoneGraph/ZoneGraphTypes.h"
+#include "ZoneGraph/ZoneGraphDelegates.h"
+#include "ZoneGraph/ZoneGraphStorage.h"
 #include "Managers/GSDDeterminismManager.h"
 #include "Engine/GameInstance.h"
+#include "DataAssets/GSDCrowdConfig.h"
+#include "Algo/Sort.h"
 
 UGSDNavigationProcessor::UGSDNavigationProcessor()
 {
@@ -19,11 +25,56 @@ UGSDNavigationProcessor::UGSDNavigationProcessor()
     ProcessingPhase = EMassProcessingPhase::PrePhysics;
 }
 
+void UGSDNavigationProcessor::BeginDestroy()
+{
+    UE::ZoneGraphDelegates::OnPostZoneGraphDataAdded.Remove(ZoneGraphDataAddedHandle);
+    UE::ZoneGraphDelegates::OnPreZoneGraphDataRemoved.Remove(ZoneGraphDataRemovedHandle);
+
+    Super::BeginDestroy();
+}
+
+void UGSDNavigationProcessor::BindZoneGraphDelegates()
+{
+    if (ZoneGraphDataAddedHandle.IsValid())
+    {
+        return;
+    }
+
+    ZoneGraphDataAddedHandle = UE::ZoneGraphDelegates::OnPostZoneGraphDataAdded.AddUObject(this, &UGSDNavigationProcessor::OnZoneGraphDataChanged);
+    ZoneGraphDataRemovedHandle = UE::ZoneGraphDelegates::OnPreZoneGraphDataRemoved.AddUObject(this, &UGSDNavigationProcessor::OnZoneGraphDataChanged);
+}
+
+void UGSDNavigationProcessor::OnZoneGraphDataChanged(const AZoneGraphData* ZoneGraphData)
+{
+    InvalidateLaneCandidateCache();
+}
+
+void UGSDNavigationProcessor::InvalidateLaneCandidateCache()
+{
+    FWriteScopeLock WriteLock(LaneCandidateLock);
+    LaneCandidateCells.Reset();
+}
+
+int64 UGSDNavigationProcessor::GetLaneCandidateCellKey(const FVector& Location, FVector& OutCellCenter) const
+{
+    const float CellSize = FMath::Max(LaneSearchRadius, 1.0f);
+    const int32 X = FMath::FloorToInt(Location.X / CellSize);
+    const int32 Y = FMath::FloorToInt(Location.Y / CellSize);
+    const int32 Z = FMath::FloorToInt(Location.Z / CellSize);
+
+    OutCellCenter = FVector(X + 0.5f, Y + 0.5f, Z + 0.5f) * CellSize;
+
+    // 21 bits per axis (+/- 1M cells)
+    constexpr int64 Mask = (1 << 21) - 1;
+    return ((static_cast<int64>(X) & Mask) << 42) | ((static_cast<int64>(Y) & Mask) << 21) | (static_cast<int64>(Z) & Mask);
+}
+
 void UGSDNavigationProcessor::ConfigureQueries()
 {
     EntityQuery.AddRequirement<FGSDNavigationFragment>(EMassFragmentAccess::ReadWrite);
     EntityQuery.AddRequirement<FDataFragment_Transform>(EMassFragmentAccess::ReadWrite);
-    EntityQuery.AddRequirement<FGSDZombieStateFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FGSDZombieMovementFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FGSDFlowFieldFragment>(EMassFragmentAccess::ReadWrite, EMassFragmentPresence::Optional);
 }
 
 void UGSDNavigationProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
@@ -45,71 +96,172 @@ void UGSDNavigationProcessor::Execute(FMassEntityManager& EntityManager, FMassEx
         DeterminismManager = GameInstance->GetSubsystem<UGSDDeterminismManager>();
     }
 
-    EntityQuery.ForEachEntityChunk(EntityManager, Context,
-        [this, ZoneGraphSubsystem, bZoneGraphAvailable, DeltaTime, DeterminismManager](FMassExecutionContext& Context)
+    // Resolve the counter stream once per frame - each entity derives its own
+    // generator from (stream, entity, frame) so chunk order never affects results
+    const uint64 NavStreamKey = DeterminismManager
+        ? DeterminismManager->GetCounterStreamKey(UGSDDeterminismManager::NavigationCategory)
+        : FGSDCounterRandom::MakeStreamKey(FallbackNavigationSeed, UGSDDeterminismManager::NavigationCategory);
+    const uint32 RandomFrame = DeterminismManager
+        ? DeterminismManager->GetCounterFrame()
+        : static_cast<uint32>(GFrameCounter);
+
+    // Load config (cached for frame)
+    if (!CachedConfig)
+    {
+        CachedConfig = UGSDCrowdConfig::GetDefaultConfig();
+    }
+
+    // Lane candidate cache must drop cells when ZoneGraph data streams in/out
+    BindZoneGraphDelegates();
+    const bool bParallel = CachedConfig && CachedConfig->bParallelNavigation;
+
+    // Fields are only mutated by the behavior processor, which runs after this one
+    const UGSDFlowFieldSubsystem* FlowFieldSubsystem = (CachedConfig && CachedConfig->bEnableFlowFieldPursuit)
+        ? World->GetSubsystem<UGSDFlowFieldSubsystem>()
+        : nullptr;
+
+    // Separation steering from UGSDSeparationProcessor (computed last frame)
+    const bool bApplySeparation = CachedConfig ? CachedConfig->bEnableSeparation : true;
+    const float MaxLaneOffset = CachedConfig ? CachedConfig->MaxLaneSeparationOffset : DefaultMaxLaneSeparationOffset;
+    const float LaneOffsetRecoveryRate = CachedConfig ? CachedConfig->LaneOffsetRecoveryRate : DefaultLaneOffsetRecoveryRate;
+
+    // Per-entity work only touches the entity's own fragments, const ZoneGraph queries,
+    // its own counter RNG and the per-thread RecordRandomCall buffers, so chunks may run in parallel
+    auto ProcessChunk =
+        [this, ZoneGraphSubsystem, bZoneGraphAvailable, DeltaTime, DeterminismManager, NavStreamKey, RandomFrame, FlowFieldSubsystem,
+         bApplySeparation, MaxLaneOffset, LaneOffsetRecoveryRate](FMassExecutionContext& Context)
         {
             auto NavFragments = Context.GetMutableFragmentView<FGSDNavigationFragment>();
             auto Transforms = Context.GetMutableFragmentView<FDataFragment_Transform>();
-            const auto ZombieStates = Context.GetFragmentView<FGSDZombieStateFragment>();
+            const auto ZombieStates = Context.GetFragmentView<FGSDZombieMovementFragment>();
+
+            // Optional - empty for archetypes without the fragment
+            auto FlowFields = Context.GetMutableFragmentView<FGSDFlowFieldFragment>();
+            const bool bHasFlowFields = FlowFieldSubsystem && FlowFields.Num() > 0;
+
+            // On-lane entities are sampled together after the loop, grouped by lane
+            TArray<FLaneSampleRequest, TInlineAllocator<256>> LaneRequests;
 
             for (int32 i = 0; i < Context.GetNumEntities(); ++i)
             {
                 FGSDNavigationFragment& Nav = NavFragments[i];
                 FDataFragment_Transform& Transform = Transforms[i];
-                const FGSDZombieStateFragment& Zombie = ZombieStates[i];
+                const FGSDZombieMovementFragment& Zombie = ZombieStates[i];
+
+                const FMassEntityHandle Entity = Context.GetEntity(i);
+                FGSDCounterRandom NavRandom(NavStreamKey, FGSDCounterRandom::MakeEntityKey(Entity.Index, Entity.SerialNumber), RandomFrame);
+
+                // Pursuers with a target flow field leave lanes and follow the field
+                if (bHasFlowFields)
+                {
+                    if (ExecuteFlowFieldMovement(FlowFields[i], Transform, Zombie, *FlowFieldSubsystem, DeltaTime, NavRandom, DeterminismManager))
+                    {
+                        ApplySeparation(Nav, Transform, DeltaTime, bApplySeparation);
+                        Nav.bIsOnLane = false;
+                        Nav.bUseFallbackMovement = false;
+                        Nav.LaneOffset = FVector::ZeroVector;
+                        continue;
+                    }
+                }
 
                 // Check if ZoneGraph is available
                 if (!bZoneGraphAvailable)
                 {
                     Nav.bUseFallbackMovement = true;
-                    ExecuteFallbackMovement(Nav, Transform, Zombie, DeltaTime, DeterminismManager);
+                    Nav.LaneOffset = FVector::ZeroVector;
+                    ExecuteFallbackMovement(Nav, Transform, Zombie, DeltaTime, NavRandom, DeterminismManager);
+                    ApplySeparation(Nav, Transform, DeltaTime, bApplySeparation);
                     continue;
                 }
 
                 // Not on a lane yet - find one
                 if (!Nav.bIsOnLane || !Nav.CurrentLane.IsValid())
                 {
-                    FindNearestLane(Nav, Transform, ZoneGraphSubsystem, DeterminismManager);
+                    FindNearestLane(Nav, Transform, ZoneGraphSubsystem, NavRandom, DeterminismManager);
                     if (!Nav.bIsOnLane)
                     {
                         // Still no lane, use fallback
                         Nav.bUseFallbackMovement = true;
-                        ExecuteFallbackMovement(Nav, Transform, Zombie, DeltaTime, DeterminismManager);
+                        Nav.LaneOffset = FVector::ZeroVector;
+                        ExecuteFallbackMovement(Nav, Transform, Zombie, DeltaTime, NavRandom, DeterminismManager);
+                        ApplySeparation(Nav, Transform, DeltaTime, bApplySeparation);
                         continue;
                     }
                 }
 
                 // Move along lane with randomized velocity (CROWD-08)
                 Nav.bUseFallbackMovement = false;
-                const float RandomizedSpeed = ApplyVelocityRandomization(Zombie.MovementSpeed, VelocityRandomizationPercent, DeterminismManager);
+                RefreshLaneCache(Nav, ZoneGraphSubsystem);
+                const float RandomizedSpeed = ApplyVelocityRandomization(Zombie.MovementSpeed, VelocityRandomizationPercent, NavRandom, DeterminismManager);
                 Nav.LanePosition += RandomizedSpeed * DeltaTime;
 
-                // Update transform from lane position
-                UpdateTransformFromLane(Nav, Transform, ZoneGraphSubsystem);
+                // Check if reached end of lane (cached length) before sampling, so the
+                // entity's RNG stays local to this iteration
+                CheckLaneProgress(Nav, ZoneGraphSubsystem, NavRandom, DeterminismManager);
+
+                if (Nav.bIsOnLane && Nav.CurrentLane.IsValid())
+                {
+                    LaneRequests.Add({ Nav.CurrentLane, Nav.LanePosition, i });
 
-                // Check if reached end of lane
-                CheckLaneProgress(Nav, ZoneGraphSubsystem, DeterminismManager);
+                    // Lane samples are absolute, so separation builds up a bounded offset instead
+                    Nav.LaneOffset = UpdateLaneOffset(Nav.LaneOffset, Nav.DesiredVelocity, DeltaTime, bApplySeparation, MaxLaneOffset, LaneOffsetRecoveryRate);
+                }
+                else
+                {
+                    Nav.LaneOffset = FVector::ZeroVector;
+                }
             }
-        });
+
+            // Update transforms from lane positions, one lane at a time
+            UpdateTransformsFromLanes(LaneRequests, Transforms, ZoneGraphSubsystem);
+
+            for (const FLaneSampleRequest& Request : LaneRequests)
+            {
+                const FVector& LaneOffset = NavFragments[Request.EntityIndex].LaneOffset;
+                if (!LaneOffset.IsZero())
+                {
+                    FTransform OffsetTransform = Transforms[Request.EntityIndex].GetTransform();
+                    OffsetTransform.AddToTranslation(LaneOffset);
+                    Transforms[Request.EntityIndex].SetTransform(OffsetTransform);
+                }
+            }
+        };
+
+    if (bParallel)
+    {
+        EntityQuery.ParallelForEachEntityChunk(EntityManager, Context, ProcessChunk);
+    }
+    else
+    {
+        EntityQuery.ForEachEntityChunk(EntityManager, Context, ProcessChunk);
+    }
+}
+
+FVector UGSDNavigationProcessor::UpdateLaneOffset(const FVector& LaneOffset, const FVector& DesiredVelocity, float DeltaTime,
+    bool bApplySeparation, float MaxLaneOffset, float RecoveryRate)
+{
+    if (bApplySeparation && !DesiredVelocity.IsNearlyZero())
+    {
+        return (LaneOffset + DesiredVelocity * DeltaTime).GetClampedToMaxSize2D(MaxLaneOffset);
+    }
+
+    // Not pushed: ease back onto the lane (frame-rate independent)
+    const FVector Decayed = LaneOffset * FMath::Exp(-RecoveryRate * DeltaTime);
+    return Decayed.SizeSquared2D() < 1.0f ? FVector::ZeroVector : Decayed.GetClampedToMaxSize2D(MaxLaneOffset);
 }
 
-float UGSDNavigationProcessor::ApplyVelocityRandomization(float BaseSpeed, float RandomizationPercent, UGSDDeterminismManager* DeterminismManager) const
+float UGSDNavigationProcessor::ApplyVelocityRandomization(
+    float BaseSpeed,
+    float RandomizationPercent,
+    FGSDCounterRandom& Random,
+    UGSDDeterminismManager* DeterminismManager) const
 {
     // CROWD-08: Apply velocity randomization to prevent synchronized movement
     // Randomization is +/- RandomizationPercent of base speed
-    // Use seeded random from DeterminismManager for determinism
-    float RandomFactor = 1.0f;
+    const float RandomFactor = 1.0f + Random.FRandRange(-RandomizationPercent, RandomizationPercent) / 100.0f;
     if (DeterminismManager)
     {
-        FRandomStream& NavStream = DeterminismManager->GetCategoryStream(UGSDDeterminismManager::NavigationCategory);
-        RandomFactor = 1.0f + NavStream.FRandRange(-RandomizationPercent, RandomizationPercent) / 100.0f;
-        DeterminismManager->RecordRandomCall(UGSDDeterminismManager::NavigationCategory, RandomFactor);
-    }
-    else
-    {
-        // Fallback to seeded random for determinism even without manager
-        static FRandomStream FallbackNavStream(98765);
-        RandomFactor = 1.0f + FallbackNavStream.FRandRange(-RandomizationPercent, RandomizationPercent) / 100.0f;
+        DeterminismManager->RecordRandomCall(UGSDDeterminismManager::NavigationCategory, RandomFactor, Random.GetEntityKey());
     }
     return BaseSpeed * RandomFactor;
 }
@@ -118,6 +270,7 @@ void UGSDNavigationProcessor::FindNearestLane(
     FGSDNavigationFragment& Nav,
     const FDataFragment_Transform& Transform,
     const UZoneGraphSubsystem* ZoneGraphSubsystem,
+    FGSDCounterRandom& Random,
     UGSDDeterminismManager* DeterminismManager) const
 {
     if (!ZoneGraphSubsystem)
@@ -127,62 +280,145 @@ void UGSDNavigationProcessor::FindNearestLane(
 
     const FVector Location = Transform.GetTransform().GetLocation();
 
-    // Query lanes in bounds
-    TArray<FZoneGraphLaneHandle> NearbyLanes;
-    ZoneGraphSubsystem->FindLanesInBounds(
-        FBoxCenterAndExtent(Location, FVector(LaneSearchRadius)),
-        NearbyLanes
-    );
-
-    if (NearbyLanes.IsEmpty())
+    // Pick from the cell's prebuilt candidates (no bounds query per entity)
+    const FZoneGraphLaneHandle Lane = PickRandomNearbyLane(Location, ZoneGraphSubsystem, Random, DeterminismManager);
+    if (!Lane.IsValid() || !BindToLane(Nav, Lane, Location, ZoneGraphSubsystem))
     {
         Nav.bIsOnLane = false;
-        return;
     }
+}
 
-    // Pick lane using seeded random for determinism
-    int32 LaneIndex = 0;
-    if (DeterminismManager)
-    {
-        FRandomStream& NavStream = DeterminismManager->GetCategoryStream(UGSDDeterminismManager::NavigationCategory);
-        LaneIndex = NavStream.RandHelper(NearbyLanes.Num());
-        DeterminismManager->RecordRandomCall(UGSDDeterminismManager::NavigationCategory, static_cast<float>(LaneIndex));
-    }
-    else
+bool UGSDNavigationProcessor::BindToLane(
+    FGSDNavigationFragment& Nav,
+    const FZoneGraphLaneHandle& Lane,
+    const FVector& Location,
+    const UZoneGraphSubsystem* ZoneGraphSubsystem) const
+{
+    // Start where the entity already is along the lane, not at its first point.
+    // Candidates overlap the entity's search box, so twice the radius reaches the box corners
+    FZoneGraphLaneLocation LaneLocation;
+    float DistanceSqr = 0.0f;
+    if (!ZoneGraphSubsystem->FindNearestLocationOnLane(Lane, Location, LaneSearchRadius * 2.0f, LaneLocation, DistanceSqr))
     {
-        static FRandomStream FallbackLaneStream(11111);
-        LaneIndex = FallbackLaneStream.RandHelper(NearbyLanes.Num());
+        return false;
     }
 
-    Nav.CurrentLane = NearbyLanes[LaneIndex];
-    Nav.LanePosition = 0.0f;
+    Nav.CurrentLane = Lane;
+    Nav.LanePosition = LaneLocation.DistanceAlongLane;
     Nav.bIsOnLane = true;
     Nav.bReachedDestination = false;
+
+    // Offset is relative to the new lane's sample; clamped and eased back by UpdateLaneOffset
+    Nav.LaneOffset = FVector(Location.X - LaneLocation.Position.X, Location.Y - LaneLocation.Position.Y, 0.0f);
+    return true;
 }
 
-void UGSDNavigationProcessor::UpdateTransformFromLane(
-    FGSDNavigationFragment& Nav,
-    FDataFragment_Transform& Transform,
+void UGSDNavigationProcessor::UpdateTransformsFromLanes(
+    TArrayView<FLaneSampleRequest> Requests,
+    TArrayView<FDataFragment_Transform> Transforms,
     const UZoneGraphSubsystem* ZoneGraphSubsystem) const
 {
-    if (!Nav.CurrentLane.IsValid() || !ZoneGraphSubsystem)
+    if (Requests.IsEmpty() || !ZoneGraphSubsystem)
     {
         return;
     }
 
-    FZoneGraphLaneLocation LaneLocation;
-    if (ZoneGraphSubsystem->GetLaneLocation(Nav.CurrentLane, Nav.LanePosition, LaneLocation))
+    // Group by lane, then by distance so each lane's points are walked forward once
+    Algo::Sort(Requests, [](const FLaneSampleRequest& A, const FLaneSampleRequest& B)
     {
-        FTransform NewTransform = Transform.GetTransform();
-        NewTransform.SetLocation(LaneLocation.Position);
-        NewTransform.SetRotation(LaneLocation.Direction.ToOrientationQuat());
-        Transform.SetTransform(NewTransform);
+        if (A.Lane.DataHandle.Index != B.Lane.DataHandle.Index)
+        {
+            return A.Lane.DataHandle.Index < B.Lane.DataHandle.Index;
+        }
+        if (A.Lane.Index != B.Lane.Index)
+        {
+            return A.Lane.Index < B.Lane.Index;
+        }
+        return A.Distance < B.Distance;
+    });
+
+    int32 GroupStart = 0;
+    while (GroupStart < Requests.Num())
+    {
+        const FZoneGraphLaneHandle Lane = Requests[GroupStart].Lane;
+        int32 GroupEnd = GroupStart + 1;
+        while (GroupEnd < Requests.Num() && Requests[GroupEnd].Lane == Lane)
+        {
+            ++GroupEnd;
+        }
+
+        // Fetch the lane's point range once for the whole group
+        const FZoneGraphStorage* Storage = ZoneGraphSubsystem->GetZoneGraphStorage(Lane.DataHandle);
+        if (Storage && Storage->Lanes.IsValidIndex(Lane.Index))
+        {
+            const FZoneGraphLaneData& LaneData = Storage->Lanes[Lane.Index];
+            const int32 FirstPoint = LaneData.PointsBegin;
+            const int32 LastPoint = LaneData.PointsEnd - 1;
+
+            if (LastPoint > FirstPoint)
+            {
+                const float LaneLength = Storage->LanePointProgressions[LastPoint];
+                int32 Segment = FirstPoint;
+
+                for (int32 RequestIndex = GroupStart; RequestIndex < GroupEnd; ++RequestIndex)
+                {
+                    const FLaneSampleRequest& Request = Requests[RequestIndex];
+                    const float Distance = FMath::Clamp(Request.Distance, 0.0f, LaneLength);
+
+                    // Distances are ascending, so the segment cursor only moves forward.
+                    // A distance on an interior point starts the next segment, as in GetLaneLocation.
+                    while (Segment < LastPoint - 1 && Storage->LanePointProgressions[Segment + 1] <= Distance)
+                    {
+                        ++Segment;
+                    }
+
+                    const float SegmentStart = Storage->LanePointProgressions[Segment];
+                    const float SegmentLength = Storage->LanePointProgressions[Segment + 1] - SegmentStart;
+                    const float Alpha = SegmentLength > KINDA_SMALL_NUMBER ? (Distance - SegmentStart) / SegmentLength : 0.0f;
+
+                    const FVector Position = FMath::Lerp(Storage->LanePoints[Segment], Storage->LanePoints[Segment + 1], Alpha);
+                    // Face along the segment, matching FZoneGraphLaneLocation::Direction
+                    const FVector Direction = (Storage->LanePoints[Segment + 1] - Storage->LanePoints[Segment]).GetSafeNormal();
+
+                    FDataFragment_Transform& Transform = Transforms[Request.EntityIndex];
+                    FTransform NewTransform = Transform.GetTransform();
+                    NewTransform.SetLocation(Position);
+                    if (!Direction.IsNearlyZero())
+                    {
+                        NewTransform.SetRotation(Direction.ToOrientationQuat());
+                    }
+                    Transform.SetTransform(NewTransform);
+                }
+            }
+        }
+
+        GroupStart = GroupEnd;
     }
 }
 
+void UGSDNavigationProcessor::RefreshLaneCache(
+    FGSDNavigationFragment& Nav,
+    const UZoneGraphSubsystem* ZoneGraphSubsystem) const
+{
+    if (Nav.CachedLaneHandle == Nav.CurrentLane || !ZoneGraphSubsystem)
+    {
+        return;
+    }
+
+    // One lookup per lane change; the per-frame end check reads the cached values
+    Nav.CachedLaneHandle = Nav.CurrentLane;
+    Nav.CachedLaneLength = Nav.CurrentLane.IsValid() ? ZoneGraphSubsystem->GetLaneLength(Nav.CurrentLane) : 0.0f;
+
+    FZoneGraphLaneLocation EndLocation;
+    Nav.CachedLaneEndLocation = Nav.CurrentLane.IsValid() && ZoneGraphSubsystem->GetLaneLocation(Nav.CurrentLane, Nav.CachedLaneLength, EndLocation)
+        ? EndLocation.Position
+        : FVector::ZeroVector;
+}
+
 void UGSDNavigationProcessor::CheckLaneProgress(
     FGSDNavigationFragment& Nav,
     const UZoneGraphSubsystem* ZoneGraphSubsystem,
+    FGSDCounterRandom& Random,
     UGSDDeterminismManager* DeterminismManager) const
 {
     if (!Nav.CurrentLane.IsValid() || !ZoneGraphSubsystem)
@@ -190,59 +426,120 @@ void UGSDNavigationProcessor::CheckLaneProgress(
         return;
     }
 
-    // Get lane length
-    const FZoneGraphLaneHandle& Lane = Nav.CurrentLane;
-    const float LaneLength = ZoneGraphSubsystem->GetLaneLength(Lane);
-
-    if (Nav.LanePosition >= LaneLength)
+    // Cached lane length - no ZoneGraph lookup on the per-frame path
+    if (Nav.LanePosition >= Nav.CachedLaneLength)
     {
         Nav.bReachedDestination = true;
 
-        // Try to find a connected lane or pick a new random one
-        Nav.CurrentLane = PickRandomNearbyLane(
-            FVector::ZeroVector, // Will use entity's current location
+        // Pick a new random lane near where this one ended, joining it at the nearest point
+        const FZoneGraphLaneHandle NextLane = PickRandomNearbyLane(
+            Nav.CachedLaneEndLocation,
             ZoneGraphSubsystem,
+            Random,
             DeterminismManager
         );
 
-        if (Nav.CurrentLane.IsValid())
+        // The entity stands at the old lane's end plus its offset from it
+        if (NextLane.IsValid() && BindToLane(Nav, NextLane, Nav.CachedLaneEndLocation + Nav.LaneOffset, ZoneGraphSubsystem))
         {
-            Nav.LanePosition = 0.0f;
-            Nav.bReachedDestination = false;
+            RefreshLaneCache(Nav, ZoneGraphSubsystem);
         }
         else
         {
+            Nav.CurrentLane = FZoneGraphLaneHandle();
             Nav.bIsOnLane = false;
+            Nav.LaneOffset = FVector::ZeroVector;
         }
     }
 }
 
+bool UGSDNavigationProcessor::ExecuteFlowFieldMovement(
+    FGSDFlowFieldFragment& FlowField,
+    FDataFragment_Transform& Transform,
+    const FGSDZombieMovementFragment& Zombie,
+    const UGSDFlowFieldSubsystem& FlowFieldSubsystem,
+    float DeltaTime,
+    FGSDCounterRandom& Random,
+    UGSDDeterminismManager* DeterminismManager) const
+{
+    if (!Zombie.bIsAggressive || !Zombie.HasTarget())
+    {
+        FlowField.TargetID = INDEX_NONE;
+        FlowField.FieldIndex = INDEX_NONE;
+        return false;
+    }
+
+    // Re-resolve only when the target changed or the cached field was released/reassigned
+    const int32 TargetID = Zombie.Target.GetID();
+    if (FlowField.TargetID != TargetID
+        || !FlowFieldSubsystem.IsFieldValid(FlowField.FieldIndex, FlowField.FieldGeneration))
+    {
+        FlowField.TargetID = TargetID;
+        FlowField.FieldIndex = FlowFieldSubsystem.FindFieldForTarget(TargetID, FlowField.FieldGeneration);
+    }
+
+    if (FlowField.FieldIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    FTransform CurrentTransform = Transform.GetTransform();
+    FVector Location = CurrentTransform.GetLocation();
+
+    // Outside the field or no path on the grid: steer straight at the target
+    FVector Direction = FlowFieldSubsystem.SampleDirection(FlowField.FieldIndex, Location);
+    if (Direction.IsNearlyZero())
+    {
+        Direction = (FVector(Zombie.TargetLocation) - Location).GetSafeNormal2D();
+    }
+    FlowField.Direction = Direction;
+
+    const float RandomizedSpeed = ApplyVelocityRandomization(Zombie.MovementSpeed, VelocityRandomizationPercent, Random, DeterminismManager);
+    Location += Direction * RandomizedSpeed * DeltaTime;
+
+    CurrentTransform.SetLocation(Location);
+    if (!Direction.IsNearlyZero())
+    {
+        CurrentTransform.SetRotation(Direction.ToOrientationQuat());
+    }
+    Transform.SetTransform(CurrentTransform);
+
+    return true;
+}
+
+void UGSDNavigationProcessor::ApplySeparation(
+    const FGSDNavigationFragment& Nav,
+    FDataFragment_Transform& Transform,
+    float DeltaTime,
+    bool bApplySeparation) const
+{
+    if (bApplySeparation && !Nav.DesiredVelocity.IsZero())
+    {
+        FTransform CurrentTransform = Transform.GetTransform();
+        CurrentTransform.AddToTranslation(Nav.DesiredVelocity * DeltaTime);
+        Transform.SetTransform(CurrentTransform);
+    }
+}
+
 void UGSDNavigationProcessor::ExecuteFallbackMovement(
     FGSDNavigationFragment& Nav,
     FDataFragment_Transform& Transform,
-    const FGSDZombieStateFragment& Zombie,
+    const FGSDZombieMovementFragment& Zombie,
     float DeltaTime,
+    FGSDCounterRandom& Random,
     UGSDDeterminismManager* DeterminismManager) const
 {
     // Simple direct movement when ZoneGraph unavailable
     FTransform CurrentTransform = Transform.GetTransform();
     FVector Location = CurrentTransform.GetLocation();
 
-    // Move in a random direction if no target - use seeded random
+    // Move in a random direction if no target - use the entity's counter stream
     if (Nav.FallbackTargetLocation.IsNearlyZero())
     {
-        float RandomAngle = 0.0f;
+        const float RandomAngle = Random.FRand() * 2.0f * PI;
         if (DeterminismManager)
         {
-            FRandomStream& NavStream = DeterminismManager->GetCategoryStream(UGSDDeterminismManager::NavigationCategory);
-            RandomAngle = NavStream.FRand() * 2.0f * PI;
-            DeterminismManager->RecordRandomCall(UGSDDeterminismManager::NavigationCategory, RandomAngle);
-        }
-        else
-        {
-            // Fallback to seeded random for determinism
-            static FRandomStream FallbackAngleStream(22222);
-            RandomAngle = FallbackAngleStream.FRand() * 2.0f * PI;
+            DeterminismManager->RecordRandomCall(UGSDDeterminismManager::NavigationCategory, RandomAngle, Random.GetEntityKey());
         }
 
         Nav.FallbackTargetLocation = Location + FVector(
@@ -254,7 +551,7 @@ void UGSDNavigationProcessor::ExecuteFallbackMovement(
 
     // Move toward target with randomized velocity (CROWD-08)
     const FVector Direction = (Nav.FallbackTargetLocation - Location).GetSafeNormal();
-    const float RandomizedSpeed = ApplyVelocityRandomization(Zombie.MovementSpeed, VelocityRandomizationPercent, DeterminismManager);
+    const float RandomizedSpeed = ApplyVelocityRandomization(Zombie.MovementSpeed, VelocityRandomizationPercent, Random, DeterminismManager);
     const float EffectiveSpeed = RandomizedSpeed * FallbackMoveSpeed / 100.0f;
     Location += Direction * EffectiveSpeed * DeltaTime;
 
@@ -276,6 +573,7 @@ void UGSDNavigationProcessor::ExecuteFallbackMovement(
 FZoneGraphLaneHandle UGSDNavigationProcessor::PickRandomNearbyLane(
     const FVector& Location,
     const UZoneGraphSubsystem* ZoneGraphSubsystem,
+    FGSDCounterRandom& Random,
     UGSDDeterminismManager* DeterminismManager) const
 {
     if (!ZoneGraphSubsystem)
@@ -283,30 +581,80 @@ FZoneGraphLaneHandle UGSDNavigationProcessor::PickRandomNearbyLane(
         return FZoneGraphLaneHandle();
     }
 
-    TArray<FZoneGraphLaneHandle> NearbyLanes;
-    ZoneGraphSubsystem->FindLanesInBounds(
-        FBoxCenterAndExtent(Location, FVector(LaneSearchRadius)),
-        NearbyLanes
-    );
+    // Candidates within the search radius of this entity (the cell list also covers the rest of the cell)
+    const FBox SearchBox = FBox::BuildAABB(Location, FVector(LaneSearchRadius));
+    auto PickFromCandidates = [&Random, DeterminismManager, &SearchBox](const TArray<FLaneCandidate>& Candidates)
+    {
+        TArray<FZoneGraphLaneHandle, TInlineAllocator<32>> NearbyLanes;
+        for (const FLaneCandidate& Candidate : Candidates)
+        {
+            if (Candidate.Bounds.Intersect(SearchBox))
+            {
+                NearbyLanes.Add(Candidate.Lane);
+            }
+        }
+
+        if (NearbyLanes.IsEmpty())
+        {
+            return FZoneGraphLaneHandle();
+        }
+
+        // Pick with the entity's counter stream for determinism
+        const int32 LaneIndex = Random.RandHelper(NearbyLanes.Num());
+        if (DeterminismManager)
+        {
+            DeterminismManager->RecordRandomCall(UGSDDeterminismManager::NavigationCategory, static_cast<float>(LaneIndex), Random.GetEntityKey());
+        }
+
+        return NearbyLanes[LaneIndex];
+    };
+
+    FVector CellCenter;
+    const int64 CellKey = GetLaneCandidateCellKey(Location, CellCenter);
 
-    if (NearbyLanes.IsEmpty())
     {
-        return FZoneGraphLaneHandle();
+        FReadScopeLock ReadLock(LaneCandidateLock);
+        if (const TArray<FLaneCandidate>* Candidates = LaneCandidateCells.Find(CellKey))
+        {
+            return PickFromCandidates(*Candidates);
+        }
     }
 
-    // Use seeded random for determinism
-    int32 LaneIndex = 0;
-    if (DeterminismManager)
+    // Miss: query lanes around the cell. Half a cell plus the search radius reaches every
+    // lane within LaneSearchRadius of any entity in the cell
+    TArray<FZoneGraphLaneHandle> CellLanes;
+    ZoneGraphSubsystem->FindLanesInBounds(
+        FBoxCenterAndExtent(CellCenter, FVector(LaneSearchRadius * 1.5f)),
+        CellLanes
+    );
+
+    TArray<FLaneCandidate> NewCandidates;
+    NewCandidates.Reserve(CellLanes.Num());
+    for (const FZoneGraphLaneHandle& Lane : CellLanes)
     {
-        FRandomStream& NavStream = DeterminismManager->GetCategoryStream(UGSDDeterminismManager::NavigationCategory);
-        LaneIndex = NavStream.RandHelper(NearbyLanes.Num());
-        DeterminismManager->RecordRandomCall(UGSDDeterminismManager::NavigationCategory, static_cast<float>(LaneIndex));
+        const FZoneGraphStorage* Storage = ZoneGraphSubsystem->GetZoneGraphStorage(Lane.DataHandle);
+        if (!Storage || !Storage->Lanes.IsValidIndex(Lane.Index))
+        {
+            continue;
+        }
+
+        FLaneCandidate& Candidate = NewCandidates.AddDefaulted_GetRef();
+        Candidate.Lane = Lane;
+
+        const FZoneGraphLaneData& LaneData = Storage->Lanes[Lane.Index];
+        for (int32 PointIndex = LaneData.PointsBegin; PointIndex < LaneData.PointsEnd; ++PointIndex)
+        {
+            Candidate.Bounds += Storage->LanePoints[PointIndex];
+        }
     }
-    else
+
+    FWriteScopeLock WriteLock(LaneCandidateLock);
+    if (LaneCandidateCells.Num() >= MaxLaneCandidateCells)
     {
-        static FRandomStream FallbackPickStream(33333);
-        LaneIndex = FallbackPickStream.RandHelper(NearbyLanes.Num());
+        LaneCandidateCells.Reset();
     }
 
-    return NearbyLanes[LaneIndex];
+    // Another chunk may have built the same cell meanwhile; contents are identical either way
+    const TArray<FLaneCandidate>& Candidates = LaneCandidateCells.FindOrAdd(CellKey, MoveTemp(NewCandidates));
+    return PickFromCandidates(Candidates);
 }
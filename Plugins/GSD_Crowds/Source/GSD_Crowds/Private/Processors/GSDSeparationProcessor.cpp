@@ -0,0 +1,194 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#include "Processors/GSDSeparationProcessor.h"
+#include "Processors/GSDNavigationProcessor.h"
+#include "Fragments/GSDNavigationFragment.h"
+#include "DataAssets/GSDCrowdConfig.h"
+#include "Spatial/GSDSpatialHash.h"
+#include "MassCommonFragments.h"
+
+namespace GSDSeparation
+{
+    // Below this squared distance two entities count as coincident
+    static constexpr float CoincidentDistanceSq = 1.0e-4f;
+
+    /**
+     * Deterministic unit direction to push Self away from a coincident Other.
+     * Antisymmetric: the pair is always pushed in opposite directions.
+     */
+    FVector GetCoincidentPushDirection(const FMassEntityHandle& Self, const FMassEntityHandle& Other)
+    {
+        const int32 Low = FMath::Min(Self.Index, Other.Index);
+        const int32 High = FMath::Max(Self.Index, Other.Index);
+        const uint32 PairHash = HashCombine(GetTypeHash(Low), GetTypeHash(High));
+        const float Angle = static_cast<float>(PairHash & 0xFFFF) * (2.0f * PI / 65536.0f);
+        const float Sign = Self.Index < Other.Index ? 1.0f : -1.0f;
+        return FVector(FMath::Cos(Angle) * Sign, FMath::Sin(Angle) * Sign, 0.0f);
+    }
+}
+
+UGSDSeparationProcessor::UGSDSeparationProcessor()
+{
+    // Runs after navigation has moved entities this frame; the result is applied
+    // by the navigation processor on the next frame
+    ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Movement;
+    ExecutionOrder.ExecuteAfter.Add(UGSDNavigationProcessor::StaticClass());
+    ProcessingPhase = EMassProcessingPhase::PrePhysics;
+}
+
+void UGSDSeparationProcessor::ConfigureQueries()
+{
+    EntityQuery.AddRequirement<FGSDNavigationFragment>(EMassFragmentAccess::ReadWrite);
+    EntityQuery.AddRequirement<FDataFragment_Transform>(EMassFragmentAccess::ReadOnly);
+}
+
+void UGSDSeparationProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+    // Load config (cached for frame)
+    if (!CachedConfig)
+    {
+        CachedConfig = UGSDCrowdConfig::GetDefaultConfig();
+    }
+
+    if (CachedConfig && !CachedConfig->bEnableSeparation)
+    {
+        return;
+    }
+
+    const float Radius = CachedConfig ? CachedConfig->SeparationRadius : DefaultSeparationRadius;
+    const float Strength = CachedConfig ? CachedConfig->SeparationStrength : DefaultSeparationStrength;
+    const int32 MaxNeighbors = FMath::Clamp(CachedConfig ? CachedConfig->MaxSeparationNeighbors : DefaultMaxSeparationNeighbors, 1, MaxNeighborsLimit);
+    const bool bParallel = CachedConfig && CachedConfig->bParallelSeparation;
+
+    //-- Neighbor Lookup --
+    if (!SeparationHash)
+    {
+        SeparationHash = NewObject<UGSDSpatialHash>(this);
+    }
+
+    // One cell per radius keeps each gather to a 3x3 cell block
+    if (SeparationHash->GetConfig().CellSize != Radius)
+    {
+        FGSDSpatialHashConfig HashConfig;
+        HashConfig.CellSize = Radius;
+        HashConfig.MaxCellSearchRadius = 1;
+        SeparationHash->Initialize(HashConfig);
+    }
+
+    SeparationHash->RebuildFromQuery(EntityManager, EntityQuery);
+    const UGSDSpatialHash* Hash = SeparationHash.Get();
+
+    // Hash queries are const and each entity only writes its own fragment,
+    // so chunks may run in parallel
+    auto ProcessChunk = [Hash, Radius, Strength, MaxNeighbors](FMassExecutionContext& Context)
+    {
+        auto NavFragments = Context.GetMutableFragmentView<FGSDNavigationFragment>();
+        const auto Transforms = Context.GetFragmentView<FDataFragment_Transform>();
+
+        // Neighbor scratch, SoA for the kernel (+1: self may use a visit)
+        TArray<float, TInlineAllocator<MaxNeighborsLimit + 1>> NeighborX;
+        TArray<float, TInlineAllocator<MaxNeighborsLimit + 1>> NeighborY;
+
+        for (int32 i = 0; i < Context.GetNumEntities(); ++i)
+        {
+            const FMassEntityHandle Self = Context.GetEntity(i);
+            const FVector Location = Transforms[i].GetTransform().GetLocation();
+
+            NeighborX.Reset();
+            NeighborY.Reset();
+
+            Hash->ForEachEntityInRadiusBounded(Location, Radius, MaxNeighbors + 1,
+                [&Self, &Location, &NeighborX, &NeighborY](const FMassEntityHandle& Entity, const FVector& Position, float DistanceSq)
+                {
+                    if (Entity == Self)
+                    {
+                        return;
+                    }
+
+                    // Split exact overlaps (e.g. shared spawn point) deterministically
+                    FVector NeighborPosition = Position;
+                    if (DistanceSq <= GSDSeparation::CoincidentDistanceSq)
+                    {
+                        NeighborPosition = Location - GSDSeparation::GetCoincidentPushDirection(Self, Entity);
+                    }
+
+                    NeighborX.Add(static_cast<float>(NeighborPosition.X));
+                    NeighborY.Add(static_cast<float>(NeighborPosition.Y));
+                });
+
+            const FVector Push = ComputeSeparation(Location, NeighborX, NeighborY, Radius);
+            NavFragments[i].DesiredVelocity = (Push * Strength).GetClampedToMaxSize2D(Strength);
+        }
+    };
+
+    if (bParallel)
+    {
+        EntityQuery.ParallelForEachEntityChunk(EntityManager, Context, ProcessChunk);
+    }
+    else
+    {
+        EntityQuery.ForEachEntityChunk(EntityManager, Context, ProcessChunk);
+    }
+}
+
+FVector UGSDSeparationProcessor::ComputeSeparation(const FVector& Location, TConstArrayView<float> NeighborX, TConstArrayView<float> NeighborY, float Radius)
+{
+    check(NeighborX.Num() == NeighborY.Num());
+
+    const int32 Num = NeighborX.Num();
+    const int32 NumSimd = Num & ~3;
+    const float SelfX = static_cast<float>(Location.X);
+    const float SelfY = static_cast<float>(Location.Y);
+    const float RadiusSq = Radius * Radius;
+    const float InvRadius = 1.0f / Radius;
+
+    // Push = Delta * (1 / Dist - 1 / Radius), i.e. away from the neighbor with magnitude 1 - Dist / Radius
+    const VectorRegister4Float SelfXReg = VectorSetFloat1(SelfX);
+    const VectorRegister4Float SelfYReg = VectorSetFloat1(SelfY);
+    const VectorRegister4Float RadiusSqReg = VectorSetFloat1(RadiusSq);
+    const VectorRegister4Float InvRadiusReg = VectorSetFloat1(InvRadius);
+    const VectorRegister4Float CoincidentReg = VectorSetFloat1(GSDSeparation::CoincidentDistanceSq);
+    const VectorRegister4Float Zero = VectorZeroFloat();
+
+    VectorRegister4Float SumX = Zero;
+    VectorRegister4Float SumY = Zero;
+
+    // 4 neighbors per iteration
+    for (int32 i = 0; i < NumSimd; i += 4)
+    {
+        const VectorRegister4Float DX = VectorSubtract(SelfXReg, VectorLoad(&NeighborX[i]));
+        const VectorRegister4Float DY = VectorSubtract(SelfYReg, VectorLoad(&NeighborY[i]));
+        const VectorRegister4Float DistSq = VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX));
+
+        // In range and not coincident (avoids 1/0 in the masked-out lanes' weights)
+        const VectorRegister4Float InRange = VectorBitwiseAnd(VectorCompareLT(DistSq, RadiusSqReg), VectorCompareGT(DistSq, CoincidentReg));
+        const VectorRegister4Float Weight = VectorSubtract(VectorReciprocalSqrtAccurate(VectorMax(DistSq, CoincidentReg)), InvRadiusReg);
+        const VectorRegister4Float MaskedWeight = VectorSelect(InRange, Weight, Zero);
+
+        SumX = VectorMultiplyAdd(DX, MaskedWeight, SumX);
+        SumY = VectorMultiplyAdd(DY, MaskedWeight, SumY);
+    }
+
+    alignas(16) float LanesX[4];
+    alignas(16) float LanesY[4];
+    VectorStoreAligned(SumX, LanesX);
+    VectorStoreAligned(SumY, LanesY);
+    float PushX = LanesX[0] + LanesX[1] + LanesX[2] + LanesX[3];
+    float PushY = LanesY[0] + LanesY[1] + LanesY[2] + LanesY[3];
+
+    // Scalar tail
+    for (int32 i = NumSimd; i < Num; ++i)
+    {
+        const float DX = SelfX - NeighborX[i];
+        const float DY = SelfY - NeighborY[i];
+        const float DistSq = DX * DX + DY * DY;
+        if (DistSq < RadiusSq && DistSq > GSDSeparation::CoincidentDistanceSq)
+        {
+            const float Weight = FMath::InvSqrt(DistSq) - InvRadius;
+            PushX += DX * Weight;
+            PushY += DY * Weight;
+        }
+    }
+
+    return FVector(PushX, PushY, 0.0f);
+}
@@ -5,6 +5,8 @@
 #include "Fragments/GSDNavigationFragment.h"
 #include "MassEntity/DataFragmentTypes.h"
 #include "Subsystems/GSDSmartObjectSubsystem.h"
+#include "DataAssets/GSDCrowdConfig.h"
+#include "MassEntityManager.h"
 
 UGSDSmartObjectProcessor::UGSDSmartObjectProcessor()
 {
@@ -37,8 +39,20 @@ void UGSDSmartObjectProcessor::Execute(FMassEntityManager& EntityManager, FMassE
         return;
     }
 
+    // Load config (cached for frame)
+    if (!CachedConfig)
+    {
+        CachedConfig = UGSDCrowdConfig::GetDefaultConfig();
+    }
+
     const float DeltaTime = Context.GetDeltaTimeSeconds();
 
+    if (CachedConfig && CachedConfig->bParallelSmartObjects)
+    {
+        ExecuteParallel(EntityManager, Context, SOSubsystem, DeltaTime);
+        return;
+    }
+
     EntityQuery.ForEachEntityChunk(EntityManager, Context,
         [this, SOSubsystem, DeltaTime](FMassExecutionContext& Context)
         {
@@ -66,13 +80,7 @@ void UGSDSmartObjectProcessor::Execute(FMassEntityManager& EntityManager, FMassE
                 }
                 else if (SO.HasValidClaim())
                 {
-                    // Has claim but not interacting - start interaction
-                    SO.bIsInteracting = true;
-                    SO.InteractionTime = 0.0f;
-                    SO.InteractionDuration = DefaultInteractionDuration;
-
-                    // Pause navigation during interaction
-                    Nav.DesiredSpeed = 0.0f;
+                    StartInteraction(SO, Nav);
                 }
                 else
                 {
@@ -89,6 +97,115 @@ void UGSDSmartObjectProcessor::Execute(FMassEntityManager& EntityManager, FMassE
         });
 }
 
+void UGSDSmartObjectProcessor::ExecuteParallel(
+    FMassEntityManager& EntityManager,
+    FMassExecutionContext& Context,
+    UGSDSmartObjectSubsystem* SOSubsystem,
+    float DeltaTime)
+{
+    // Smart Object subsystem calls are not thread-safe. Chunks run fragment-only
+    // state updates in parallel and queue entities that need the subsystem.
+    TArray<FGSDDeferredSmartObjectOp> DeferredOps;
+    FCriticalSection DeferredOpsLock;
+
+    EntityQuery.ParallelForEachEntityChunk(EntityManager, Context,
+        [this, DeltaTime, &DeferredOps, &DeferredOpsLock](FMassExecutionContext& Context)
+        {
+            auto SOFragments = Context.GetMutableFragmentView<FGSDSmartObjectFragment>();
+            auto NavFragments = Context.GetMutableFragmentView<FGSDNavigationFragment>();
+
+            TArray<FGSDDeferredSmartObjectOp, TInlineAllocator<32>> ChunkOps;
+
+            for (int32 i = 0; i < Context.GetNumEntities(); ++i)
+            {
+                FGSDSmartObjectFragment& SO = SOFragments[i];
+                FGSDNavigationFragment& Nav = NavFragments[i];
+
+                if (SO.bIsInteracting)
+                {
+                    ProcessInteraction(SO, Nav, DeltaTime);
+
+                    if (SO.bInteractionComplete)
+                    {
+                        ChunkOps.Add({ Context.GetEntity(i), EGSDDeferredSmartObjectOp::Release });
+                    }
+                }
+                else if (SO.HasValidClaim())
+                {
+                    StartInteraction(SO, Nav);
+                }
+                else if (SO.TimeSinceLastSearch + DeltaTime >= SO.SearchCooldown
+                    || SO.ClaimedHandle.SmartObjectHandle.IsValid())
+                {
+                    // Search and/or claim needs the subsystem - run on the game thread
+                    ChunkOps.Add({ Context.GetEntity(i), EGSDDeferredSmartObjectOp::SearchAndClaim });
+                }
+                else
+                {
+                    // Still on cooldown with no candidate - same as SearchForSmartObject early-out
+                    SO.TimeSinceLastSearch += DeltaTime;
+                }
+            }
+
+            if (ChunkOps.Num() > 0)
+            {
+                FScopeLock Lock(&DeferredOpsLock);
+                DeferredOps.Append(ChunkOps);
+            }
+        });
+
+    if (DeferredOps.IsEmpty())
+    {
+        return;
+    }
+
+    // Apply in entity order so claim contention resolves the same way regardless of thread timing
+    DeferredOps.Sort([](const FGSDDeferredSmartObjectOp& A, const FGSDDeferredSmartObjectOp& B)
+    {
+        return A.Entity.Index < B.Entity.Index;
+    });
+
+    for (const FGSDDeferredSmartObjectOp& Op : DeferredOps)
+    {
+        FGSDSmartObjectFragment* SO = EntityManager.GetFragmentDataPtr<FGSDSmartObjectFragment>(Op.Entity);
+        if (!SO)
+        {
+            continue;
+        }
+
+        if (Op.Type == EGSDDeferredSmartObjectOp::Release)
+        {
+            ReleaseSmartObject(*SO, SOSubsystem);
+            continue;
+        }
+
+        const FDataFragment_Transform* Transform = EntityManager.GetFragmentDataPtr<FDataFragment_Transform>(Op.Entity);
+        if (!Transform)
+        {
+            continue;
+        }
+
+        SearchForSmartObject(*SO, *Transform, SOSubsystem, DeltaTime);
+        if (!SO->HasValidClaim())
+        {
+            TryClaimSmartObject(*SO, *Transform, SOSubsystem);
+        }
+    }
+}
+
+void UGSDSmartObjectProcessor::StartInteraction(
+    FGSDSmartObjectFragment& SOFragment,
+    FGSDNavigationFragment& NavFragment) const
+{
+    // Has claim but not interacting - start interaction
+    SOFragment.bIsInteracting = true;
+    SOFragment.InteractionTime = 0.0f;
+    SOFragment.InteractionDuration = DefaultInteractionDuration;
+
+    // Pause navigation during interaction
+    NavFragment.DesiredSpeed = 0.0f;
+}
+
 void UGSDSmartObjectProcessor::SearchForSmartObject(
     FGSDSmartObjectFragment& SOFragment,
     const FDataFragment_Transform& Transform,
@@ -2,12 +2,16 @@
 
 #include "Processors/GSDZombieBehaviorProcessor.h"
 #include "Processors/GSDNavigationProcessor.h"
-#include "Fragments/GSDZombieStateFragment.h"
+#include "Fragments/GSDZombieMovementFragment.h"
 #include "DataAssets/GSDCrowdConfig.h"
+#include "Spatial/GSDSpatialHash.h"
+#include "Subsystems/GSDFlowFieldSubsystem.h"
 #include "MassCommonFragments.h"
 #include "GSDCrowdLog.h"
 #include "Managers/GSDDeterminismManager.h"
 #include "Kismet/GameplayStatics.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
 
 // NOTE: This processor will be renamed to UGSDMassBehaviorProcessor in a future phase (GSDCROWDS-105)
 // The behavior logic is game-agnostic and suitable for any crowd/flock simulation.
@@ -26,8 +30,19 @@ UGSDZombieBehaviorProcessor::UGSDZombieBehaviorProcessor()
 void UGSDZombieBehaviorProcessor::ConfigureQueries()
 {
     // CRITICAL: Specify correct access flags
-    EntityQuery.AddRequirement<FGSDZombieStateFragment>(EMassFragmentAccess::ReadWrite);
-    EntityQuery.AddRequirement<FDataFragment_Transform>(EMassFragmentAccess::ReadOnly);
+    // Bucket queries partition entities by archetype so buckets not due are skipped wholesale
+    for (int32 Bucket = 0; Bucket < GSDBehaviorLOD::NumBuckets; Bucket++)
+    {
+        BucketQueries[Bucket].AddRequirement<FGSDZombieMovementFragment>(EMassFragmentAccess::ReadWrite);
+        BucketQueries[Bucket].AddRequirement<FDataFragment_Transform>(EMassFragmentAccess::ReadOnly);
+    }
+
+    BucketQueries[0].AddTagRequirement<FGSDBehaviorLODBucket1Tag>(EMassFragmentPresence::None);
+    BucketQueries[0].AddTagRequirement<FGSDBehaviorLODBucket2Tag>(EMassFragmentPresence::None);
+    BucketQueries[0].AddTagRequirement<FGSDBehaviorLODBucket3Tag>(EMassFragmentPresence::None);
+    BucketQueries[1].AddTagRequirement<FGSDBehaviorLODBucket1Tag>(EMassFragmentPresence::All);
+    BucketQueries[2].AddTagRequirement<FGSDBehaviorLODBucket2Tag>(EMassFragmentPresence::All);
+    BucketQueries[3].AddTagRequirement<FGSDBehaviorLODBucket3Tag>(EMassFragmentPresence::All);
 }
 
 void UGSDZombieBehaviorProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
@@ -63,6 +78,7 @@ void UGSDZombieBehaviorProcessor::Execute(FMassEntityManager& EntityManager, FMa
     const float AttackCooldown = CachedConfig ? CachedConfig->AttackCooldown : DefaultAttackCooldown;
     const float LoseTargetDistance = CachedConfig ? CachedConfig->LoseTargetDistance : DefaultLoseTargetDistance;
     const float BaseMoveSpeed = CachedConfig ? CachedConfig->BaseMoveSpeed : 150.0f;
+    const int32 MaxTargetSearchesPerFrame = CachedConfig ? CachedConfig->MaxTargetSearchesPerFrame : DefaultMaxTargetSearchesPerFrame;
 
     // Get DeterminismManager for seeded random (if available)
     UGSDDeterminismManager* DeterminismManager = nullptr;
@@ -74,21 +90,100 @@ void UGSDZombieBehaviorProcessor::Execute(FMassEntityManager& EntityManager, FMa
         }
     }
 
-    EntityQuery.ForEachEntityChunk(EntityManager, Context,
+    // Per-entity counter streams: values depend only on (seed, category, entity, frame),
+    // never on chunk iteration order
+    const uint64 SpeedStreamKey = DeterminismManager
+        ? DeterminismManager->GetCounterStreamKey(UGSDDeterminismManager::ZombieSpeedCategory)
+        : FGSDCounterRandom::MakeStreamKey(FallbackSpeedSeed, UGSDDeterminismManager::ZombieSpeedCategory);
+    const uint64 WanderStreamKey = DeterminismManager
+        ? DeterminismManager->GetCounterStreamKey(UGSDDeterminismManager::ZombieWanderCategory)
+        : FGSDCounterRandom::MakeStreamKey(FallbackWanderSeed, UGSDDeterminismManager::ZombieWanderCategory);
+    const uint32 RandomFrame = DeterminismManager
+        ? DeterminismManager->GetCounterFrame()
+        : static_cast<uint32>(GFrameCounter);
+
+    const bool bParallel = CachedConfig && CachedConfig->bParallelBehavior;
+    const bool bEnableFlowField = bEnablePursuitBehavior && CachedConfig && CachedConfig->bEnableFlowFieldPursuit;
+
+    //-- Due Buckets --
+    const float FrameDeltaTime = Context.GetDeltaTimeSeconds();
+    BucketFrameCounter++;
+    BehaviorClock = FMath::Fmod(BehaviorClock + FrameDeltaTime, BehaviorClockWrapSeconds);
+    const float Clock = BehaviorClock;
+
+    uint32 DueBucketMask = 0;
+    for (int32 Bucket = 0; Bucket < GSDBehaviorLOD::NumBuckets; Bucket++)
+    {
+        // Offset by bucket index so LOD2/LOD3 do not land on the same frame
+        const uint32 Interval = static_cast<uint32>(GetBucketFrameInterval(Bucket));
+        if ((BucketFrameCounter + Bucket) % Interval == 0)
+        {
+            DueBucketMask |= 1u << Bucket;
+        }
+    }
+
+    //-- Target Acquisition Setup --
+    // Players are refreshed every frame (pursuers track them); the candidate hash is
+    // only rebuilt when at least one aggressive entity is granted a search
+    bool bCanSearchTargets = false;
+    if (bEnablePursuitBehavior)
+    {
+        GatherPlayerTargets(Context.GetWorld());
+
+        const int32 NumSearchesGranted = GatherTargetCandidates(EntityManager, Context, DueBucketMask,
+            BehaviorUpdateInterval, FrameDeltaTime, MaxTargetSearchesPerFrame, bEnableFlowField);
+        if (bEnableFlowField)
+        {
+            MergePursuitDemands();
+        }
+
+        if (NumSearchesGranted > 0)
+        {
+            MergeTargetCandidates(EntityManager);
+
+            if (!TargetHash)
+            {
+                TargetHash = NewObject<UGSDSpatialHash>(this);
+            }
+
+            // One cell per detection range keeps each search to a 3x3 cell block
+            const float TargetCellSize = FMath::Max(DetectionRange, 100.0f);
+            if (TargetHash->GetConfig().CellSize != TargetCellSize)
+            {
+                FGSDSpatialHashConfig HashConfig;
+                HashConfig.CellSize = TargetCellSize;
+                TargetHash->Initialize(HashConfig);
+            }
+
+            TargetHash->RebuildFromEntities(TargetCandidateEntities, TargetCandidatePositions);
+            bCanSearchTargets = true;
+        }
+    }
+
+    const UGSDSpatialHash* SearchHash = bCanSearchTargets ? TargetHash.Get() : nullptr;
+
+    // Each entity only writes its own state fragment; random draws come from
+    // per-entity counter streams, so chunks may run in parallel
+    auto ProcessChunk =
         [this, BehaviorUpdateInterval, SpeedVariation, WanderDirectionChange, SpeedInterpolationRate,
          bEnablePursuitBehavior, DetectionRange, PursuitSpeedMultiplier, AttackRange, AttackCooldown,
-         LoseTargetDistance, BaseMoveSpeed, DeterminismManager](FMassExecutionContext& Context)
+         LoseTargetDistance, BaseMoveSpeed, DeterminismManager,
+         SpeedStreamKey, WanderStreamKey, RandomFrame,
+         &EntityManager, SearchHash, Clock, FrameDeltaTime](FMassExecutionContext& Context)
         {
             const int32 NumEntities = Context.GetNumEntities();
-            auto EntityStates = Context.GetMutableFragmentView<FGSDZombieStateFragment>();
+            auto EntityStates = Context.GetMutableFragmentView<FGSDZombieMovementFragment>();
             auto Transforms = Context.GetFragmentView<FDataFragment_Transform>();
-            const float DeltaTime = Context.GetDeltaTimeSeconds();
 
             for (int32 i = 0; i < NumEntities; ++i)
             {
-                FGSDZombieStateFragment& State = EntityStates[i];
+                FGSDZombieMovementFragment& State = EntityStates[i];
                 const FDataFragment_Transform& Transform = Transforms[i];
 
+                // Time since this entity's own last update, whichever bucket it was in
+                const float DeltaTime = GetElapsedBehaviorTime(State.LastBehaviorTime, Clock, FrameDeltaTime);
+                State.LastBehaviorTime = Clock;
+
                 if (!State.bIsAlive || !State.bIsActive)
                 {
                     continue;
@@ -98,22 +193,33 @@ void UGSDZombieBehaviorProcessor::Execute(FMassEntityManager& EntityManager, FMa
                 State.TimeSinceLastBehaviorUpdate += DeltaTime;
                 State.TimeSinceLastAttack += DeltaTime;
 
+                bool bSearchDeferred = false;
+
                 //-- Pursuit/Attack Behavior --
                 if (bEnablePursuitBehavior && State.bIsAggressive)
                 {
                     const FVector CurrentLocation = Transform.GetTransform().GetLocation();
 
+                    // Refresh tracked target location (drop targets that no longer exist)
+                    if (State.HasTarget())
+                    {
+                        if (!RefreshTargetLocation(EntityManager, State))
+                        {
+                            State.ClearTarget();
+                            State.TargetMovementSpeed = BaseMoveSpeed;
+                        }
+                    }
+
                     // Check if we have a valid target
-                    if (State.TargetEntityID != INDEX_NONE)
+                    if (State.HasTarget())
                     {
-                        const float DistToTargetSq = FVector::DistSquared(CurrentLocation, State.TargetLocation);
+                        const float DistToTargetSq = FVector::DistSquared(CurrentLocation, FVector(State.TargetLocation));
 
                         // Check if target is lost (too far away)
                         if (DistToTargetSq > LoseTargetDistance * LoseTargetDistance)
                         {
                             // Lost target - return to wandering
-                            State.TargetEntityID = INDEX_NONE;
-                            State.TargetLocation = FVector::ZeroVector;
+                            State.ClearTarget();
                             State.TargetMovementSpeed = BaseMoveSpeed;
                         }
                         // Check if in attack range
@@ -137,52 +243,51 @@ void UGSDZombieBehaviorProcessor::Execute(FMassEntityManager& EntityManager, FMa
                             State.TargetMovementSpeed = BaseMoveSpeed * PursuitSpeedMultiplier;
                         }
                     }
-                    // No target - try to find one
-                    else
+                    // No target - try to find one (time-sliced on the behavior interval,
+                    // budget granted deterministically by the gather)
+                    else if (State.bTargetSearchGranted)
+                    {
+                        if (SearchHash && AcquireTarget(*SearchHash, CurrentLocation, DetectionRange, State))
+                        {
+                            State.TimeSinceLastBehaviorUpdate = 0.0f;
+                            State.TargetMovementSpeed = BaseMoveSpeed * PursuitSpeedMultiplier;
+                        }
+                    }
+                    else if (State.TimeSinceLastBehaviorUpdate >= BehaviorUpdateInterval)
                     {
-                        // TODO: Target acquisition via spatial query (GSDCROWDS-202)
-                        // For now, this is a placeholder - targets are set via events
+                        // Over budget - keep the timer elapsed so this entity searches next frame
+                        bSearchDeferred = true;
                     }
+
+                    State.bTargetSearchGranted = false;
                 }
 
                 //-- Wandering Behavior (when not pursuing) --
-                if (State.TargetEntityID == INDEX_NONE)
+                if (!State.HasTarget() && !bSearchDeferred)
                 {
                     if (State.TimeSinceLastBehaviorUpdate >= BehaviorUpdateInterval)
                     {
                         State.TimeSinceLastBehaviorUpdate = 0.0f;
 
+                        const FMassEntityHandle Entity = Context.GetEntity(i);
+                        const uint64 EntityKey = FGSDCounterRandom::MakeEntityKey(Entity.Index, Entity.SerialNumber);
+
                         // Apply speed variation (prevents synchronized movement)
-                        // Use seeded random from DeterminismManager for determinism
-                        float SpeedMultiplier = 1.0f;
+                        // Per-entity counter stream keeps results independent of chunk order
+                        FGSDCounterRandom SpeedRandom(SpeedStreamKey, EntityKey, RandomFrame);
+                        const float SpeedMultiplier = 1.0f + SpeedRandom.FRandRange(-SpeedVariation, SpeedVariation);
                         if (DeterminismManager)
                         {
-                            FRandomStream& SpeedStream = DeterminismManager->GetCategoryStream(UGSDDeterminismManager::ZombieSpeedCategory);
-                            SpeedMultiplier = 1.0f + SpeedStream.FRandRange(-SpeedVariation, SpeedVariation);
-                            DeterminismManager->RecordRandomCall(UGSDDeterminismManager::ZombieSpeedCategory, SpeedMultiplier);
-                        }
-                        else
-                        {
-                            // Fallback to seeded random for determinism even without manager
-                            static FRandomStream FallbackSpeedStream(12345);
-                            SpeedMultiplier = 1.0f + FallbackSpeedStream.FRandRange(-SpeedVariation, SpeedVariation);
+                            DeterminismManager->RecordRandomCall(UGSDDeterminismManager::ZombieSpeedCategory, SpeedMultiplier, EntityKey);
                         }
                         State.TargetMovementSpeed = State.MovementSpeed * SpeedMultiplier;
 
                         // Update wander direction
-                        // Use seeded random from DeterminismManager for determinism
-                        float DirectionChange = 0.0f;
+                        FGSDCounterRandom WanderRandom(WanderStreamKey, EntityKey, RandomFrame);
+                        const float DirectionChange = WanderRandom.FRandRange(-WanderDirectionChange, WanderDirectionChange);
                         if (DeterminismManager)
                         {
-                            FRandomStream& WanderStream = DeterminismManager->GetCategoryStream(UGSDDeterminismManager::ZombieWanderCategory);
-                            DirectionChange = WanderStream.FRandRange(-WanderDirectionChange, WanderDirectionChange);
-                            DeterminismManager->RecordRandomCall(UGSDDeterminismManager::ZombieWanderCategory, DirectionChange);
-                        }
-                        else
-                        {
-                            // Fallback to seeded random for determinism even without manager
-                            static FRandomStream FallbackWanderStream(54321);
-                            DirectionChange = FallbackWanderStream.FRandRange(-WanderDirectionChange, WanderDirectionChange);
+                            DeterminismManager->RecordRandomCall(UGSDDeterminismManager::ZombieWanderCategory, DirectionChange, EntityKey);
                         }
                         State.WanderDirection += DirectionChange;
                         State.WanderDirection = FMath::Clamp(State.WanderDirection, -180.0f, 180.0f);
@@ -193,5 +298,284 @@ void UGSDZombieBehaviorProcessor::Execute(FMassEntityManager& EntityManager, FMa
                 // Uses Config->SpeedInterpolationRate instead of hardcoded 2.0f
                 State.MovementSpeed = FMath::Lerp(State.MovementSpeed, State.TargetMovementSpeed, DeltaTime * SpeedInterpolationRate);
             }
+        };
+
+    //-- Run Due Buckets --
+    for (int32 Bucket = 0; Bucket < GSDBehaviorLOD::NumBuckets; Bucket++)
+    {
+        if ((DueBucketMask & (1u << Bucket)) == 0)
+        {
+            continue;
+        }
+
+        if (bParallel)
+        {
+            BucketQueries[Bucket].ParallelForEachEntityChunk(EntityManager, Context, ProcessChunk);
+        }
+        else
+        {
+            BucketQueries[Bucket].ForEachEntityChunk(EntityManager, Context, ProcessChunk);
+        }
+    }
+
+    //-- Flow Fields --
+    // Updated after the navigation processor has finished sampling this frame's fields
+    if (bEnableFlowField)
+    {
+        if (UWorld* World = Context.GetWorld())
+        {
+            if (UGSDFlowFieldSubsystem* FlowFieldSubsystem = World->GetSubsystem<UGSDFlowFieldSubsystem>())
+            {
+                FlowFieldSubsystem->UpdateFields(PursuitDemands, FrameDeltaTime);
+            }
+        }
+    }
+}
+
+int32 UGSDZombieBehaviorProcessor::GetBucketFrameInterval(int32 Bucket) const
+{
+    const bool bUseBuckets = CachedConfig ? CachedConfig->bEnableBehaviorLODBuckets : true;
+    if (!bUseBuckets)
+    {
+        return 1;
+    }
+
+    switch (Bucket)
+    {
+    case 1: return FMath::Max(1, CachedConfig ? CachedConfig->BehaviorLOD1FrameInterval : DefaultBehaviorLOD1FrameInterval);
+    case 2: return FMath::Max(1, CachedConfig ? CachedConfig->BehaviorLOD2FrameInterval : DefaultBehaviorLOD2FrameInterval);
+    case 3: return FMath::Max(1, CachedConfig ? CachedConfig->BehaviorLOD3FrameInterval : DefaultBehaviorLOD3FrameInterval);
+    default: return 1;
+    }
+}
+
+int32 UGSDZombieBehaviorProcessor::GatherTargetCandidates(FMassEntityManager& EntityManager, FMassExecutionContext& Context, uint32 DueBucketMask, float BehaviorUpdateInterval, float FrameDeltaTime, int32 MaxTargetSearches, bool bGatherPursuitDemand)
+{
+    // Serial, in bucket then chunk order: the searches granted are the same every run
+    int32 NumSearchesGranted = 0;
+    const float Clock = BehaviorClock;
+
+    for (int32 Bucket = 0; Bucket < GSDBehaviorLOD::NumBuckets; Bucket++)
+    {
+        // Buckets not due keep the cache from their last run
+        if ((DueBucketMask & (1u << Bucket)) == 0)
+        {
+            continue;
+        }
+
+        FBucketTargetCache& Cache = BucketTargetCaches[Bucket];
+        Cache.CandidateEntities.Reset();
+        Cache.CandidatePositions.Reset();
+        Cache.PursuitDemands.Reset();
+        PursuitDemandByTarget.Reset();
+
+        BucketQueries[Bucket].ForEachEntityChunk(EntityManager, Context,
+            [this, &Cache, &NumSearchesGranted, Clock, FrameDeltaTime, BehaviorUpdateInterval, MaxTargetSearches, bGatherPursuitDemand](FMassExecutionContext& ChunkContext)
+        {
+            const int32 NumEntities = ChunkContext.GetNumEntities();
+            auto EntityStates = ChunkContext.GetMutableFragmentView<FGSDZombieMovementFragment>();
+            const auto Transforms = ChunkContext.GetFragmentView<FDataFragment_Transform>();
+
+            for (int32 i = 0; i < NumEntities; ++i)
+            {
+                FGSDZombieMovementFragment& State = EntityStates[i];
+                State.bTargetSearchGranted = false;
+                if (!State.bIsAlive || !State.bIsActive)
+                {
+                    continue;
+                }
+
+                if (State.bIsAggressive)
+                {
+                    // Timer is advanced in the main pass with the same per-entity elapsed time
+                    if (!State.HasTarget()
+                        && State.TimeSinceLastBehaviorUpdate + GetElapsedBehaviorTime(State.LastBehaviorTime, Clock, FrameDeltaTime) >= BehaviorUpdateInterval)
+                    {
+                        if (NumSearchesGranted < MaxTargetSearches)
+                        {
+                            State.bTargetSearchGranted = true;
+                            NumSearchesGranted++;
+                        }
+                    }
+                    else if (bGatherPursuitDemand && State.HasTarget())
+                    {
+                        AddPursuitDemand(Cache.PursuitDemands, State);
+                    }
+                }
+                else
+                {
+                    Cache.CandidateEntities.Add(ChunkContext.GetEntity(i));
+                    Cache.CandidatePositions.Add(Transforms[i].GetTransform().GetLocation());
+                }
+            }
+        });
+    }
+
+    return NumSearchesGranted;
+}
+
+void UGSDZombieBehaviorProcessor::MergeTargetCandidates(const FMassEntityManager& EntityManager)
+{
+    TargetCandidateEntities.Reset();
+    TargetCandidatePositions.Reset();
+
+    // Candidates of buckets not due this frame are up to one bucket interval old;
+    // entities destroyed since are dropped here
+    for (const FBucketTargetCache& Cache : BucketTargetCaches)
+    {
+        for (int32 i = 0; i < Cache.CandidateEntities.Num(); ++i)
+        {
+            if (EntityManager.IsEntityValid(Cache.CandidateEntities[i]))
+            {
+                TargetCandidateEntities.Add(Cache.CandidateEntities[i]);
+                TargetCandidatePositions.Add(Cache.CandidatePositions[i]);
+            }
+        }
+    }
+}
+
+void UGSDZombieBehaviorProcessor::MergePursuitDemands()
+{
+    PursuitDemands.Reset();
+    PursuitDemandByTarget.Reset();
+
+    for (const FBucketTargetCache& Cache : BucketTargetCaches)
+    {
+        for (const FGSDFlowFieldDemand& BucketDemand : Cache.PursuitDemands)
+        {
+            if (const int32* DemandIndex = PursuitDemandByTarget.Find(BucketDemand.TargetID))
+            {
+                PursuitDemands[*DemandIndex].NumPursuers += BucketDemand.NumPursuers;
+                continue;
+            }
+
+            PursuitDemandByTarget.Add(BucketDemand.TargetID, PursuitDemands.Add(BucketDemand));
+        }
+    }
+
+    // Player locations are fresh this frame even when the bucket that counted them is not
+    for (FGSDFlowFieldDemand& Demand : PursuitDemands)
+    {
+        const int32 PlayerIndex = FGSDCrowdTargetHandle::FromID(Demand.TargetID).GetPlayerIndex();
+        if (PlayerTargetLocations.IsValidIndex(PlayerIndex))
+        {
+            Demand.Location = PlayerTargetLocations[PlayerIndex];
+        }
+    }
+}
+
+void UGSDZombieBehaviorProcessor::AddPursuitDemand(TArray<FGSDFlowFieldDemand>& Demands, const FGSDZombieMovementFragment& State)
+{
+    const int32 TargetID = State.Target.GetID();
+    if (const int32* DemandIndex = PursuitDemandByTarget.Find(TargetID))
+    {
+        Demands[*DemandIndex].NumPursuers++;
+        return;
+    }
+
+    FGSDFlowFieldDemand& Demand = Demands.AddDefaulted_GetRef();
+    Demand.TargetID = TargetID;
+    Demand.NumPursuers = 1;
+
+    // Entity targets use the pursuer's last refresh; player locations are refreshed on merge
+    Demand.Location = FVector(State.TargetLocation);
+
+    PursuitDemandByTarget.Add(TargetID, Demands.Num() - 1);
+}
+
+void UGSDZombieBehaviorProcessor::GatherPlayerTargets(UWorld* World)
+{
+    PlayerTargetLocations.Reset();
+    if (!World)
+    {
+        return;
+    }
+
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PlayerController = It->Get();
+        const APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+
+        // Keep indices stable per frame; pawnless players are unreachable
+        PlayerTargetLocations.Add(Pawn ? Pawn->GetActorLocation() : FVector(BIG_NUMBER));
+    }
+}
+
+bool UGSDZombieBehaviorProcessor::RefreshTargetLocation(const FMassEntityManager& EntityManager, FGSDZombieMovementFragment& State) const
+{
+    if (State.Target.IsPlayer())
+    {
+        const int32 PlayerIndex = State.Target.GetPlayerIndex();
+        if (!PlayerTargetLocations.IsValidIndex(PlayerIndex))
+        {
+            return false;
+        }
+        State.TargetLocation = FVector3f(PlayerTargetLocations[PlayerIndex]);
+        return true;
+    }
+
+    // Serial bits catch an entity index recycled for a different entity
+    const FMassEntityHandle TargetEntity = EntityManager.CreateEntityIndexHandle(State.Target.GetEntityIndex());
+    if (!EntityManager.IsEntityValid(TargetEntity) || !State.Target.MatchesEntity(TargetEntity))
+    {
+        return false;
+    }
+
+    const FDataFragment_Transform* TargetTransform = EntityManager.GetFragmentDataPtr<FDataFragment_Transform>(TargetEntity);
+    if (!TargetTransform)
+    {
+        return false;
+    }
+
+    State.TargetLocation = FVector3f(TargetTransform->GetTransform().GetLocation());
+    return true;
+}
+
+bool UGSDZombieBehaviorProcessor::AcquireTarget(const UGSDSpatialHash& SearchHash, const FVector& Location, float DetectionRange, FGSDZombieMovementFragment& State) const
+{
+    float BestDistSq = DetectionRange * DetectionRange;
+    FGSDCrowdTargetHandle BestTarget;
+    FVector BestLocation = FVector::ZeroVector;
+
+    // Players first - a handful of pawns, linear scan
+    for (int32 PlayerIndex = 0; PlayerIndex < PlayerTargetLocations.Num(); PlayerIndex++)
+    {
+        const float DistSq = static_cast<float>(FVector::DistSquared(Location, PlayerTargetLocations[PlayerIndex]));
+        if (DistSq <= BestDistSq)
+        {
+            BestDistSq = DistSq;
+            BestTarget = FGSDCrowdTargetHandle::MakePlayer(PlayerIndex);
+            BestLocation = PlayerTargetLocations[PlayerIndex];
+        }
+    }
+
+    // Entities via spatial hash; ties break on entity index so the result is chunk-order independent
+    SearchHash.ForEachEntityInRadius(Location, DetectionRange,
+        [&BestDistSq, &BestTarget, &BestLocation](const FMassEntityHandle& Entity, const FVector& Position, float DistanceSq)
+        {
+            const bool bCloser = DistanceSq < BestDistSq;
+            const bool bTieWithLowerIndex = DistanceSq == BestDistSq
+                && !BestTarget.IsPlayer()
+                && (!BestTarget.IsValid() || Entity.Index < BestTarget.GetEntityIndex());
+            if (bCloser || bTieWithLowerIndex)
+            {
+                // Indices beyond the compact handle's range cannot be targeted
+                const FGSDCrowdTargetHandle Candidate = FGSDCrowdTargetHandle::MakeEntity(Entity);
+                if (Candidate.IsValid())
+                {
+                    BestDistSq = DistanceSq;
+                    BestTarget = Candidate;
+                    BestLocation = Position;
+                }
+            }
         });
+
+    if (!BestTarget.IsValid())
+    {
+        return false;
+    }
+
+    State.Target = BestTarget;
+    State.TargetLocation = FVector3f(BestLocation);
+    return true;
 }
@@ -0,0 +1,221 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#include "Spatial/GSDFlowField.h"
+
+namespace GSDFlowField
+{
+    // Neighbour offsets, counter-clockwise from +X; odd entries are diagonals
+    static const FIntPoint NeighbourOffsets[8] =
+    {
+        FIntPoint(1, 0), FIntPoint(1, 1), FIntPoint(0, 1), FIntPoint(-1, 1),
+        FIntPoint(-1, 0), FIntPoint(-1, -1), FIntPoint(0, -1), FIntPoint(1, -1)
+    };
+
+    static const FVector NeighbourDirections[8] =
+    {
+        FVector(1.0f, 0.0f, 0.0f), FVector(UE_INV_SQRT_2, UE_INV_SQRT_2, 0.0f),
+        FVector(0.0f, 1.0f, 0.0f), FVector(-UE_INV_SQRT_2, UE_INV_SQRT_2, 0.0f),
+        FVector(-1.0f, 0.0f, 0.0f), FVector(-UE_INV_SQRT_2, -UE_INV_SQRT_2, 0.0f),
+        FVector(0.0f, -1.0f, 0.0f), FVector(UE_INV_SQRT_2, -UE_INV_SQRT_2, 0.0f)
+    };
+
+    static constexpr float StepCosts[2] = { 1.0f, UE_SQRT_2 };
+}
+
+void FGSDFlowField::Initialize(const FVector& InOrigin, float InCellSize, int32 InDimension)
+{
+    Origin = InOrigin;
+    CellSize = FMath::Max(InCellSize, 1.0f);
+    Dimension = FMath::Max(InDimension, 1);
+    GoalCell = FIntPoint(INDEX_NONE, INDEX_NONE);
+    GoalRadius = 0;
+
+    const int32 NumCells = Dimension * Dimension;
+    Walkable.Init(1, NumCells);
+    Integration.Init(UnreachableCost, NumCells);
+    Directions.Init(NoDirection, NumCells);
+}
+
+void FGSDFlowField::Reset()
+{
+    Dimension = 0;
+    GoalCell = FIntPoint(INDEX_NONE, INDEX_NONE);
+    GoalRadius = 0;
+    Walkable.Empty();
+    Integration.Empty();
+    Directions.Empty();
+    OpenHeap.Empty();
+}
+
+bool FGSDFlowField::WorldToCell(const FVector& Location, FIntPoint& OutCell) const
+{
+    const int32 X = FMath::FloorToInt((Location.X - Origin.X) / CellSize);
+    const int32 Y = FMath::FloorToInt((Location.Y - Origin.Y) / CellSize);
+    if (X < 0 || Y < 0 || X >= Dimension || Y >= Dimension)
+    {
+        return false;
+    }
+
+    OutCell = FIntPoint(X, Y);
+    return true;
+}
+
+FVector FGSDFlowField::GetCellCenter(const FIntPoint& Cell) const
+{
+    return FVector(Origin.X + (Cell.X + 0.5f) * CellSize, Origin.Y + (Cell.Y + 0.5f) * CellSize, 0.0f);
+}
+
+bool FGSDFlowField::CanStep(int32 X, int32 Y, int32 Dir) const
+{
+    const FIntPoint& Offset = GSDFlowField::NeighbourOffsets[Dir];
+    const int32 NX = X + Offset.X;
+    const int32 NY = Y + Offset.Y;
+    if (NX < 0 || NY < 0 || NX >= Dimension || NY >= Dimension || !Walkable[GetCellIndex(NX, NY)])
+    {
+        return false;
+    }
+
+    // Diagonals must not cut a blocked corner
+    if (Dir & 1)
+    {
+        return Walkable[GetCellIndex(NX, Y)] && Walkable[GetCellIndex(X, NY)];
+    }
+
+    return true;
+}
+
+bool FGSDFlowField::Build(const FVector& InGoalLocation)
+{
+    FIntPoint NewGoalCell;
+    if (!IsInitialized() || !WorldToCell(InGoalLocation, NewGoalCell))
+    {
+        GoalCell = FIntPoint(INDEX_NONE, INDEX_NONE);
+        return false;
+    }
+
+    GoalLocation = InGoalLocation;
+    GoalCell = NewGoalCell;
+    GoalRadius = 0;
+
+    // The goal is walkable for this build only; a blocked goal cell stays blocked for later goals
+    const int32 GoalIndex = GetCellIndex(GoalCell.X, GoalCell.Y);
+    const uint8 GoalWalkable = Walkable[GoalIndex];
+    Walkable[GoalIndex] = 1;
+
+    for (float& Cost : Integration)
+    {
+        Cost = UnreachableCost;
+    }
+
+    //-- Integration pass (Dijkstra from the goal) --
+    auto HeapPredicate = [](const FOpenCell& A, const FOpenCell& B) { return A.Cost < B.Cost; };
+
+    OpenHeap.Reset();
+    Integration[GoalIndex] = 0.0f;
+    OpenHeap.HeapPush({ 0.0f, GoalIndex }, HeapPredicate);
+
+    while (OpenHeap.Num() > 0)
+    {
+        FOpenCell Current;
+        OpenHeap.HeapPop(Current, HeapPredicate, false);
+
+        // Stale heap entry
+        if (Current.Cost > Integration[Current.CellIndex])
+        {
+            continue;
+        }
+
+        const int32 X = Current.CellIndex % Dimension;
+        const int32 Y = Current.CellIndex / Dimension;
+
+        for (int32 Dir = 0; Dir < 8; ++Dir)
+        {
+            if (!CanStep(X, Y, Dir))
+            {
+                continue;
+            }
+
+            const FIntPoint& Offset = GSDFlowField::NeighbourOffsets[Dir];
+            const int32 NeighbourIndex = GetCellIndex(X + Offset.X, Y + Offset.Y);
+            const float NewCost = Current.Cost + GSDFlowField::StepCosts[Dir & 1];
+
+            if (NewCost < Integration[NeighbourIndex])
+            {
+                Integration[NeighbourIndex] = NewCost;
+                OpenHeap.HeapPush({ NewCost, NeighbourIndex }, HeapPredicate);
+            }
+        }
+    }
+
+    //-- Direction pass (steepest descent) --
+    for (int32 Y = 0; Y < Dimension; ++Y)
+    {
+        for (int32 X = 0; X < Dimension; ++X)
+        {
+            const int32 CellIndex = GetCellIndex(X, Y);
+            uint8 BestDir = NoDirection;
+
+            if (CellIndex != GoalIndex && Integration[CellIndex] != UnreachableCost)
+            {
+                float BestCost = Integration[CellIndex];
+                for (int32 Dir = 0; Dir < 8; ++Dir)
+                {
+                    if (!CanStep(X, Y, Dir))
+                    {
+                        continue;
+                    }
+
+                    const FIntPoint& Offset = GSDFlowField::NeighbourOffsets[Dir];
+                    const float NeighbourCost = Integration[GetCellIndex(X + Offset.X, Y + Offset.Y)];
+                    if (NeighbourCost < BestCost)
+                    {
+                        BestCost = NeighbourCost;
+                        BestDir = static_cast<uint8>(Dir);
+                    }
+                }
+            }
+
+            Directions[CellIndex] = BestDir;
+        }
+    }
+
+    Walkable[GoalIndex] = GoalWalkable;
+    return true;
+}
+
+bool FGSDFlowField::Retarget(const FVector& InGoalLocation, int32 ToleranceCells)
+{
+    FIntPoint NewGoalCell;
+    if (!IsBuilt() || !WorldToCell(InGoalLocation, NewGoalCell))
+    {
+        return false;
+    }
+
+    const int32 Drift = FMath::Max(FMath::Abs(NewGoalCell.X - GoalCell.X), FMath::Abs(NewGoalCell.Y - GoalCell.Y));
+    if (Drift > ToleranceCells)
+    {
+        return false;
+    }
+
+    // Integration still leads into the built goal cell; from there the goal is steered to directly
+    GoalLocation = InGoalLocation;
+    GoalRadius = Drift;
+    return true;
+}
+
+FVector FGSDFlowField::SampleDirection(const FVector& Location) const
+{
+    FIntPoint Cell;
+    if (!IsBuilt() || !WorldToCell(Location, Cell))
+    {
+        return FVector::ZeroVector;
+    }
+
+    if (FMath::Abs(Cell.X - GoalCell.X) <= GoalRadius && FMath::Abs(Cell.Y - GoalCell.Y) <= GoalRadius)
+    {
+        return (GoalLocation - Location).GetSafeNormal2D();
+    }
+
+    const uint8 Dir = Directions[GetCellIndex(Cell.X, Cell.Y)];
+    return Dir == NoDirection ? FVector::ZeroVector : GSDFlowField::NeighbourDirections[Dir];
+}
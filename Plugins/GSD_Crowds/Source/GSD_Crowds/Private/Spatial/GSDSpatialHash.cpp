@@ -3,16 +3,30 @@
 #include "Spatial/GSDSpatialHash.h"
 #include "GSDCrowdLog.h"
 #include "ProfilingDebugging/ScopedTimers.h"
+#include "MassEntityManager.h"
+#include "MassEntityQuery.h"
+#include "MassExecutionContext.h"
+#include "MassCommonFragments.h"
+#include "Async/ParallelFor.h"
 
 void UGSDSpatialHash::Initialize(const FGSDSpatialHashConfig& InConfig)
 {
     Config = InConfig;
 
-    // Pre-allocate cells if pooling enabled
+    // Pre-allocate storage if pooling enabled
     if (Config.bEnableCellPooling)
     {
-        Cells.Reserve(Config.InitialCellPoolSize);
-        EntityToCellKey.Reserve(Config.InitialCellPoolSize * 4);  // Estimate 4 entities per cell
+        const int32 EntityReserve = Config.InitialCellPoolSize * 4;  // Estimate 4 entities per cell
+        CellKeys.Reserve(Config.InitialCellPoolSize);
+        CellStarts.Reserve(Config.InitialCellPoolSize + 1);
+        CellIndexByKey.Reserve(Config.InitialCellPoolSize);
+        StagedEntities.Reserve(EntityReserve);
+        StagedPositions.Reserve(EntityReserve);
+        EntityToSlot.Reserve(EntityReserve);
+        CellEntities.Reserve(EntityReserve);
+        CellPositions.Reserve(EntityReserve);
+        ScratchEntityCell.Reserve(EntityReserve);
+        ScratchEntityCoords.Reserve(EntityReserve);
     }
 
     UE_LOG(LOG_GSDCROWDS, Log, TEXT("SpatialHash initialized: CellSize=%.1f, PoolSize=%d"),
@@ -21,9 +35,18 @@ void UGSDSpatialHash::Initialize(const FGSDSpatialHashConfig& InConfig)
 
 void UGSDSpatialHash::Clear()
 {
-    Cells.Empty();
-    EntityToCellKey.Empty();
-    TotalEntityCount = 0;
+    StagedEntities.Reset();
+    StagedPositions.Reset();
+    EntityToSlot.Reset();
+    bEntityToSlotStale = false;
+
+    CellKeys.Reset();
+    CellStarts.Reset();
+    CellEntities.Reset();
+    CellPositions.Reset();
+    CellIndexByKey.Reset();
+
+    bNeedsRebuild = false;
 
     UE_LOG(LOG_GSDCROWDS, Verbose, TEXT("SpatialHash cleared"));
 }
@@ -35,27 +58,21 @@ void UGSDSpatialHash::Insert(const FMassEntityHandle& Entity, const FVector& Pos
         return;
     }
 
+    EnsureEntityToSlot();
+
     // Check if entity already exists
-    if (int64* ExistingCellKey = EntityToCellKey.Find(Entity))
+    if (const int32* ExistingSlot = EntityToSlot.Find(Entity))
     {
         // Entity exists - update position instead
-        UpdatePosition(Entity, Position);
+        StagedPositions[*ExistingSlot] = Position;
+        bNeedsRebuild = true;
         return;
     }
 
-    // Get cell coordinates
-    FIntVector CellCoords = GetCellCoords(Position);
-    int64 CellKey = MakeCellKey(CellCoords.X, CellCoords.Y);
-
-    // Add to cell
-    FGSDSpatialCell& Cell = GetOrCreateCell(CellCoords.X, CellCoords.Y);
-    Cell.Entities.Add(Entity);
-    Cell.bIsDirty = true;
-
-    // Track entity -> cell mapping
-    EntityToCellKey.Add(Entity, CellKey);
-
-    TotalEntityCount++;
+    EntityToSlot.Add(Entity, StagedEntities.Num());
+    StagedEntities.Add(Entity);
+    StagedPositions.Add(Position);
+    bNeedsRebuild = true;
 }
 
 void UGSDSpatialHash::Remove(const FMassEntityHandle& Entity)
@@ -65,33 +82,27 @@ void UGSDSpatialHash::Remove(const FMassEntityHandle& Entity)
         return;
     }
 
-    // Find cell key for this entity
-    int64* CellKeyPtr = EntityToCellKey.Find(Entity);
-    if (!CellKeyPtr)
+    EnsureEntityToSlot();
+
+    int32 Slot = INDEX_NONE;
+    if (!EntityToSlot.RemoveAndCopyValue(Entity, Slot))
     {
         // Entity not in hash
         return;
     }
 
-    int64 CellKey = *CellKeyPtr;
-
-    // Remove from cell
-    if (FGSDSpatialCell* Cell = Cells.Find(CellKey))
+    // Swap-remove keeps staging arrays dense; fix up the moved entity's slot
+    const int32 LastSlot = StagedEntities.Num() - 1;
+    if (Slot != LastSlot)
     {
-        Cell->Entities.Remove(Entity);
-        Cell->bIsDirty = true;
-
-        // Remove empty cells to save memory
-        if (Cell->Entities.Num() == 0)
-        {
-            Cells.Remove(CellKey);
-        }
+        StagedEntities[Slot] = StagedEntities[LastSlot];
+        StagedPositions[Slot] = StagedPositions[LastSlot];
+        EntityToSlot[StagedEntities[Slot]] = Slot;
     }
+    StagedEntities.Pop();
+    StagedPositions.Pop();
 
-    // Remove entity mapping
-    EntityToCellKey.Remove(Entity);
-
-    TotalEntityCount--;
+    bNeedsRebuild = true;
 }
 
 void UGSDSpatialHash::UpdatePosition(const FMassEntityHandle& Entity, const FVector& NewPosition)
@@ -101,124 +112,315 @@ void UGSDSpatialHash::UpdatePosition(const FMassEntityHandle& Entity, const FVec
         return;
     }
 
-    // Find current cell
-    int64* CurrentCellKeyPtr = EntityToCellKey.Find(Entity);
-    if (!CurrentCellKeyPtr)
+    EnsureEntityToSlot();
+
+    const int32* Slot = EntityToSlot.Find(Entity);
+    if (!Slot)
     {
         // Entity not in hash - insert instead
         Insert(Entity, NewPosition);
         return;
     }
 
-    // Get new cell coordinates
-    FIntVector NewCellCoords = GetCellCoords(NewPosition);
-    int64 NewCellKey = MakeCellKey(NewCellCoords.X, NewCellCoords.Y);
-    int64 CurrentCellKey = *CurrentCellKeyPtr;
+    // Positions are stored for exact distance filtering, so always update
+    StagedPositions[*Slot] = NewPosition;
+    bNeedsRebuild = true;
+}
 
-    // Check if cell changed
-    if (NewCellKey == CurrentCellKey)
-    {
-        // Same cell - no update needed
-        return;
-    }
+void UGSDSpatialHash::Rebuild()
+{
+    double StartTime = FPlatformTime::Seconds();
+
+    BuildCellsFromStaging(false);
 
-    // Remove from old cell
-    if (FGSDSpatialCell* OldCell = Cells.Find(CurrentCellKey))
+    double EndTime = FPlatformTime::Seconds();
+    LastBuildStats.EntityCount = StagedEntities.Num();
+    LastBuildStats.CellCount = CellKeys.Num();
+    LastBuildStats.BuildTimeMicroseconds = (EndTime - StartTime) * 1000000.0;
+    LastBuildStats.bBulkBuild = false;
+}
+
+void UGSDSpatialHash::RebuildFromQuery(FMassEntityManager& EntityManager, FMassEntityQuery& Query)
+{
+    double StartTime = FPlatformTime::Seconds();
+
+    // Gather: bulk-copy handles and positions chunk by chunk (no per-entity map work)
+    const int32 ExpectedEntities = Query.GetNumMatchingEntities(EntityManager);
+    StagedEntities.Reset(ExpectedEntities);
+    StagedPositions.Reset(ExpectedEntities);
+
+    FMassExecutionContext ExecContext(EntityManager, 0.0f);
+    Query.ForEachEntityChunk(EntityManager, ExecContext, [this](FMassExecutionContext& Context)
     {
-        OldCell->Entities.Remove(Entity);
-        OldCell->bIsDirty = true;
+        const int32 NumEntities = Context.GetNumEntities();
+        const auto Transforms = Context.GetFragmentView<FDataFragment_Transform>();
+
+        StagedEntities.Append(Context.GetEntities().GetData(), NumEntities);
 
-        // Remove empty cells
-        if (OldCell->Entities.Num() == 0)
+        const int32 BaseIndex = StagedPositions.AddUninitialized(NumEntities);
+        for (int32 i = 0; i < NumEntities; i++)
         {
-            Cells.Remove(CurrentCellKey);
+            StagedPositions[BaseIndex + i] = Transforms[i].GetTransform().GetLocation();
         }
-    }
+    });
+
+    // Slot map is rebuilt lazily only if incremental calls follow a bulk rebuild
+    EntityToSlot.Reset();
+    bEntityToSlotStale = true;
 
-    // Add to new cell
-    FGSDSpatialCell& NewCell = GetOrCreateCell(NewCellCoords.X, NewCellCoords.Y);
-    NewCell.Entities.Add(Entity);
-    NewCell.bIsDirty = true;
+    BuildCellsFromStaging(true);
 
-    // Update mapping
-    EntityToCellKey[Entity] = NewCellKey;
+    double EndTime = FPlatformTime::Seconds();
+    LastBuildStats.EntityCount = StagedEntities.Num();
+    LastBuildStats.CellCount = CellKeys.Num();
+    LastBuildStats.BuildTimeMicroseconds = (EndTime - StartTime) * 1000000.0;
+    LastBuildStats.bBulkBuild = true;
 }
 
-FGSDSpatialQueryResult UGSDSpatialHash::GetEntitiesInRadius(const FVector& Center, float Radius) const
+void UGSDSpatialHash::RebuildFromEntities(TConstArrayView<FMassEntityHandle> Entities, TConstArrayView<FVector> Positions)
 {
-    FGSDSpatialQueryResult Result;
-    Result.QueryCenter = Center;
-    Result.QueryRadius = Radius;
+    check(Entities.Num() == Positions.Num());
 
     double StartTime = FPlatformTime::Seconds();
 
-    // Calculate cell range to search
-    int32 CellRadius = FMath::CeilToInt(Radius / Config.CellSize);
-    CellRadius = FMath::Min(CellRadius, Config.MaxCellSearchRadius);
+    StagedEntities.Reset(Entities.Num());
+    StagedEntities.Append(Entities.GetData(), Entities.Num());
+    StagedPositions.Reset(Positions.Num());
+    StagedPositions.Append(Positions.GetData(), Positions.Num());
+
+    EntityToSlot.Reset();
+    bEntityToSlotStale = true;
+
+    BuildCellsFromStaging(true);
+
+    double EndTime = FPlatformTime::Seconds();
+    LastBuildStats.EntityCount = StagedEntities.Num();
+    LastBuildStats.CellCount = CellKeys.Num();
+    LastBuildStats.BuildTimeMicroseconds = (EndTime - StartTime) * 1000000.0;
+    LastBuildStats.bBulkBuild = true;
+}
+
+void UGSDSpatialHash::BuildCellsFromStaging(bool bParallel)
+{
+    const int32 NumEntities = StagedEntities.Num();
+
+    CellKeys.Reset();
+    CellStarts.Reset();
+    CellIndexByKey.Reset();
+    ScratchEntityCell.SetNumUninitialized(NumEntities);
+    ScratchEntityCoords.SetNumUninitialized(NumEntities);
+
+    // Pass 1: cell coords per entity and overall cell bounds (parallel in batches)
+    const int32 NumBatches = FMath::Max(1, FMath::DivideAndRoundUp(NumEntities, KeyBatchSize));
+    TArray<FIntRect, TInlineAllocator<64>> BatchBounds;
+    BatchBounds.SetNumUninitialized(NumBatches);
+
+    auto ComputeBatch = [this, NumEntities, &BatchBounds](int32 BatchIndex)
+    {
+        FIntRect Bounds(MAX_int32, MAX_int32, MIN_int32, MIN_int32);
+        const int32 Begin = BatchIndex * KeyBatchSize;
+        const int32 End = FMath::Min(Begin + KeyBatchSize, NumEntities);
+        for (int32 i = Begin; i < End; i++)
+        {
+            const FIntVector CellCoords = GetCellCoords(StagedPositions[i]);
+            const FIntPoint Coords(CellCoords.X, CellCoords.Y);
+            ScratchEntityCoords[i] = Coords;
+            Bounds.Min = Bounds.Min.ComponentMin(Coords);
+            Bounds.Max = Bounds.Max.ComponentMax(Coords);
+        }
+        BatchBounds[BatchIndex] = Bounds;
+    };
 
-    FIntVector CenterCell = GetCellCoords(Center);
-    float RadiusSq = Radius * Radius;
+    if (bParallel && NumBatches > 1)
+    {
+        ParallelFor(NumBatches, ComputeBatch);
+    }
+    else
+    {
+        for (int32 BatchIndex = 0; BatchIndex < NumBatches; BatchIndex++)
+        {
+            ComputeBatch(BatchIndex);
+        }
+    }
 
-    // Iterate cells in square around center
-    for (int32 dx = -CellRadius; dx <= CellRadius; dx++)
+    if (NumEntities > 0)
     {
-        for (int32 dy = -CellRadius; dy <= CellRadius; dy++)
+        FIntRect Bounds = BatchBounds[0];
+        for (int32 BatchIndex = 1; BatchIndex < NumBatches; BatchIndex++)
         {
-            int64 CellKey = MakeCellKey(CenterCell.X + dx, CenterCell.Y + dy);
+            Bounds.Min = Bounds.Min.ComponentMin(BatchBounds[BatchIndex].Min);
+            Bounds.Max = Bounds.Max.ComponentMax(BatchBounds[BatchIndex].Max);
+        }
+
+        const int64 Width = static_cast<int64>(Bounds.Max.X) - Bounds.Min.X + 1;
+        const int64 Height = static_cast<int64>(Bounds.Max.Y) - Bounds.Min.Y + 1;
+        const int64 DenseCells = Width * Height;
 
-            const FGSDSpatialCell* Cell = Cells.Find(CellKey);
-            if (!Cell || Cell->Entities.Num() == 0)
+        if (DenseCells <= FMath::Max<int64>(static_cast<int64>(NumEntities) * MaxDenseCellsPerEntity, MinDenseCells))
+        {
+            // Counting sort over the dense bounding grid - no hashing per entity
+            ScratchDenseCounts.Reset();
+            ScratchDenseCounts.SetNumZeroed(static_cast<int32>(DenseCells));
+            for (int32 i = 0; i < NumEntities; i++)
             {
-                continue;
+                const FIntPoint& Coords = ScratchEntityCoords[i];
+                const int32 DenseIndex = static_cast<int32>((Coords.X - Bounds.Min.X) * Height + (Coords.Y - Bounds.Min.Y));
+                ScratchEntityCell[i] = DenseIndex;
+                ScratchDenseCounts[DenseIndex]++;
             }
 
-            // Check each entity in cell
-            for (const FMassEntityHandle& Entity : Cell->Entities)
+            // Compact occupied cells, writing starts and remapping dense index -> cell index
+            int32 Running = 0;
+            for (int32 DenseIndex = 0; DenseIndex < ScratchDenseCounts.Num(); DenseIndex++)
             {
-                // Note: For full implementation, we'd need entity positions
-                // For now, we return all entities in overlapping cells
-                // The caller can do precise distance filtering if needed
-                Result.Entities.Add(Entity);
+                const int32 Count = ScratchDenseCounts[DenseIndex];
+                if (Count == 0)
+                {
+                    continue;
+                }
+
+                const int32 CellX = Bounds.Min.X + static_cast<int32>(DenseIndex / Height);
+                const int32 CellY = Bounds.Min.Y + static_cast<int32>(DenseIndex % Height);
+                const int64 CellKey = MakeCellKey(CellX, CellY);
+                const int32 CellIndex = CellKeys.Add(CellKey);
+                CellIndexByKey.Add(CellKey, CellIndex);
+                CellStarts.Add(Running);
+                Running += Count;
+                ScratchDenseCounts[DenseIndex] = CellIndex;
+            }
+            CellStarts.Add(Running);
+
+            for (int32 i = 0; i < NumEntities; i++)
+            {
+                ScratchEntityCell[i] = ScratchDenseCounts[ScratchEntityCell[i]];
             }
         }
+        else
+        {
+            // Sparse spread: assign cell indices via the key map (first-seen order) and count
+            for (int32 i = 0; i < NumEntities; i++)
+            {
+                const int64 CellKey = MakeCellKey(ScratchEntityCoords[i].X, ScratchEntityCoords[i].Y);
+
+                int32& CellIndex = CellIndexByKey.FindOrAdd(CellKey, INDEX_NONE);
+                if (CellIndex == INDEX_NONE)
+                {
+                    CellIndex = CellKeys.Add(CellKey);
+                    CellStarts.Add(0);
+                }
+                CellStarts[CellIndex]++;
+                ScratchEntityCell[i] = CellIndex;
+            }
+
+            // Exclusive prefix sum -> cell start offsets
+            const int32 NumCells = CellKeys.Num();
+            CellStarts.Add(0);
+            int32 Running = 0;
+            for (int32 c = 0; c <= NumCells; c++)
+            {
+                const int32 Count = CellStarts[c];
+                CellStarts[c] = Running;
+                Running += Count;
+            }
+        }
+    }
+    else
+    {
+        CellStarts.Add(0);
     }
 
-    Result.Count = Result.Entities.Num();
+    // Pass 2: stable scatter of entities and positions into their cell ranges
+    ScratchWriteCursor = CellStarts;
+    CellEntities.SetNumUninitialized(NumEntities);
+    CellPositions.SetNumUninitialized(NumEntities);
+    for (int32 i = 0; i < NumEntities; i++)
+    {
+        const int32 Dest = ScratchWriteCursor[ScratchEntityCell[i]]++;
+        CellEntities[Dest] = StagedEntities[i];
+        CellPositions[Dest] = StagedPositions[i];
+    }
 
-    double EndTime = FPlatformTime::Seconds();
-    Result.QueryTimeMicroseconds = (EndTime - StartTime) * 1000000.0;
+    bNeedsRebuild = false;
+}
 
-    return Result;
+void UGSDSpatialHash::EnsureEntityToSlot()
+{
+    if (!bEntityToSlotStale)
+    {
+        return;
+    }
+
+    EntityToSlot.Reset();
+    EntityToSlot.Reserve(StagedEntities.Num());
+    for (int32 Slot = 0; Slot < StagedEntities.Num(); Slot++)
+    {
+        EntityToSlot.Add(StagedEntities[Slot], Slot);
+    }
+    bEntityToSlotStale = false;
 }
 
-FGSDSpatialQueryResult UGSDSpatialHash::GetEntitiesInBox(const FVector& Min, const FVector& Max) const
+int32 UGSDSpatialHash::QueryRadius(const FVector& Center, float Radius, TArray<FMassEntityHandle>& OutEntities) const
 {
-    FGSDSpatialQueryResult Result;
+    const int32 StartNum = OutEntities.Num();
 
-    double StartTime = FPlatformTime::Seconds();
+    ForEachEntityInRadius(Center, Radius,
+        [&OutEntities](const FMassEntityHandle& Entity, const FVector& Position, float DistanceSq)
+        {
+            OutEntities.Add(Entity);
+        });
+
+    return OutEntities.Num() - StartNum;
+}
+
+int32 UGSDSpatialHash::QueryBox(const FVector& Min, const FVector& Max, TArray<FMassEntityHandle>& OutEntities) const
+{
+    const int32 StartNum = OutEntities.Num();
 
     // Calculate cell range
-    FIntVector MinCell = GetCellCoords(Min);
-    FIntVector MaxCell = GetCellCoords(Max);
+    const FIntVector MinCell = GetCellCoords(Min);
+    const FIntVector MaxCell = GetCellCoords(Max);
 
-    // Iterate all cells in box
-    for (int32 x = MinCell.X; x <= MaxCell.X; x++)
-    {
-        for (int32 y = MinCell.Y; y <= MaxCell.Y; y++)
+    ForEachCellInRange(MinCell.X, MinCell.Y, MaxCell.X, MaxCell.Y,
+        [this, &Min, &Max, &OutEntities](int32 Start, int32 End)
         {
-            int64 CellKey = MakeCellKey(x, y);
-
-            const FGSDSpatialCell* Cell = Cells.Find(CellKey);
-            if (!Cell || Cell->Entities.Num() == 0)
+            for (int32 i = Start; i < End; i++)
             {
-                continue;
+                const FVector& Position = CellPositions[i];
+                if (Position.X >= Min.X && Position.X <= Max.X
+                    && Position.Y >= Min.Y && Position.Y <= Max.Y
+                    && Position.Z >= Min.Z && Position.Z <= Max.Z)
+                {
+                    OutEntities.Add(CellEntities[i]);
+                }
             }
+        });
 
-            Result.Entities.Append(Cell->Entities);
-        }
-    }
+    return OutEntities.Num() - StartNum;
+}
+
+FGSDSpatialQueryResult UGSDSpatialHash::GetEntitiesInRadius(const FVector& Center, float Radius) const
+{
+    FGSDSpatialQueryResult Result;
+    Result.QueryCenter = Center;
+    Result.QueryRadius = Radius;
+
+    double StartTime = FPlatformTime::Seconds();
+
+    Result.Count = QueryRadius(Center, Radius, Result.Entities);
+
+    double EndTime = FPlatformTime::Seconds();
+    Result.QueryTimeMicroseconds = (EndTime - StartTime) * 1000000.0;
+
+    return Result;
+}
 
-    Result.Count = Result.Entities.Num();
+FGSDSpatialQueryResult UGSDSpatialHash::GetEntitiesInBox(const FVector& Min, const FVector& Max) const
+{
+    FGSDSpatialQueryResult Result;
+
+    double StartTime = FPlatformTime::Seconds();
+
+    Result.Count = QueryBox(Min, Max, Result.Entities);
 
     double EndTime = FPlatformTime::Seconds();
     Result.QueryTimeMicroseconds = (EndTime - StartTime) * 1000000.0;
@@ -242,9 +444,8 @@ int64 UGSDSpatialHash::GetCellKey(int32 CellX, int32 CellY) const
 
 bool UGSDSpatialHash::IsCellOccupied(int32 CellX, int32 CellY) const
 {
-    int64 Key = MakeCellKey(CellX, CellY);
-    const FGSDSpatialCell* Cell = Cells.Find(Key);
-    return Cell && Cell->Entities.Num() > 0;
+    // Cells only exist in the built structure when they hold at least one entity
+    return CellIndexByKey.Contains(MakeCellKey(CellX, CellY));
 }
 
 void UGSDSpatialHash::SetCellSize(float NewCellSize)
@@ -262,14 +463,3 @@ void UGSDSpatialHash::SetCellSize(float NewCellSize)
 
     UE_LOG(LOG_GSDCROWDS, Log, TEXT("SpatialHash cell size changed to %.1f (entities cleared)"), NewCellSize);
 }
-
-FGSDSpatialCell& UGSDSpatialHash::GetOrCreateCell(int32 CellX, int32 CellY)
-{
-    int64 Key = MakeCellKey(CellX, CellY);
-
-    FGSDSpatialCell& Cell = Cells.FindOrAdd(Key);
-    Cell.CellX = CellX;
-    Cell.CellY = CellY;
-
-    return Cell;
-}
@@ -13,39 +13,187 @@ void UGSDCrowdEventSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
 
+    // Allocate the event ring; each slot starts free at its own position
+    EventSlots = MakeUnique<FEventSlot[]>(EventQueueCapacity);
+    for (uint32 i = 0; i < EventQueueCapacity; ++i)
+    {
+        EventSlots[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+    EventQueueTail.store(0, std::memory_order_relaxed);
+    EventQueueHead = 0;
+
+    // Deliver once per frame, after all tick groups (and Mass phases) have run
+    PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UGSDCrowdEventSubsystem::OnWorldPostActorTick);
+
     UE_LOG(LOG_GSDCROWDS, Log, TEXT("CrowdEventSubsystem initialized"));
 }
 
 void UGSDCrowdEventSubsystem::Deinitialize()
 {
+    FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+    PostActorTickHandle.Reset();
+
     ClearAllListeners();
+    EventSlots.Reset();
+    FlushScratch.Empty();
 
     Super::Deinitialize();
 }
 
+void UGSDCrowdEventSubsystem::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+    if (World == GetWorld())
+    {
+        FlushEvents();
+    }
+}
+
 void UGSDCrowdEventSubsystem::BroadcastEvent(const FGSDCrowdEvent& Event)
 {
-    EventsThisFrame++;
-    TotalEventsBroadcast++;
+    if (!EventSlots)
+    {
+        return;
+    }
 
-    // Broadcast to all matching listeners
-    for (const FEventListener& Listener : Listeners)
+    // Claim a slot (bounded MPSC ring, lock-free for concurrent producers)
+    uint32 Position = EventQueueTail.load(std::memory_order_relaxed);
+    for (;;)
     {
-        // If listener has no tag filter, or tag matches, broadcast
-        if (!Listener.EventTag.IsValid() || Listener.EventTag == Event.EventTag)
+        FEventSlot& Slot = EventSlots[Position & (EventQueueCapacity - 1)];
+        const int32 Diff = static_cast<int32>(Slot.Sequence.load(std::memory_order_acquire) - Position);
+
+        if (Diff == 0)
         {
-            if (Listener.Delegate.IsBound())
+            if (EventQueueTail.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
             {
-                Listener.Delegate.Execute(Event, Event.EventTag);
+                Slot.Event = Event;
+                Slot.Sequence.store(Position + 1, std::memory_order_release);
+                break;
             }
         }
+        else if (Diff < 0)
+        {
+            // Queue full until the next flush
+            TotalEventsDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        else
+        {
+            Position = EventQueueTail.load(std::memory_order_relaxed);
+        }
     }
 
-    // Log significant events
-    if (Event.EventType != EGSDCrowdEventType::None)
+    EventsThisFrame.fetch_add(1, std::memory_order_relaxed);
+    TotalEventsBroadcast.fetch_add(1, std::memory_order_relaxed);
+}
+
+void UGSDCrowdEventSubsystem::FlushEvents()
+{
+    check(IsInGameThread());
+
+    if (!EventSlots)
     {
-        UE_LOG(LOG_GSDCROWDS, Verbose, TEXT("Broadcast event: %s at %s"),
-            *UEnum::GetValueAsString(Event.EventType), *Event.Location.ToString());
+        return;
+    }
+
+    // Drain published slots; a slot still being written stays for the next flush
+    FlushScratch.Reset();
+    for (;;)
+    {
+        FEventSlot& Slot = EventSlots[EventQueueHead & (EventQueueCapacity - 1)];
+        if (Slot.Sequence.load(std::memory_order_acquire) != EventQueueHead + 1)
+        {
+            break;
+        }
+
+        FlushScratch.Add(MoveTemp(Slot.Event));
+        Slot.Sequence.store(EventQueueHead + EventQueueCapacity, std::memory_order_release);
+        ++EventQueueHead;
+    }
+
+    EventsThisFrame.store(0, std::memory_order_relaxed);
+
+    const int64 Dropped = TotalEventsDropped.load(std::memory_order_relaxed);
+    if (Dropped != LastReportedDropped)
+    {
+        UE_LOG(LOG_GSDCROWDS, Warning, TEXT("CrowdEventSubsystem: event queue full, dropped %lld events (capacity %u)"),
+            Dropped - LastReportedDropped, EventQueueCapacity);
+        LastReportedDropped = Dropped;
+    }
+
+    if (FlushScratch.Num() == 0 || Listeners.Num() == 0)
+    {
+        return;
+    }
+
+    // Bucket events into listeners: exact, any-type, any-tag and wildcard buckets
+    for (const FGSDCrowdEvent& Event : FlushScratch)
+    {
+        // Cross product of {type, any type} x {tag, any tag}, without duplicates
+        const int32 NumTypes = Event.EventType != EGSDCrowdEventType::None ? 2 : 1;
+        const int32 NumTags = Event.EventTag.IsValid() ? 2 : 1;
+
+        FListenerKey Keys[4];
+        int32 NumKeys = 0;
+        for (int32 TypeIndex = 0; TypeIndex < NumTypes; ++TypeIndex)
+        {
+            for (int32 TagIndex = 0; TagIndex < NumTags; ++TagIndex)
+            {
+                Keys[NumKeys++] = {
+                    TypeIndex == 0 ? Event.EventType : EGSDCrowdEventType::None,
+                    TagIndex == 0 ? Event.EventTag : FGameplayTag() };
+            }
+        }
+
+        for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+        {
+            if (const TArray<int32>* Bucket = ListenerBuckets.Find(Keys[KeyIndex]))
+            {
+                for (const int32 ListenerIndex : *Bucket)
+                {
+                    Listeners[ListenerIndex].PendingEvents.Add(Event);
+                }
+            }
+        }
+    }
+
+    // Move batches out before executing so callbacks may (un)register listeners
+    struct FDelivery
+    {
+        FOnCrowdEvent Delegate;
+        FOnCrowdEventBatch BatchDelegate;
+        FOnCrowdEventBatchNative NativeBatchDelegate;
+        TArray<FGSDCrowdEvent> Events;
+    };
+    TArray<FDelivery> Deliveries;
+    for (FEventListener& Listener : Listeners)
+    {
+        if (Listener.PendingEvents.Num() > 0)
+        {
+            Deliveries.Add({ Listener.Delegate, Listener.BatchDelegate, Listener.NativeBatchDelegate, MoveTemp(Listener.PendingEvents) });
+            Listener.PendingEvents.Reset();
+        }
+    }
+
+    UE_LOG(LOG_GSDCROWDS, Verbose, TEXT("Flushed %d crowd events to %d listeners"), FlushScratch.Num(), Deliveries.Num());
+
+    for (const FDelivery& Delivery : Deliveries)
+    {
+        if (Delivery.NativeBatchDelegate.IsBound())
+        {
+            Delivery.NativeBatchDelegate.Execute(Delivery.Events);
+        }
+        else if (Delivery.BatchDelegate.IsBound())
+        {
+            Delivery.BatchDelegate.Execute(Delivery.Events);
+        }
+        else if (Delivery.Delegate.IsBound())
+        {
+            for (const FGSDCrowdEvent& Event : Delivery.Events)
+            {
+                Delivery.Delegate.Execute(Event, Event.EventTag);
+            }
+        }
     }
 }
 
@@ -89,16 +237,77 @@ int32 UGSDCrowdEventSubsystem::RegisterListener(FGameplayTag EventTag, const FOn
     }
 
     FEventListener NewListener;
-    NewListener.Handle = NextListenerHandle++;
     NewListener.EventTag = EventTag;
     NewListener.Delegate = Delegate;
 
-    Listeners.Add(NewListener);
+    const int32 Handle = AddListener(MoveTemp(NewListener));
 
     UE_LOG(LOG_GSDCROWDS, Verbose, TEXT("Registered event listener (handle=%d, tag=%s)"),
-        NewListener.Handle, *EventTag.ToString());
+        Handle, *EventTag.ToString());
+
+    return Handle;
+}
+
+int32 UGSDCrowdEventSubsystem::RegisterBatchListener(EGSDCrowdEventType EventType, FGameplayTag EventTag, const FOnCrowdEventBatch& Delegate)
+{
+    if (!Delegate.IsBound())
+    {
+        UE_LOG(LOG_GSDCROWDS, Warning, TEXT("RegisterBatchListener: Delegate is not bound"));
+        return INDEX_NONE;
+    }
+
+    FEventListener NewListener;
+    NewListener.EventType = EventType;
+    NewListener.EventTag = EventTag;
+    NewListener.BatchDelegate = Delegate;
 
-    return NewListener.Handle;
+    const int32 Handle = AddListener(MoveTemp(NewListener));
+
+    UE_LOG(LOG_GSDCROWDS, Verbose, TEXT("Registered batch event listener (handle=%d, type=%s, tag=%s)"),
+        Handle, *UEnum::GetValueAsString(EventType), *EventTag.ToString());
+
+    return Handle;
+}
+
+int32 UGSDCrowdEventSubsystem::RegisterNativeBatchListener(EGSDCrowdEventType EventType, FGameplayTag EventTag, FOnCrowdEventBatchNative&& Delegate)
+{
+    if (!Delegate.IsBound())
+    {
+        UE_LOG(LOG_GSDCROWDS, Warning, TEXT("RegisterNativeBatchListener: Delegate is not bound"));
+        return INDEX_NONE;
+    }
+
+    FEventListener NewListener;
+    NewListener.EventType = EventType;
+    NewListener.EventTag = EventTag;
+    NewListener.NativeBatchDelegate = MoveTemp(Delegate);
+
+    const int32 Handle = AddListener(MoveTemp(NewListener));
+
+    UE_LOG(LOG_GSDCROWDS, Verbose, TEXT("Registered native batch event listener (handle=%d, type=%s, tag=%s)"),
+        Handle, *UEnum::GetValueAsString(EventType), *EventTag.ToString());
+
+    return Handle;
+}
+
+int32 UGSDCrowdEventSubsystem::AddListener(FEventListener&& Listener)
+{
+    Listener.Handle = NextListenerHandle++;
+    const int32 Handle = Listener.Handle;
+
+    Listeners.Add(MoveTemp(Listener));
+    RebuildListenerBuckets();
+
+    return Handle;
+}
+
+void UGSDCrowdEventSubsystem::RebuildListenerBuckets()
+{
+    ListenerBuckets.Reset();
+    for (int32 i = 0; i < Listeners.Num(); ++i)
+    {
+        ListenerBuckets.FindOrAdd({ Listeners[i].EventType, Listeners[i].EventTag }).Add(i);
+    }
 }
 
 void UGSDCrowdEventSubsystem::UnregisterListener(int32 Handle)
@@ -110,6 +319,7 @@ void UGSDCrowdEventSubsystem::UnregisterListener(int32 Handle)
 
     if (RemovedCount > 0)
     {
+        RebuildListenerBuckets();
         UE_LOG(LOG_GSDCROWDS, Verbose, TEXT("Unregistered event listener (handle=%d)"), Handle);
     }
     else
@@ -121,5 +331,6 @@ void UGSDCrowdEventSubsystem::UnregisterListener(int32 Handle)
 void UGSDCrowdEventSubsystem::ClearAllListeners()
 {
     Listeners.Empty();
+    ListenerBuckets.Empty();
     UE_LOG(LOG_GSDCROWDS, Log, TEXT("Cleared all event listeners"));
 }
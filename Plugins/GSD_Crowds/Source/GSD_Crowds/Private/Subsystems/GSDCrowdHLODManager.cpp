@@ -25,70 +25,245 @@ void UGSDCrowdHLODManager::ClearAllProxies()
             Proxy->Destroy();
         }
     }
+    for (AGSDCrowdHLODProxy* Proxy : PooledProxies)
+    {
+        if (Proxy)
+        {
+            Proxy->Destroy();
+        }
+    }
     ActiveProxies.Empty();
+    PooledProxies.Empty();
+    CellProxies.Empty();
+    Clusters.Empty();
+    EntityCells.Empty();
 }
 
-void UGSDCrowdHLODManager::ClusterEntitiesForHLOD(const TArray<FMassEntityHandle>& Entities, const TArray<FVector>& Positions, UWorld* World)
+FIntVector UGSDCrowdHLODManager::GetClusterKey(const FVector& Position) const
 {
-    if (!World || Entities.Num() == 0 || Positions.Num() != Entities.Num())
+    return FIntVector(
+        FMath::FloorToInt(Position.X / ClusterSize),
+        FMath::FloorToInt(Position.Y / ClusterSize),
+        0
+    );
+}
+
+void UGSDCrowdHLODManager::FinalizeCluster(FGSDCrowdCluster& Cluster)
+{
+    Cluster.EntityCount = Cluster.Entities.Num();
+    if (Cluster.EntityCount == 0)
     {
         return;
     }
 
-    // Clear existing proxies
-    ClearAllProxies();
+    // Calculate cluster center
+    FVector Sum = FVector::ZeroVector;
+    for (const FVector& Position : Cluster.Positions)
+    {
+        Sum += Position;
+    }
+    Cluster.Center = Sum / Cluster.EntityCount;
+
+    // Calculate radius
+    float MaxDistSq = 0.0f;
+    for (const FVector& Position : Cluster.Positions)
+    {
+        MaxDistSq = FMath::Max(MaxDistSq, static_cast<float>(FVector::DistSquared(Cluster.Center, Position)));
+    }
+    Cluster.Radius = FMath::Sqrt(MaxDistSq);
+}
+
+void UGSDCrowdHLODManager::ClusterEntitiesForHLOD(const TArray<FMassEntityHandle>& Entities, const TArray<FVector>& Positions, UWorld* World)
+{
+    if (Positions.Num() != Entities.Num())
+    {
+        return;
+    }
 
-    // Simple grid-based clustering
-    TMap<FIntVector, FGSDCrowdCluster> Clusters;
+    // Simple grid-based clustering - single pass, positions stored with the cluster
+    TMap<FIntVector, FGSDCrowdCluster> NewClusters;
+    EntityCells.Reset();
+    ++UpdateStamp;
 
     for (int32 i = 0; i < Entities.Num(); i++)
     {
-        const FVector& Pos = Positions[i];
-        FIntVector ClusterKey(
-            FMath::FloorToInt(Pos.X / ClusterSize),
-            FMath::FloorToInt(Pos.Y / ClusterSize),
-            0
-        );
+        const FIntVector ClusterKey = GetClusterKey(Positions[i]);
 
-        FGSDCrowdCluster& Cluster = Clusters.FindOrAdd(ClusterKey);
+        FGSDCrowdCluster& Cluster = NewClusters.FindOrAdd(ClusterKey);
+        Cluster.CellKey = ClusterKey;
         Cluster.Entities.Add(Entities[i]);
-        Cluster.EntityCount++;
+        Cluster.Positions.Add(Positions[i]);
+
+        EntityCells.Add(Entities[i], { ClusterKey, UpdateStamp });
+    }
+
+    // Release proxies for cells that no longer have a cluster
+    for (const TPair<FIntVector, FGSDCrowdCluster>& Pair : Clusters)
+    {
+        if (!NewClusters.Contains(Pair.Key))
+        {
+            ReleaseProxyForCell(Pair.Key);
+        }
+    }
+
+    Clusters = MoveTemp(NewClusters);
+
+    // Calculate cluster centers and radii, then reuse or create proxies
+    for (TPair<FIntVector, FGSDCrowdCluster>& Pair : Clusters)
+    {
+        FinalizeCluster(Pair.Value);
+        RefreshProxyForCluster(Pair.Value, World);
+    }
+}
+
+int32 UGSDCrowdHLODManager::UpdateEntitiesForHLOD(const TArray<FMassEntityHandle>& Entities, const TArray<FVector>& Positions, UWorld* World)
+{
+    if (Positions.Num() != Entities.Num())
+    {
+        return 0;
+    }
+
+    if (Clusters.IsEmpty())
+    {
+        ClusterEntitiesForHLOD(Entities, Positions, World);
+        return Clusters.Num();
+    }
+
+    ++UpdateStamp;
+    TSet<FIntVector> DirtyCells;
+
+    // Detect entities that were added or changed cell
+    ScratchCellKeys.SetNumUninitialized(Entities.Num());
+    for (int32 i = 0; i < Entities.Num(); i++)
+    {
+        const FIntVector ClusterKey = GetClusterKey(Positions[i]);
+        ScratchCellKeys[i] = ClusterKey;
+
+        FEntityCellEntry* Entry = EntityCells.Find(Entities[i]);
+        if (!Entry)
+        {
+            EntityCells.Add(Entities[i], { ClusterKey, UpdateStamp });
+            DirtyCells.Add(ClusterKey);
+            continue;
+        }
+
+        if (Entry->Cell != ClusterKey)
+        {
+            DirtyCells.Add(Entry->Cell);
+            DirtyCells.Add(ClusterKey);
+            Entry->Cell = ClusterKey;
+        }
+        Entry->Stamp = UpdateStamp;
+    }
+
+    // Detect entities that are gone
+    for (auto It = EntityCells.CreateIterator(); It; ++It)
+    {
+        if (It.Value().Stamp != UpdateStamp)
+        {
+            DirtyCells.Add(It.Value().Cell);
+            It.RemoveCurrent();
+        }
+    }
+
+    if (DirtyCells.IsEmpty())
+    {
+        return 0;
+    }
+
+    // Rebuild membership for dirty cells only
+    for (const FIntVector& Cell : DirtyCells)
+    {
+        FGSDCrowdCluster& Cluster = Clusters.FindOrAdd(Cell);
+        Cluster.CellKey = Cell;
+        Cluster.Entities.Reset();
+        Cluster.Positions.Reset();
+    }
+
+    for (int32 i = 0; i < Entities.Num(); i++)
+    {
+        if (DirtyCells.Contains(ScratchCellKeys[i]))
+        {
+            FGSDCrowdCluster& Cluster = Clusters.FindChecked(ScratchCellKeys[i]);
+            Cluster.Entities.Add(Entities[i]);
+            Cluster.Positions.Add(Positions[i]);
+        }
+    }
+
+    for (const FIntVector& Cell : DirtyCells)
+    {
+        FGSDCrowdCluster& Cluster = Clusters.FindChecked(Cell);
+        if (Cluster.Entities.IsEmpty())
+        {
+            ReleaseProxyForCell(Cell);
+            Clusters.Remove(Cell);
+            continue;
+        }
+
+        FinalizeCluster(Cluster);
+        RefreshProxyForCluster(Cluster, World);
     }
 
-    // Calculate cluster centers and radii
-    for (auto& Pair : Clusters)
+    return DirtyCells.Num();
+}
+
+void UGSDCrowdHLODManager::RefreshProxyForCluster(const FGSDCrowdCluster& Cluster, UWorld* World)
+{
+    if (!World)
     {
-        FGSDCrowdCluster& Cluster = Pair.Value;
+        return;
+    }
 
-        // Calculate cluster center
-        FVector Sum = FVector::ZeroVector;
-        for (int32 i = 0; i < Cluster.Entities.Num(); i++)
+    // Reuse the cell's existing proxy
+    if (TObjectPtr<AGSDCrowdHLODProxy>* Existing = CellProxies.Find(Cluster.CellKey))
+    {
+        if (AGSDCrowdHLODProxy* Proxy = *Existing)
         {
-            // Find index in original arrays
-            int32 EntityIndex = Entities.Find(Cluster.Entities[i]);
-            if (EntityIndex != INDEX_NONE)
-            {
-                Sum += Positions[EntityIndex];
-            }
+            Proxy->InitializeCluster(Cluster.Center, Cluster.EntityCount, Cluster.Radius);
+            return;
         }
-        Cluster.Center = Sum / Cluster.EntityCount;
+        CellProxies.Remove(Cluster.CellKey);
+    }
 
-        // Calculate radius
-        float MaxDist = 0.0f;
-        for (int32 i = 0; i < Cluster.Entities.Num(); i++)
+    // Take a pooled proxy from the same world
+    while (PooledProxies.Num() > 0 && ActiveProxies.Num() < MaxProxies)
+    {
+        AGSDCrowdHLODProxy* Proxy = PooledProxies.Pop();
+        if (!Proxy)
+        {
+            continue;
+        }
+        if (Proxy->GetWorld() != World)
         {
-            int32 EntityIndex = Entities.Find(Cluster.Entities[i]);
-            if (EntityIndex != INDEX_NONE)
-            {
-                float Dist = FVector::Dist(Cluster.Center, Positions[EntityIndex]);
-                MaxDist = FMath::Max(MaxDist, Dist);
-            }
+            Proxy->Destroy();
+            continue;
         }
-        Cluster.Radius = MaxDist;
 
-        // Create proxy
-        CreateHLODProxy(Cluster, World);
+        Proxy->InitializeCluster(Cluster.Center, Cluster.EntityCount, Cluster.Radius);
+        Proxy->SetActorHiddenInGame(false);
+        ActiveProxies.Add(Proxy);
+        CellProxies.Add(Cluster.CellKey, Proxy);
+        return;
+    }
+
+    // Pool empty - spawn a new one
+    if (AGSDCrowdHLODProxy* Proxy = CreateHLODProxy(Cluster, World))
+    {
+        CellProxies.Add(Cluster.CellKey, Proxy);
+    }
+}
+
+void UGSDCrowdHLODManager::ReleaseProxyForCell(const FIntVector& CellKey)
+{
+    TObjectPtr<AGSDCrowdHLODProxy> Proxy;
+    if (!CellProxies.RemoveAndCopyValue(CellKey, Proxy) || !Proxy)
+    {
+        return;
     }
+
+    ActiveProxies.RemoveSingleSwap(Proxy);
+    Proxy->SetActorHiddenInGame(true);
+    PooledProxies.Add(Proxy);
 }
 
 AGSDCrowdHLODProxy* UGSDCrowdHLODManager::CreateHLODProxy(const FGSDCrowdCluster& Cluster, UWorld* World)
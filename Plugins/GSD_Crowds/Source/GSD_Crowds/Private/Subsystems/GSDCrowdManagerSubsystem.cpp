@@ -2,7 +2,10 @@
 
 #include "Subsystems/GSDCrowdManagerSubsystem.h"
 #include "DataAssets/GSDCrowdEntityConfig.h"
+#include "DataAssets/GSDCrowdConfig.h"
 #include "Fragments/GSDZombieStateFragment.h"
+#include "Fragments/GSDZombieMovementFragment.h"
+#include "Fragments/GSDNavigationFragment.h"
 #include "MassCommonFragments.h"
 #include "MassSpawner.h"
 #include "GSDCrowdLog.h"
@@ -12,6 +15,8 @@
 #include "MassEntitySubsystem.h"
 #include "Engine/Engine.h"
 #include "ProfilingDebugging/ScopedTimers.h"
+#include "Async/Async.h"
+#include "TimerManager.h"
 
 bool UGSDCrowdManagerSubsystem::ShouldCreateSubsystem(UWorld* World) const
 {
@@ -23,10 +28,10 @@ void UGSDCrowdManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
 
-    // Get World Partition subsystem reference
-    if (UWorld* World = GetWorld())
+    // Get World Partition subsystem reference (initialized first; null in non-partitioned worlds)
+    if (GetWorld())
     {
-        WorldPartitionSubsystem = World->GetSubsystem<UWorldPartitionSubsystem>();
+        WorldPartitionSubsystem = Collection.InitializeDependency<UWorldPartitionSubsystem>();
 
         // Bind to streaming events
         BindToStreamingEvents();
@@ -38,6 +43,26 @@ void UGSDCrowdManagerSubsystem::Deinitialize()
     // Unbind from streaming events
     UnbindFromStreamingEvents();
 
+    // Cancel in-flight async spawns; background transform tasks own their buffers
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(AsyncSpawnTimerHandle);
+    }
+    if (AsyncSpawnQueue.Num() > 0)
+    {
+        UE_LOG(LOG_GSDCROWDS, Log, TEXT("Cancelled %d pending async crowd spawns"), AsyncSpawnQueue.Num());
+
+        TArray<FGSDAsyncSpawnRequest> CancelledRequests = MoveTemp(AsyncSpawnQueue);
+        AsyncSpawnQueue.Reset();
+        for (const FGSDAsyncSpawnRequest& Request : CancelledRequests)
+        {
+            FinishAsyncSpawn(Request, true);
+        }
+
+        // Nothing queued from a callback may outlive the subsystem
+        AsyncSpawnQueue.Empty();
+    }
+
     Super::Deinitialize();
 }
 
@@ -47,56 +72,274 @@ int32 UGSDCrowdManagerSubsystem::SpawnEntities(int32 Count, FVector Center, floa
     if (!IsPositionInLoadedCell(Center))
     {
         // Queue for when cell loads
-        FName CellName = GetCellNameForPosition(Center);
-        PendingSpawnCenters.Add(Center);
-
-        UE_LOG(LOG_GSDCROWDS, Verbose,
-            TEXT("Queueing spawn for unloaded cell: %s (count=%d)"), *CellName.ToString(), Count);
+        QueuePendingCellSpawn(Count, Center, Radius, EntityConfig);
         return 0;  // Will spawn when cell loads
     }
 
-    // Proceed with spawn
-    int32 NumSpawned = SpawnEntitiesInternal(Count, Center, Radius, EntityConfig);
+    // Proceed with spawn (entities are tracked per cell by SpawnEntitiesInternal)
+    return SpawnEntitiesInternal(Count, Center, Radius, EntityConfig);
+}
 
-    // Track which cell this crowd belongs to
-    if (NumSpawned > 0)
+int32 UGSDCrowdManagerSubsystem::SpawnEntitiesAsync(int32 Count, FVector Center, float Radius, UGSDCrowdEntityConfig* EntityConfig, const FOnCrowdSpawnComplete& OnComplete)
+{
+    // Nothing to stream in, or the cell is unloaded: the synchronous path handles (and queues) these
+    if (Count <= 0 || !GetWorld() || !IsPositionInLoadedCell(Center))
     {
-        FName CellName = GetCellNameForPosition(Center);
-        // TODO: Track entity IDs when entity ID system is implemented (GSDCROWDS-108)
-        // CellToCrowdMapping.FindOrAdd(CellName).Append(SpawnedEntityIds);
+        const int32 NumSpawned = Count > 0 ? SpawnEntities(Count, Center, Radius, EntityConfig) : 0;
+        OnComplete.ExecuteIfBound(NumSpawned);
+        return INDEX_NONE;
     }
 
-    return NumSpawned;
+    // Use provided config or load default
+    if (!EntityConfig)
+    {
+        EntityConfig = GetDefaultEntityConfig();
+    }
+
+    if (!EntityConfig)
+    {
+        UE_LOG(LOG_GSDCROWDS, Error, TEXT("SpawnEntitiesAsync: No entity config available"));
+        OnComplete.ExecuteIfBound(0);
+        return INDEX_NONE;
+    }
+
+    FGSDAsyncSpawnRequest& Request = AsyncSpawnQueue.AddDefaulted_GetRef();
+    Request.RequestId = NextAsyncSpawnRequestId++;
+    Request.Count = Count;
+    Request.Center = Center;
+    Request.Radius = Radius;
+    Request.EntityConfig = EntityConfig;
+    Request.OnComplete = OnComplete;
+    Request.SpawnTransforms = MakeShared<FGSDAsyncSpawnTransforms, ESPMode::ThreadSafe>();
+
+    // Seed is drawn on the game thread so async spawns stay deterministic
+    const int32 Seed = DrawAsyncSpawnSeed();
+
+    // Generate transforms off the game thread; the task holds its own buffer reference,
+    // so it stays valid if the request is cancelled before the task finishes
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Buffer = Request.SpawnTransforms, Count, Center, Radius, Seed]()
+    {
+        FRandomStream Stream(Seed);
+        GenerateSpawnTransformsFromStream(Count, Center, Radius, Stream, Buffer->Transforms);
+        Buffer->bReady.store(true, std::memory_order_release);
+    });
+
+    ScheduleAsyncSpawnTick();
+
+    UE_LOG(LOG_GSDCROWDS, Verbose, TEXT("Queued async spawn %d: %d entities at %s (radius=%.1f)"),
+        Request.RequestId, Count, *Center.ToString(), Radius);
+
+    return Request.RequestId;
 }
 
-void UGSDCrowdManagerSubsystem::SpawnEntitiesAsync(int32 Count, FVector Center, float Radius, UGSDCrowdEntityConfig* EntityConfig, const FOnCrowdSpawnComplete& OnComplete)
+float UGSDCrowdManagerSubsystem::GetAsyncSpawnProgress(int32 RequestId) const
 {
-    // NOTE: Async spawning with loading screen support is tracked in GSDCROWDS-104
-    // Current implementation spawns synchronously - acceptable for Phase 6 scope
-    int32 NumSpawned = SpawnEntities(Count, Center, Radius, EntityConfig);
+    const FGSDAsyncSpawnRequest* Request = AsyncSpawnQueue.FindByPredicate([RequestId](const FGSDAsyncSpawnRequest& Queued)
+    {
+        return Queued.RequestId == RequestId;
+    });
 
-    if (OnComplete.IsBound())
+    if (!Request || Request->Count <= 0)
     {
-        OnComplete.Execute(NumSpawned);
+        return 1.0f;
     }
+
+    return static_cast<float>(Request->NextTransformIndex) / Request->Count;
 }
 
-void UGSDCrowdManagerSubsystem::DespawnAllEntities()
+bool UGSDCrowdManagerSubsystem::CancelAsyncSpawn(int32 RequestId)
 {
-    if (SpawnedEntityHandles.Num() == 0)
+    const int32 Index = AsyncSpawnQueue.IndexOfByPredicate([RequestId](const FGSDAsyncSpawnRequest& Queued)
     {
-        UE_LOG(LOG_GSDCROWDS, Log, TEXT("DespawnAllEntities: No entities to despawn"));
+        return Queued.RequestId == RequestId;
+    });
+
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // Move out before the callback, which may queue or cancel other requests
+    const FGSDAsyncSpawnRequest Cancelled = MoveTemp(AsyncSpawnQueue[Index]);
+    AsyncSpawnQueue.RemoveAt(Index);
+
+    UE_LOG(LOG_GSDCROWDS, Log, TEXT("Async spawn %d cancelled after %d of %d crowd entities"),
+        Cancelled.RequestId, Cancelled.NumSpawned, Cancelled.Count);
+
+    FinishAsyncSpawn(Cancelled, true);
+    return true;
+}
+
+void UGSDCrowdManagerSubsystem::FinishAsyncSpawn(const FGSDAsyncSpawnRequest& Request, bool bCancelled)
+{
+    Request.OnComplete.ExecuteIfBound(Request.NumSpawned);
+    CrowdSpawnFinishedDelegate.Broadcast(Request.RequestId, Request.NumSpawned, bCancelled);
+}
+
+int32 UGSDCrowdManagerSubsystem::GetAsyncSpawnBatchSize()
+{
+    const UGSDCrowdConfig* Config = UGSDCrowdConfig::GetDefaultConfig();
+    return FMath::Max(1, Config ? Config->EntitiesPerBatch : DefaultEntitiesPerBatch);
+}
+
+FMassEntityManager* UGSDCrowdManagerSubsystem::GetEntityManager() const
+{
+#if WITH_DEV_AUTOMATION_TESTS
+    if (EntityManagerOverride.IsValid())
+    {
+        return EntityManagerOverride.Get();
+    }
+#endif
+
+    UWorld* World = GetWorld();
+    UMassEntitySubsystem* MassSubsystem = World ? World->GetSubsystem<UMassEntitySubsystem>() : nullptr;
+    return MassSubsystem ? &MassSubsystem->GetMutableEntityManager() : nullptr;
+}
+
+void UGSDCrowdManagerSubsystem::SpawnEntityBatch(UGSDCrowdEntityConfig* EntityConfig, const TArray<FTransform>& Transforms, TArray<FMassEntityHandle>& OutEntities)
+{
+#if WITH_DEV_AUTOMATION_TESTS
+    if (SpawnBatchOverride)
+    {
+        SpawnBatchOverride(EntityConfig, Transforms, OutEntities);
         return;
     }
+#endif
 
     UWorld* World = GetWorld();
-    if (!World)
+    if (UMassEntitySubsystem* MassSubsystem = World ? World->GetSubsystem<UMassEntitySubsystem>() : nullptr)
+    {
+        MassSubsystem->SpawnEntities(EntityConfig, Transforms, OutEntities);
+    }
+}
+
+void UGSDCrowdManagerSubsystem::ScheduleAsyncSpawnTick()
+{
+    if (AsyncSpawnTimerHandle.IsValid())
+    {
+        return;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        AsyncSpawnTimerHandle = World->GetTimerManager().SetTimerForNextTick(this, &UGSDCrowdManagerSubsystem::ProcessAsyncSpawnQueue);
+    }
+}
+
+void UGSDCrowdManagerSubsystem::ProcessAsyncSpawnQueue()
+{
+    AsyncSpawnTimerHandle.Invalidate();
+
+    FMassEntityManager* EntityManager = GetEntityManager();
+    if (!EntityManager)
+    {
+        UE_LOG(LOG_GSDCROWDS, Error, TEXT("ProcessAsyncSpawnQueue: Mass Entity subsystem not found, failing %d requests"),
+            AsyncSpawnQueue.Num());
+
+        TArray<FGSDAsyncSpawnRequest> FailedRequests = MoveTemp(AsyncSpawnQueue);
+        AsyncSpawnQueue.Reset();
+        for (const FGSDAsyncSpawnRequest& Request : FailedRequests)
+        {
+            FinishAsyncSpawn(Request, true);
+        }
+        return;
+    }
+
+    const UGSDCrowdConfig* Config = UGSDCrowdConfig::GetDefaultConfig();
+    const int32 BatchSize = GetAsyncSpawnBatchSize();
+    const double BudgetSeconds = (Config ? Config->ProcessingFrameBudget : DefaultSpawnFrameBudgetMs) / 1000.0;
+
+    const double StartTime = FPlatformTime::Seconds();
+    bool bSpawnedBatch = false;
+
+    TArray<FTransform> BatchTransforms;
+    TArray<FMassEntityHandle> NewEntityHandles;
+    BatchTransforms.Reserve(BatchSize);
+
+    while (AsyncSpawnQueue.Num() > 0)
+    {
+        // Always spawn at least one batch per frame so large requests make progress
+        if (bSpawnedBatch && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            break;
+        }
+
+        // Re-fetched every pass: the delegates below may queue or cancel requests and reallocate the queue
+        FGSDAsyncSpawnRequest& Request = AsyncSpawnQueue[0];
+
+        // Transforms still being generated; requests complete in order, so wait for this one
+        if (!Request.SpawnTransforms->bReady.load(std::memory_order_acquire))
+        {
+            break;
+        }
+
+        const int32 NumTransforms = Request.SpawnTransforms->Transforms.Num();
+        const int32 NumInBatch = FMath::Min(BatchSize, NumTransforms - Request.NextTransformIndex);
+        if (NumInBatch > 0)
+        {
+            BatchTransforms.Reset();
+            BatchTransforms.Append(Request.SpawnTransforms->Transforms.GetData() + Request.NextTransformIndex, NumInBatch);
+
+            NewEntityHandles.Reset();
+            SpawnEntityBatch(Request.EntityConfig, BatchTransforms, NewEntityHandles);
+
+            // Restored entities pick up their hibernated state
+            if (Request.RestoreStates.Num() > 0)
+            {
+                ApplyRestoreStates(*EntityManager, MakeArrayView(Request.RestoreStates.GetData() + Request.NextTransformIndex, NumInBatch), NewEntityHandles);
+            }
+
+            // Track spawned entities
+            TrackCellEntities(Request.Center, Request.EntityConfig, NewEntityHandles);
+
+            Request.NextTransformIndex += NumInBatch;
+            Request.NumSpawned += NewEntityHandles.Num();
+            bSpawnedBatch = true;
+        }
+
+        // Capture progress and retire a finished request before any delegate runs; Request is
+        // not touched after this point
+        const int32 RequestId = Request.RequestId;
+        const int32 NumProcessed = Request.NextTransformIndex;
+        const int32 NumRequested = Request.Count;
+
+        TOptional<FGSDAsyncSpawnRequest> Completed;
+        if (NumProcessed >= NumTransforms)
+        {
+            Completed.Emplace(MoveTemp(Request));
+            AsyncSpawnQueue.RemoveAt(0);
+        }
+
+        if (NumInBatch > 0)
+        {
+            CrowdSpawnProgressDelegate.Broadcast(RequestId, NumProcessed, NumRequested);
+        }
+
+        if (Completed.IsSet())
+        {
+            UE_LOG(LOG_GSDCROWDS, Log, TEXT("Async spawn %d complete: %d crowd entities at center %s with radius %.1f"),
+                Completed->RequestId, Completed->NumSpawned, *Completed->Center.ToString(), Completed->Radius);
+
+            FinishAsyncSpawn(Completed.GetValue(), false);
+        }
+    }
+
+    if (AsyncSpawnQueue.Num() > 0)
     {
+        ScheduleAsyncSpawnTick();
+    }
+}
+
+void UGSDCrowdManagerSubsystem::DespawnAllEntities()
+{
+    if (SpawnedEntityHandles.Num() == 0)
+    {
+        UE_LOG(LOG_GSDCROWDS, Log, TEXT("DespawnAllEntities: No entities to despawn"));
         return;
     }
 
-    UMassEntitySubsystem* MassSubsystem = World->GetSubsystem<UMassEntitySubsystem>();
-    if (!MassSubsystem)
+    FMassEntityManager* EntityManager = GetEntityManager();
+    if (!EntityManager)
     {
         return;
     }
@@ -104,10 +347,14 @@ void UGSDCrowdManagerSubsystem::DespawnAllEntities()
     // CRITICAL: Use Defer() for thread-safe entity destruction
     // See RESEARCH.md Pitfall 2 for details
     // Direct destruction during processing causes crashes
-    MassSubsystem->Defer().DestroyEntities(SpawnedEntityHandles);
+    EntityManager->Defer().DestroyEntities(SpawnedEntityHandles);
 
     const int32 NumDespawned = SpawnedEntityHandles.Num();
     SpawnedEntityHandles.Empty();
+    CellToCrowdMapping.Empty();
+    TrackedEntitySlots.Empty();
+    HibernatedCells.Empty();
+    NumHibernatedEntities = 0;
 
     UE_LOG(LOG_GSDCROWDS, Log, TEXT("Despawned %d crowd entities"), NumDespawned);
 
@@ -202,10 +449,54 @@ TArray<FTransform> UGSDCrowdManagerSubsystem::GenerateSpawnTransforms(int32 Coun
     return Transforms;
 }
 
+int32 UGSDCrowdManagerSubsystem::DrawAsyncSpawnSeed() const
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UGameInstance* GameInstance = World->GetGameInstance())
+        {
+            if (UGSDDeterminismManager* DeterminismManager = GameInstance->GetSubsystem<UGSDDeterminismManager>())
+            {
+                FRandomStream& SpawnStream = DeterminismManager->GetCategoryStream(UGSDDeterminismManager::CrowdSpawnCategory);
+                const int32 Seed = SpawnStream.RandHelper(MAX_int32);
+                DeterminismManager->RecordRandomCall(UGSDDeterminismManager::CrowdSpawnCategory, static_cast<float>(Seed));
+                return Seed;
+            }
+        }
+    }
+
+    // Fallback to seeded random for determinism even without manager
+    static FRandomStream FallbackSeedStream(67892);
+    return FallbackSeedStream.RandHelper(MAX_int32);
+}
+
+void UGSDCrowdManagerSubsystem::GenerateSpawnTransformsFromStream(int32 Count, FVector Center, float Radius, FRandomStream& Stream, TArray<FTransform>& OutTransforms)
+{
+    OutTransforms.Reset(Count);
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        // Random position within circular area
+        const float Angle = Stream.FRand() * 2.0f * PI;
+        const float Distance = Stream.FRand() * Radius;
+        const FVector SpawnLocation = Center + FVector(FMath::Cos(Angle) * Distance, FMath::Sin(Angle) * Distance, 0.0f);
+
+        // Random rotation (yaw only for ground-based entities)
+        const FRotator SpawnRotation(0.0f, Stream.FRandRange(0.0f, 360.0f), 0.0f);
+
+        OutTransforms.Emplace(SpawnRotation.Quaternion(), SpawnLocation, FVector::OneVector);
+    }
+}
+
 void UGSDCrowdManagerSubsystem::AddDensityModifier(FGameplayTag ModifierTag, FVector Center, float Radius, float Multiplier)
 {
     // Remove existing modifier with same tag (replacement behavior)
-    RemoveDensityModifier(ModifierTag);
+    const int32 ReplacedCount = RemoveDensityModifiersWithTag(ModifierTag);
+    if (ReplacedCount > 0)
+    {
+        UE_LOG(LOG_GSDCROWDS, Log, TEXT("Removed density modifier %s (%d instances)"),
+            *ModifierTag.ToString(), ReplacedCount);
+    }
 
     FGSDensityModifier NewModifier;
     NewModifier.ModifierTag = ModifierTag;
@@ -214,6 +505,7 @@ void UGSDCrowdManagerSubsystem::AddDensityModifier(FGameplayTag ModifierTag, FVe
     NewModifier.Multiplier = Multiplier;
 
     ActiveDensityModifiers.Add(NewModifier);
+    RebuildDensityModifierIndex();
 
     UE_LOG(LOG_GSDCROWDS, Log, TEXT("Added density modifier %s at %s (radius=%.0f, mult=%.2f)"),
         *ModifierTag.ToString(), *Center.ToString(), Radius, Multiplier);
@@ -221,35 +513,137 @@ void UGSDCrowdManagerSubsystem::AddDensityModifier(FGameplayTag ModifierTag, FVe
 
 void UGSDCrowdManagerSubsystem::RemoveDensityModifier(FGameplayTag ModifierTag)
 {
-    int32 RemovedCount = ActiveDensityModifiers.RemoveAll([ModifierTag](const FGSDensityModifier& Mod)
-    {
-        return Mod.ModifierTag == ModifierTag;
-    });
+    int32 RemovedCount = RemoveDensityModifiersWithTag(ModifierTag);
 
     if (RemovedCount > 0)
     {
+        RebuildDensityModifierIndex();
+
         UE_LOG(LOG_GSDCROWDS, Log, TEXT("Removed density modifier %s (%d instances)"),
             *ModifierTag.ToString(), RemovedCount);
     }
 }
 
-float UGSDCrowdManagerSubsystem::GetDensityMultiplierAtLocation(FVector Location) const
+int32 UGSDCrowdManagerSubsystem::RemoveDensityModifiersWithTag(FGameplayTag ModifierTag)
 {
-    float CombinedMultiplier = 1.0f;
+    return ActiveDensityModifiers.RemoveAll([ModifierTag](const FGSDensityModifier& Mod)
+    {
+        return Mod.ModifierTag == ModifierTag;
+    });
+}
 
-    for (const FGSDensityModifier& Modifier : ActiveDensityModifiers)
+void UGSDCrowdManagerSubsystem::RebuildDensityModifierIndex()
+{
+    DensityModifierGrid.Reset();
+    UnindexedDensityModifiers.Reset();
+
+    for (int32 ModifierIndex = 0; ModifierIndex < ActiveDensityModifiers.Num(); ++ModifierIndex)
+    {
+        const FGSDensityModifier& Modifier = ActiveDensityModifiers[ModifierIndex];
+        const float Radius = FMath::Max(0.0f, Modifier.Radius);
+
+        // XY bounds are conservative for the 3D radius test done at query time
+        const int32 MinX = FMath::FloorToInt((Modifier.Center.X - Radius) / DensityModifierCellSize);
+        const int32 MaxX = FMath::FloorToInt((Modifier.Center.X + Radius) / DensityModifierCellSize);
+        const int32 MinY = FMath::FloorToInt((Modifier.Center.Y - Radius) / DensityModifierCellSize);
+        const int32 MaxY = FMath::FloorToInt((Modifier.Center.Y + Radius) / DensityModifierCellSize);
+
+        const int64 NumCells = static_cast<int64>(MaxX - MinX + 1) * (MaxY - MinY + 1);
+        if (NumCells > MaxDensityModifierIndexCells)
+        {
+            UnindexedDensityModifiers.Add(ModifierIndex);
+            continue;
+        }
+
+        for (int32 X = MinX; X <= MaxX; ++X)
+        {
+            for (int32 Y = MinY; Y <= MaxY; ++Y)
+            {
+                // Modifiers are visited in order, so each cell list stays ascending
+                DensityModifierGrid.FindOrAdd(MakeCellKey(X, Y)).Add(ModifierIndex);
+            }
+        }
+    }
+}
+
+float UGSDCrowdManagerSubsystem::ApplyDensityModifiers(const FVector& Location, TConstArrayView<int32> ModifierIndices, float Multiplier) const
+{
+    for (const int32 ModifierIndex : ModifierIndices)
     {
+        const FGSDensityModifier& Modifier = ActiveDensityModifiers[ModifierIndex];
         float DistanceSq = FVector::DistSquared(Location, Modifier.Center);
         float RadiusSq = Modifier.Radius * Modifier.Radius;
 
         if (DistanceSq <= RadiusSq)
         {
             // Inside modifier radius - apply multiplier
-            CombinedMultiplier *= Modifier.Multiplier;
+            Multiplier *= Modifier.Multiplier;
+        }
+    }
+
+    return Multiplier;
+}
+
+float UGSDCrowdManagerSubsystem::GetDensityMultiplierAtLocation(FVector Location) const
+{
+    float CombinedMultiplier = 1.0f;
+
+    if (ActiveDensityModifiers.Num() == 0)
+    {
+        return CombinedMultiplier;
+    }
+
+    const int64 CellKey = MakeCellKey(
+        FMath::FloorToInt(Location.X / DensityModifierCellSize),
+        FMath::FloorToInt(Location.Y / DensityModifierCellSize));
+
+    if (const TArray<int32>* CellModifiers = DensityModifierGrid.Find(CellKey))
+    {
+        CombinedMultiplier = ApplyDensityModifiers(Location, *CellModifiers, CombinedMultiplier);
+    }
+
+    return ApplyDensityModifiers(Location, UnindexedDensityModifiers, CombinedMultiplier);
+}
+
+void UGSDCrowdManagerSubsystem::GetDensityMultipliersAtLocations(TConstArrayView<FVector> Locations, TArrayView<float> OutMultipliers) const
+{
+    check(Locations.Num() == OutMultipliers.Num());
+
+    if (ActiveDensityModifiers.Num() == 0)
+    {
+        for (float& Multiplier : OutMultipliers)
+        {
+            Multiplier = 1.0f;
         }
+        return;
     }
 
-    return CombinedMultiplier;
+    // Spawn points cluster, so cache the last cell's modifier list
+    int64 LastKey = 0;
+    const TArray<int32>* LastCellModifiers = nullptr;
+    bool bHasLast = false;
+
+    for (int32 i = 0; i < Locations.Num(); ++i)
+    {
+        const FVector& Location = Locations[i];
+        const int64 Key = MakeCellKey(
+            FMath::FloorToInt(Location.X / DensityModifierCellSize),
+            FMath::FloorToInt(Location.Y / DensityModifierCellSize));
+
+        if (!bHasLast || Key != LastKey)
+        {
+            LastKey = Key;
+            LastCellModifiers = DensityModifierGrid.Find(Key);
+            bHasLast = true;
+        }
+
+        float CombinedMultiplier = 1.0f;
+        if (LastCellModifiers)
+        {
+            CombinedMultiplier = ApplyDensityModifiers(Location, *LastCellModifiers, CombinedMultiplier);
+        }
+        OutMultipliers[i] = ApplyDensityModifiers(Location, UnindexedDensityModifiers, CombinedMultiplier);
+    }
 }
 
 //-- Network Validation (GSDNETWORK-107) --
@@ -359,24 +753,86 @@ FName UGSDCrowdManagerSubsystem::GetCellNameForPosition(const FVector& Position)
 {
     // Calculate cell name from position using grid cell size
     // World Partition uses 12800.0f (128m) cells by default
-    static constexpr float CellSize = 12800.0f;
-
-    const int32 CellX = FMath::FloorToInt(Position.X / CellSize);
-    const int32 CellY = FMath::FloorToInt(Position.Y / CellSize);
+    const int32 CellX = FMath::FloorToInt(Position.X / StreamingCellSize);
+    const int32 CellY = FMath::FloorToInt(Position.Y / StreamingCellSize);
 
     return FName(*FString::Printf(TEXT("Cell_%d_%d"), CellX, CellY));
 }
 
+int64 UGSDCrowdManagerSubsystem::GetCellKeyForPosition(const FVector& Position) const
+{
+    const int32 CellX = FMath::FloorToInt(Position.X / StreamingCellSize);
+    const int32 CellY = FMath::FloorToInt(Position.Y / StreamingCellSize);
+
+    return MakeCellKey(CellX, CellY);
+}
+
 bool UGSDCrowdManagerSubsystem::IsPositionInLoadedCell(const FVector& Position) const
 {
     // If no World Partition subsystem, always allow spawning
-    if (!WorldPartitionSubsystem.IsValid())
+    if (!IsCellStreamingActive())
     {
         return true;
     }
 
-    const FName CellName = GetCellNameForPosition(Position);
-    return LoadedCellNames.Contains(CellName);
+    // Integer key lookup - no FName construction on the per-entity path
+    return LoadedCellKeys.Contains(GetCellKeyForPosition(Position));
+}
+
+void UGSDCrowdManagerSubsystem::ArePositionsInLoadedCells(TConstArrayView<FVector> Positions, TBitArray<>& OutLoaded) const
+{
+    const int32 NumPositions = Positions.Num();
+
+    // If no World Partition subsystem, everything is considered loaded
+    if (!IsCellStreamingActive())
+    {
+        OutLoaded.Init(true, NumPositions);
+        return;
+    }
+
+    OutLoaded.Init(false, NumPositions);
+
+    // Entities in a chunk tend to be spatially coherent, so cache the last cell result
+    int64 LastKey = 0;
+    bool bLastLoaded = false;
+    bool bHasLast = false;
+
+    for (int32 i = 0; i < NumPositions; ++i)
+    {
+        const int64 Key = GetCellKeyForPosition(Positions[i]);
+        if (!bHasLast || Key != LastKey)
+        {
+            LastKey = Key;
+            bLastLoaded = LoadedCellKeys.Contains(Key);
+            bHasLast = true;
+        }
+
+        if (bLastLoaded)
+        {
+            OutLoaded[i] = true;
+        }
+    }
+}
+
+bool UGSDCrowdManagerSubsystem::TryParseCellKey(const FName& CellName, int64& OutKey)
+{
+    // Expected format: Cell_X_Y (matches GetCellNameForPosition)
+    const FString NameString = CellName.ToString();
+    if (!NameString.StartsWith(TEXT("Cell_")))
+    {
+        return false;
+    }
+
+    FString XString;
+    FString YString;
+    if (!NameString.RightChop(5).Split(TEXT("_"), &XString, &YString)
+        || !XString.IsNumeric() || !YString.IsNumeric())
+    {
+        return false;
+    }
+
+    OutKey = MakeCellKey(FCString::Atoi(*XString), FCString::Atoi(*YString));
+    return true;
 }
 
 void UGSDCrowdManagerSubsystem::BindToStreamingEvents()
@@ -393,6 +849,7 @@ void UGSDCrowdManagerSubsystem::UnbindFromStreamingEvents()
 {
     UE_LOG(LOG_GSDCROWDS, Log, TEXT("CrowdManager: Streaming event unbinding"));
     LoadedCellNames.Empty();
+    LoadedCellKeys.Empty();
 }
 
 void UGSDCrowdManagerSubsystem::OnCellLoaded(const FName& CellName)
@@ -402,27 +859,30 @@ void UGSDCrowdManagerSubsystem::OnCellLoaded(const FName& CellName)
     // Track loaded cell
     LoadedCellNames.Add(CellName);
 
-    // Process pending spawns for this cell
-    // Check pending spawn centers that belong to this cell
-    TArray<FVector> RemainingPendings;
-    for (const FVector& PendingCenter : PendingSpawnCenters)
+    int64 CellKey = 0;
+    if (!TryParseCellKey(CellName, CellKey))
     {
-        FName PendingCellName = GetCellNameForPosition(PendingCenter);
-        if (PendingCellName == CellName)
-        {
-            // This pending spawn belongs to the loaded cell
-            // TODO: Trigger spawn with stored parameters (GSDCROWDS-109)
-            UE_LOG(LOG_GSDCROWDS, Verbose,
-                TEXT("Would process pending spawn at %s for loaded cell %s"),
-                *PendingCenter.ToString(), *CellName.ToString());
-        }
-        else
+        return;  // Non-grid cells (e.g. DefaultCell) never hold pending spawns
+    }
+
+    LoadedCellKeys.Add(CellKey);
+
+    // Replay spawn requests stored while this cell was unloaded
+    FGSDPendingCellSpawnList PendingSpawns;
+    if (PendingSpawnsByCell.RemoveAndCopyValue(CellKey, PendingSpawns))
+    {
+        UE_LOG(LOG_GSDCROWDS, Log, TEXT("Replaying %d pending spawns for loaded cell %s"),
+            PendingSpawns.Spawns.Num(), *CellName.ToString());
+
+        // Time-sliced path so a cell full of crowds does not hitch the load frame
+        for (const FGSDPendingCellSpawn& Pending : PendingSpawns.Spawns)
         {
-            // Keep for later
-            RemainingPendings.Add(PendingCenter);
+            SpawnEntitiesAsync(Pending.Count, Pending.Center, Pending.Radius, Pending.EntityConfig, FOnCrowdSpawnComplete());
         }
     }
-    PendingSpawnCenters = RemainingPendings;
+
+    // Bring back entities hibernated when this cell unloaded
+    RestoreHibernatedCell(CellKey);
 }
 
 void UGSDCrowdManagerSubsystem::OnCellUnloaded(const FName& CellName)
@@ -432,17 +892,395 @@ void UGSDCrowdManagerSubsystem::OnCellUnloaded(const FName& CellName)
     // Remove from loaded set
     LoadedCellNames.Remove(CellName);
 
-    // Despawn crowds in this cell
-    if (TArray<int32>* CrowdIds = CellToCrowdMapping.Find(CellName))
+    int64 CellKey = 0;
+    if (!TryParseCellKey(CellName, CellKey))
+    {
+        return;  // Non-grid cells (e.g. DefaultCell) never own crowd entities
+    }
+
+    LoadedCellKeys.Remove(CellKey);
+
+    // Async spawns still streaming into this cell go back to pending (restores back to hibernation)
+    TArray<FGSDAsyncSpawnRequest> CancelledRequests;
+    for (int32 i = AsyncSpawnQueue.Num() - 1; i >= 0; --i)
     {
-        // TODO: Despawn specific entities by ID when entity ID system is implemented (GSDCROWDS-108)
-        // For now, we just clear the mapping
-        UE_LOG(LOG_GSDCROWDS, Verbose,
-            TEXT("Would despawn %d crowd entities in cell %s"),
-            CrowdIds->Num(), *CellName.ToString());
+        FGSDAsyncSpawnRequest& Request = AsyncSpawnQueue[i];
+        if (GetCellKeyForPosition(Request.Center) != CellKey)
+        {
+            continue;
+        }
+
+        const int32 Remaining = Request.Count - Request.NextTransformIndex;
+        if (Remaining > 0 && Request.RestoreStates.Num() > 0)
+        {
+            // Unrestored records go straight back into hibernation
+            FGSDHibernatedCrowd RemainingCrowd;
+            RemainingCrowd.EntityConfig = Request.EntityConfig;
+            RemainingCrowd.Entities.Append(Request.RestoreStates.GetData() + Request.NextTransformIndex, Remaining);
+            HibernatedCells.FindOrAdd(CellKey).Crowds.Add(MoveTemp(RemainingCrowd));
+            NumHibernatedEntities += Remaining;
+        }
+        else if (Remaining > 0)
+        {
+            QueuePendingCellSpawn(Remaining, Request.Center, Request.Radius, Request.EntityConfig);
+        }
+
+        CancelledRequests.Add(MoveTemp(Request));
+        AsyncSpawnQueue.RemoveAt(i);
+    }
+
+    // Callbacks run once the queue is consistent; they may queue or cancel other requests
+    for (const FGSDAsyncSpawnRequest& Cancelled : CancelledRequests)
+    {
+        FinishAsyncSpawn(Cancelled, true);
+    }
 
-        CellToCrowdMapping.Remove(CellName);
+    // Entities now standing in this cell leave the simulation (hibernated unless disabled)
+    const UGSDCrowdConfig* Config = UGSDCrowdConfig::GetDefaultConfig();
+    const bool bHibernate = Config ? Config->bEnableCellHibernation : true;
+
+    const int32 NumReleased = ReleaseTrackedEntities([this, CellKey](const FMassEntityHandle&, const FVector& Location)
+    {
+        return GetCellKeyForPosition(Location) == CellKey;
+    }, bHibernate);
+
+    if (NumReleased > 0)
+    {
+        UE_LOG(LOG_GSDCROWDS, Log, TEXT("%s %d crowd entities in unloaded cell %s"),
+            bHibernate ? TEXT("Hibernated") : TEXT("Despawned"), NumReleased, *CellName.ToString());
+    }
+}
+
+int32 UGSDCrowdManagerSubsystem::HibernateEntities(TConstArrayView<FMassEntityHandle> Entities)
+{
+    if (Entities.Num() == 0)
+    {
+        return 0;
+    }
+
+    // Slot index lookup per handle; cost scales with the request, not the crowd
+    return ReleaseEntities(Entities, true);
+}
+
+int32 UGSDCrowdManagerSubsystem::ReleaseTrackedEntities(TFunctionRef<bool(const FMassEntityHandle&, const FVector&)> ShouldRelease, bool bHibernate)
+{
+    FMassEntityManager* EntityManager = GetEntityManager();
+    if (!EntityManager)
+    {
+        return 0;
+    }
+
+    // Entities walk between cells, so every tracked position is tested; stale handles are collected too
+    TArray<FMassEntityHandle> Candidates;
+    for (const TPair<int64, FGSDCellCrowdList>& Pair : CellToCrowdMapping)
+    {
+        for (const FGSDCellCrowd& Crowd : Pair.Value.Crowds)
+        {
+            for (const FMassEntityHandle& Entity : Crowd.Entities)
+            {
+                const FDataFragment_Transform* Transform = EntityManager->IsEntityValid(Entity)
+                    ? EntityManager->GetFragmentDataPtr<FDataFragment_Transform>(Entity)
+                    : nullptr;
+
+                if (!Transform || ShouldRelease(Entity, Transform->GetTransform().GetLocation()))
+                {
+                    Candidates.Add(Entity);
+                }
+            }
+        }
+    }
+
+    return ReleaseEntities(Candidates, bHibernate);
+}
+
+int32 UGSDCrowdManagerSubsystem::ReleaseEntities(TConstArrayView<FMassEntityHandle> Entities, bool bHibernate)
+{
+    FMassEntityManager* EntityManager = GetEntityManager();
+    if (!EntityManager)
+    {
+        return 0;
+    }
+
+    TArray<FMassEntityHandle> ReleasedEntities;
+    for (const FMassEntityHandle& Entity : Entities)
+    {
+        if (ReleaseEntity(*EntityManager, Entity, bHibernate))
+        {
+            ReleasedEntities.Add(Entity);
+        }
+    }
+
+    if (ReleasedEntities.Num() == 0)
+    {
+        return 0;
+    }
+
+    // CRITICAL: Use Defer() for thread-safe entity destruction (see DespawnAllEntities)
+    EntityManager->Defer().DestroyEntities(ReleasedEntities);
+
+    // Give back slack from large unloads
+    if (SpawnedEntityHandles.GetSlack() > SpawnedEntityHandles.Num())
+    {
+        SpawnedEntityHandles.Shrink();
+    }
+
+    return ReleasedEntities.Num();
+}
+
+bool UGSDCrowdManagerSubsystem::ReleaseEntity(FMassEntityManager& EntityManager, const FMassEntityHandle& Entity, bool bHibernate)
+{
+    const FGSDTrackedEntitySlot* Slot = TrackedEntitySlots.Find(Entity);
+    if (!Slot)
+    {
+        return false;  // Not spawned by this subsystem (or already released)
+    }
+
+    const FDataFragment_Transform* Transform = EntityManager.IsEntityValid(Entity)
+        ? EntityManager.GetFragmentDataPtr<FDataFragment_Transform>(Entity)
+        : nullptr;
+
+    // Destroyed elsewhere; drop the stale handle
+    if (!Transform)
+    {
+        UntrackEntity(Entity);
+        return false;
+    }
+
+    const FGSDZombieMovementFragment* Movement = EntityManager.GetFragmentDataPtr<FGSDZombieMovementFragment>(Entity);
+    if (bHibernate && (!Movement || Movement->bIsAlive))
+    {
+        UGSDCrowdEntityConfig* EntityConfig = CellToCrowdMapping.FindChecked(Slot->CellKey).Crowds[Slot->CrowdIndex].EntityConfig;
+        const FVector Location = Transform->GetTransform().GetLocation();
+
+        TArray<FGSDHibernatedCrowd>& HibernatedCrowds = HibernatedCells.FindOrAdd(GetCellKeyForPosition(Location)).Crowds;
+        FGSDHibernatedCrowd* HibernatedCrowd = HibernatedCrowds.FindByPredicate([EntityConfig](const FGSDHibernatedCrowd& Existing)
+        {
+            return Existing.EntityConfig == EntityConfig;
+        });
+        if (!HibernatedCrowd)
+        {
+            HibernatedCrowd = &HibernatedCrowds.AddDefaulted_GetRef();
+            HibernatedCrowd->EntityConfig = EntityConfig;
+        }
+
+        FGSDHibernatedEntity& Record = HibernatedCrowd->Entities.AddDefaulted_GetRef();
+        Record.Location = Location;
+        Record.Yaw = Transform->GetTransform().Rotator().Yaw;
+        if (const FGSDZombieStateFragment* State = EntityManager.GetFragmentDataPtr<FGSDZombieStateFragment>(Entity))
+        {
+            Record.State = *State;
+        }
+        if (Movement)
+        {
+            Record.Movement = *Movement;
+            Record.Movement.ClearTarget();  // Entity indices do not survive hibernation
+            Record.Movement.ResetBehaviorTime();
+        }
+        if (const FGSDNavigationFragment* Navigation = EntityManager.GetFragmentDataPtr<FGSDNavigationFragment>(Entity))
+        {
+            Record.Lane = Navigation->CurrentLane;
+            Record.LanePosition = Navigation->LanePosition;
+        }
+        ++NumHibernatedEntities;
+    }
+
+    UntrackEntity(Entity);
+    return true;
+}
+
+void UGSDCrowdManagerSubsystem::UntrackEntity(const FMassEntityHandle& Entity)
+{
+    FGSDTrackedEntitySlot Slot;
+    if (!TrackedEntitySlots.RemoveAndCopyValue(Entity, Slot))
+    {
+        return;
+    }
+
+    // Swap-remove from each list, re-pointing the entity that moved into the hole
+    SpawnedEntityHandles.RemoveAtSwap(Slot.SpawnedIndex);
+    if (Slot.SpawnedIndex < SpawnedEntityHandles.Num())
+    {
+        TrackedEntitySlots.FindChecked(SpawnedEntityHandles[Slot.SpawnedIndex]).SpawnedIndex = Slot.SpawnedIndex;
+    }
+
+    TArray<FGSDCellCrowd>& Crowds = CellToCrowdMapping.FindChecked(Slot.CellKey).Crowds;
+    TArray<FMassEntityHandle>& CrowdEntities = Crowds[Slot.CrowdIndex].Entities;
+    CrowdEntities.RemoveAtSwap(Slot.EntityIndex);
+    if (Slot.EntityIndex < CrowdEntities.Num())
+    {
+        TrackedEntitySlots.FindChecked(CrowdEntities[Slot.EntityIndex]).EntityIndex = Slot.EntityIndex;
+    }
+
+    if (CrowdEntities.Num() > 0)
+    {
+        return;
+    }
+
+    Crowds.RemoveAtSwap(Slot.CrowdIndex);
+    if (Slot.CrowdIndex < Crowds.Num())
+    {
+        for (const FMassEntityHandle& Moved : Crowds[Slot.CrowdIndex].Entities)
+        {
+            TrackedEntitySlots.FindChecked(Moved).CrowdIndex = Slot.CrowdIndex;
+        }
+    }
+
+    if (Crowds.Num() == 0)
+    {
+        CellToCrowdMapping.Remove(Slot.CellKey);
+    }
+}
+
+void UGSDCrowdManagerSubsystem::RestoreHibernatedCell(int64 CellKey)
+{
+    FGSDHibernatedCell Cell;
+    if (!HibernatedCells.RemoveAndCopyValue(CellKey, Cell))
+    {
+        return;
+    }
+
+    for (FGSDHibernatedCrowd& Crowd : Cell.Crowds)
+    {
+        NumHibernatedEntities -= Crowd.Entities.Num();
+        QueueHibernatedRestore(MoveTemp(Crowd));
+    }
+}
+
+void UGSDCrowdManagerSubsystem::QueueHibernatedRestore(FGSDHibernatedCrowd&& Crowd)
+{
+    if (Crowd.Entities.Num() == 0 || !Crowd.EntityConfig)
+    {
+        return;
+    }
+
+    FGSDAsyncSpawnRequest& Request = AsyncSpawnQueue.AddDefaulted_GetRef();
+    Request.RequestId = NextAsyncSpawnRequestId++;
+    Request.Count = Crowd.Entities.Num();
+    Request.Center = Crowd.Entities[0].Location;  // Records share a cell; used for cell tracking
+    Request.EntityConfig = Crowd.EntityConfig;
+    Request.SpawnTransforms = MakeShared<FGSDAsyncSpawnTransforms, ESPMode::ThreadSafe>();
+
+    // Transforms come straight from the records, no worker pass needed
+    TArray<FTransform>& Transforms = Request.SpawnTransforms->Transforms;
+    Transforms.Reserve(Request.Count);
+    for (const FGSDHibernatedEntity& Record : Crowd.Entities)
+    {
+        Transforms.Emplace(FRotator(0.0f, Record.Yaw, 0.0f).Quaternion(), Record.Location, FVector::OneVector);
+    }
+    Request.SpawnTransforms->bReady.store(true, std::memory_order_release);
+    Request.RestoreStates = MoveTemp(Crowd.Entities);
+
+    ScheduleAsyncSpawnTick();
+
+    UE_LOG(LOG_GSDCROWDS, Verbose, TEXT("Queued restore %d: %d hibernated entities"), Request.RequestId, Request.Count);
+}
+
+void UGSDCrowdManagerSubsystem::QueuePendingCellSpawn(int32 Count, FVector Center, float Radius, UGSDCrowdEntityConfig* EntityConfig)
+{
+    FGSDPendingCellSpawn& Pending = PendingSpawnsByCell.FindOrAdd(GetCellKeyForPosition(Center)).Spawns.AddDefaulted_GetRef();
+    Pending.Count = Count;
+    Pending.Center = Center;
+    Pending.Radius = Radius;
+    Pending.EntityConfig = EntityConfig;
+
+    UE_LOG(LOG_GSDCROWDS, Verbose,
+        TEXT("Queueing spawn for unloaded cell: %s (count=%d)"), *GetCellNameForPosition(Center).ToString(), Count);
+}
+
+void UGSDCrowdManagerSubsystem::TrackCellEntities(const FVector& SpawnCenter, UGSDCrowdEntityConfig* EntityConfig, TConstArrayView<FMassEntityHandle> NewEntityHandles)
+{
+    if (NewEntityHandles.Num() == 0)
+    {
+        return;
+    }
+
+    const int64 CellKey = GetCellKeyForPosition(SpawnCenter);
+    TArray<FGSDCellCrowd>& Crowds = CellToCrowdMapping.FindOrAdd(CellKey).Crowds;
+    int32 CrowdIndex = Crowds.IndexOfByPredicate([EntityConfig](const FGSDCellCrowd& Existing)
+    {
+        return Existing.EntityConfig == EntityConfig;
+    });
+    if (CrowdIndex == INDEX_NONE)
+    {
+        CrowdIndex = Crowds.AddDefaulted();
+        Crowds[CrowdIndex].EntityConfig = EntityConfig;
+    }
+
+    TArray<FMassEntityHandle>& CrowdEntities = Crowds[CrowdIndex].Entities;
+    TrackedEntitySlots.Reserve(TrackedEntitySlots.Num() + NewEntityHandles.Num());
+    for (const FMassEntityHandle& Entity : NewEntityHandles)
+    {
+        FGSDTrackedEntitySlot& Slot = TrackedEntitySlots.Add(Entity);
+        Slot.CellKey = CellKey;
+        Slot.CrowdIndex = CrowdIndex;
+        Slot.EntityIndex = CrowdEntities.Add(Entity);
+        Slot.SpawnedIndex = SpawnedEntityHandles.Add(Entity);
+    }
+}
+
+void UGSDCrowdManagerSubsystem::ApplyRestoreStates(FMassEntityManager& EntityManager, TConstArrayView<FGSDHibernatedEntity> Records, TConstArrayView<FMassEntityHandle> Entities)
+{
+    // Entities follow the records in order when Mass creates the whole batch; otherwise match on spawn location
+    const bool bInOrder = Entities.Num() == Records.Num();
+    TBitArray<> RecordApplied(false, Records.Num());
+
+    for (int32 i = 0; i < Entities.Num(); ++i)
+    {
+        int32 RecordIndex = bInOrder ? i : INDEX_NONE;
+        if (!bInOrder)
+        {
+            if (const FDataFragment_Transform* Transform = EntityManager.GetFragmentDataPtr<FDataFragment_Transform>(Entities[i]))
+            {
+                const FVector Location = Transform->GetTransform().GetLocation();
+                for (int32 r = 0; r < Records.Num(); ++r)
+                {
+                    if (!RecordApplied[r] && Records[r].Location.Equals(Location, 1.0f))
+                    {
+                        RecordIndex = r;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (RecordIndex == INDEX_NONE)
+        {
+            continue;
+        }
+
+        RecordApplied[RecordIndex] = true;
+        const FGSDHibernatedEntity& Record = Records[RecordIndex];
+        if (FGSDZombieStateFragment* State = EntityManager.GetFragmentDataPtr<FGSDZombieStateFragment>(Entities[i]))
+        {
+            *State = Record.State;
+        }
+        if (FGSDZombieMovementFragment* Movement = EntityManager.GetFragmentDataPtr<FGSDZombieMovementFragment>(Entities[i]))
+        {
+            *Movement = Record.Movement;
+        }
+        if (FGSDNavigationFragment* Navigation = EntityManager.GetFragmentDataPtr<FGSDNavigationFragment>(Entities[i]))
+        {
+            Navigation->CurrentLane = Record.Lane;
+            Navigation->LanePosition = Record.LanePosition;
+            Navigation->bIsOnLane = Record.Lane.IsValid();
+        }
+    }
+
+    if (Entities.Num() < Records.Num())
+    {
+        UE_LOG(LOG_GSDCROWDS, Warning, TEXT("Mass created %d of %d restored crowd entities; the remaining records are dropped"),
+            Entities.Num(), Records.Num());
+    }
+}
+
+int32 UGSDCrowdManagerSubsystem::GetPendingCellSpawnCount() const
+{
+    int32 NumPending = 0;
+    for (const TPair<int64, FGSDPendingCellSpawnList>& Pair : PendingSpawnsByCell)
+    {
+        NumPending += Pair.Value.Spawns.Num();
     }
+    return NumPending;
 }
 
 int32 UGSDCrowdManagerSubsystem::SpawnEntitiesInternal(int32 Count, FVector Center, float Radius, UGSDCrowdEntityConfig* EntityConfig)
@@ -457,8 +1295,7 @@ int32 UGSDCrowdManagerSubsystem::SpawnEntitiesInternal(int32 Count, FVector Cent
         return 0;
     }
 
-    UMassEntitySubsystem* MassSubsystem = World->GetSubsystem<UMassEntitySubsystem>();
-    if (!MassSubsystem)
+    if (!GetEntityManager())
     {
         UE_LOG(LOG_GSDCROWDS, Error, TEXT("SpawnEntitiesInternal: Mass Entity subsystem not found"));
         return 0;
@@ -486,10 +1323,10 @@ int32 UGSDCrowdManagerSubsystem::SpawnEntitiesInternal(int32 Count, FVector Cent
 
     // Spawn entities using Mass Entity subsystem
     TArray<FMassEntityHandle> NewEntityHandles;
-    MassSubsystem->SpawnEntities(EntityConfig, SpawnTransforms, NewEntityHandles);
+    SpawnEntityBatch(EntityConfig, SpawnTransforms, NewEntityHandles);
 
     // Track spawned entities
-    SpawnedEntityHandles.Append(NewEntityHandles);
+    TrackCellEntities(Center, EntityConfig, NewEntityHandles);
 
     UE_LOG(LOG_GSDCROWDS, Log, TEXT("Spawned %d crowd entities at center %s with radius %.1f"),
         NewEntityHandles.Num(), *Center.ToString(), Radius);
@@ -0,0 +1,473 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#include "Subsystems/GSDFlowFieldSubsystem.h"
+#include "DataAssets/GSDCrowdConfig.h"
+#include "GSDCrowdLog.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Engine/LevelBounds.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+
+//-- UWorldSubsystem Interface --
+
+bool UGSDFlowFieldSubsystem::ShouldCreateSubsystem(UWorld* World) const
+{
+    // Only create in game worlds (not editor preview worlds)
+    return World && (World->IsGameWorld() || World->IsPlayInEditor());
+}
+
+void UGSDFlowFieldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Streamed levels can carry NavMesh tiles; drop walkability under them as they come and go
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UGSDFlowFieldSubsystem::OnLevelStreamingChanged);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UGSDFlowFieldSubsystem::OnLevelStreamingChanged);
+}
+
+void UGSDFlowFieldSubsystem::Deinitialize()
+{
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+    if (UNavigationSystemV1* NavSys = BoundNavigationSystem.Get())
+    {
+        NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UGSDFlowFieldSubsystem::OnNavigationGenerationFinished);
+    }
+    BoundNavigationSystem.Reset();
+
+    ClearFields();
+    Super::Deinitialize();
+}
+
+void UGSDFlowFieldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // The navigation system is created with the world, after its subsystems initialize
+    if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+    {
+        NavSys->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UGSDFlowFieldSubsystem::OnNavigationGenerationFinished);
+        BoundNavigationSystem = NavSys;
+    }
+}
+
+//-- Update --
+
+void UGSDFlowFieldSubsystem::UpdateFields(TConstArrayView<FGSDFlowFieldDemand> Demands, float DeltaTime)
+{
+    check(IsInGameThread());
+
+    const UGSDCrowdConfig* Config = UGSDCrowdConfig::GetDefaultConfig();
+    const int32 MinPursuers = Config ? Config->MinPursuersForFlowField : DefaultMinPursuers;
+    const int32 MaxFields = Config ? Config->MaxFlowFields : DefaultMaxFields;
+    const int32 MaxRebuilds = Config ? Config->MaxFlowFieldRebuildsPerFrame : DefaultMaxRebuildsPerFrame;
+    const int32 MaxProjections = Config ? Config->MaxFlowFieldProjectionsPerFrame : DefaultMaxProjectionsPerFrame;
+    const int32 GoalTolerance = Config ? Config->FlowFieldGoalToleranceCells : DefaultGoalToleranceCells;
+    const float ReleaseDelay = Config ? Config->FlowFieldReleaseDelay : DefaultReleaseDelay;
+
+    //-- Refresh existing fields, collect candidates for new ones --
+    TMap<int32, int32> DemandByTarget;
+    DemandByTarget.Reserve(Demands.Num());
+    TArray<int32> Candidates;
+
+    for (int32 i = 0; i < Demands.Num(); ++i)
+    {
+        const FGSDFlowFieldDemand& Demand = Demands[i];
+        DemandByTarget.Add(Demand.TargetID, i);
+
+        if (const int32* SlotIndex = SlotByTarget.Find(Demand.TargetID))
+        {
+            // Keep the field while anyone still pursues, so crowds thinning
+            // around the threshold do not thrash it
+            FFieldSlot& Slot = Slots[*SlotIndex];
+            Slot.TargetLocation = Demand.Location;
+            Slot.IdleTime = 0.0f;
+        }
+        else if (Demand.NumPursuers >= MinPursuers)
+        {
+            Candidates.Add(i);
+        }
+    }
+
+    //-- Release idle fields --
+    for (auto It = SlotByTarget.CreateIterator(); It; ++It)
+    {
+        if (DemandByTarget.Contains(It.Key()))
+        {
+            continue;
+        }
+
+        FFieldSlot& Slot = Slots[It.Value()];
+        Slot.IdleTime += DeltaTime;
+        if (Slot.IdleTime >= ReleaseDelay)
+        {
+            ReleaseSlot(It.Value());
+            It.RemoveCurrent();
+        }
+    }
+
+    //-- Assign new fields, most-pursued targets first --
+    if (Candidates.Num() > 0 && SlotByTarget.Num() < MaxFields)
+    {
+        Candidates.Sort([&Demands](const int32 A, const int32 B)
+        {
+            return Demands[A].NumPursuers > Demands[B].NumPursuers;
+        });
+
+        for (const int32 DemandIndex : Candidates)
+        {
+            if (SlotByTarget.Num() >= MaxFields)
+            {
+                break;
+            }
+
+            const FGSDFlowFieldDemand& Demand = Demands[DemandIndex];
+            FFieldSlot& Slot = Slots[AcquireSlot(Demand.TargetID)];
+            Slot.TargetLocation = Demand.Location;
+            CenterField(Slot, Demand.Location, Config);
+        }
+    }
+
+    //-- Follow targets: re-centre near the edge, retarget small drift, rebuild beyond it --
+    for (const TPair<int32, int32>& Pair : SlotByTarget)
+    {
+        FFieldSlot& Slot = Slots[Pair.Value];
+
+        // A grid already re-centred but not yet built is checked instead of the stale one
+        const FGSDFlowField& Field = Slot.GetNextField();
+        const int32 Margin = Field.GetDimension() / 4;
+
+        FIntPoint Cell;
+        if (!Field.WorldToCell(Slot.TargetLocation, Cell)
+            || Cell.X < Margin || Cell.Y < Margin
+            || Cell.X >= Field.GetDimension() - Margin || Cell.Y >= Field.GetDimension() - Margin)
+        {
+            CenterField(Slot, Slot.TargetLocation, Config);
+        }
+        else if (Slot.bRecenterPending || !Slot.Field.Retarget(Slot.TargetLocation, GoalTolerance))
+        {
+            // Unbuilt, or drifted too far for the built integration to lead to the target
+            Slot.bNeedsRebuild = true;
+        }
+    }
+
+    //-- Fill walkability within the projection budget (grids are built once filled) --
+    int32 ProjectionsLeft = MaxProjections;
+    for (FFieldSlot& Slot : Slots)
+    {
+        if (Slot.TargetID != INDEX_NONE && !Slot.IsWalkabilityFilled())
+        {
+            ProjectionsLeft -= FillWalkability(Slot, ProjectionsLeft);
+        }
+    }
+
+    //-- Rebuild dirty fields within budget (stale fields keep steering meanwhile) --
+    // Re-centred fields go first: their old grid is losing coverage of the target
+    int32 RebuildsLeft = MaxRebuilds;
+    for (const bool bRecenteredPass : { true, false })
+    {
+        for (int32 Offset = 0; Offset < Slots.Num() && RebuildsLeft > 0; ++Offset)
+        {
+            const int32 SlotIndex = (RebuildCursor + Offset) % Slots.Num();
+            FFieldSlot& Slot = Slots[SlotIndex];
+            if (Slot.TargetID == INDEX_NONE || !Slot.bNeedsRebuild || Slot.bRecenterPending != bRecenteredPass
+                || !Slot.IsWalkabilityFilled())
+            {
+                continue;
+            }
+
+            RebuildField(Slot);
+            --RebuildsLeft;
+            RebuildCursor = (SlotIndex + 1) % Slots.Num();
+        }
+    }
+}
+
+void UGSDFlowFieldSubsystem::ClearFields()
+{
+    Slots.Empty();
+    SlotByTarget.Empty();
+    FreeSlots.Empty();
+    WalkableCache.Empty();
+    RebuildCursor = 0;
+}
+
+void UGSDFlowFieldSubsystem::InvalidateWalkability(const FBox& Bounds)
+{
+    if (!Bounds.IsValid || WalkableCacheCellSize <= 0.0f)
+    {
+        return;
+    }
+
+    // Projections reach into the neighbouring height bands
+    const float CellSize = WalkableCacheCellSize;
+    const FIntVector MinKey(
+        FMath::FloorToInt(Bounds.Min.X / CellSize),
+        FMath::FloorToInt(Bounds.Min.Y / CellSize),
+        GetHeightBand(Bounds.Min.Z, CellSize) - 1);
+    const FIntVector MaxKey(
+        FMath::FloorToInt(Bounds.Max.X / CellSize),
+        FMath::FloorToInt(Bounds.Max.Y / CellSize),
+        GetHeightBand(Bounds.Max.Z, CellSize) + 1);
+
+    int32 NumDropped = 0;
+    for (auto It = WalkableCache.CreateIterator(); It; ++It)
+    {
+        const FIntVector& Key = It.Key();
+        if (Key.X >= MinKey.X && Key.X <= MaxKey.X && Key.Y >= MinKey.Y && Key.Y <= MaxKey.Y && Key.Z >= MinKey.Z && Key.Z <= MaxKey.Z)
+        {
+            It.RemoveCurrent();
+            NumDropped++;
+        }
+    }
+
+    // Refill fields whose next grid overlaps (their last build keeps steering meanwhile)
+    for (FFieldSlot& Slot : Slots)
+    {
+        const FGSDFlowField& Field = Slot.GetNextField();
+        if (Slot.TargetID == INDEX_NONE || !Field.IsInitialized()
+            || Slot.HeightBand < MinKey.Z || Slot.HeightBand > MaxKey.Z)
+        {
+            continue;
+        }
+
+        const FVector FieldMin = Field.GetOrigin();
+        const FVector FieldMax = FieldMin + FVector(Field.GetCellSize() * Field.GetDimension());
+        if (FieldMin.X <= Bounds.Max.X && FieldMax.X >= Bounds.Min.X && FieldMin.Y <= Bounds.Max.Y && FieldMax.Y >= Bounds.Min.Y)
+        {
+            RefillField(Slot);
+        }
+    }
+
+    UE_LOG(LOG_GSDCROWDS, Verbose, TEXT("FlowField: invalidated %d cached cells in %s"), NumDropped, *Bounds.ToString());
+}
+
+void UGSDFlowFieldSubsystem::InvalidateAllWalkability()
+{
+    WalkableCache.Reset();
+
+    for (FFieldSlot& Slot : Slots)
+    {
+        if (Slot.TargetID != INDEX_NONE)
+        {
+            RefillField(Slot);
+        }
+    }
+}
+
+void UGSDFlowFieldSubsystem::OnLevelStreamingChanged(ULevel* Level, UWorld* InWorld)
+{
+    if (!Level || InWorld != GetWorld() || Level->IsPersistentLevel() || (WalkableCache.Num() == 0 && SlotByTarget.Num() == 0))
+    {
+        return;
+    }
+
+    InvalidateWalkability(ALevelBounds::CalculateLevelBounds(Level));
+}
+
+void UGSDFlowFieldSubsystem::OnNavigationGenerationFinished(ANavigationData* NavData)
+{
+    InvalidateAllWalkability();
+}
+
+//-- Queries --
+
+int32 UGSDFlowFieldSubsystem::FindFieldForTarget(int32 TargetID, uint32& OutGeneration) const
+{
+    const int32* SlotIndex = SlotByTarget.Find(TargetID);
+    if (!SlotIndex || !Slots[*SlotIndex].Field.IsBuilt())
+    {
+        return INDEX_NONE;
+    }
+
+    OutGeneration = Slots[*SlotIndex].Generation;
+    return *SlotIndex;
+}
+
+//-- Internal --
+
+int32 UGSDFlowFieldSubsystem::AcquireSlot(int32 TargetID)
+{
+    const int32 SlotIndex = FreeSlots.Num() > 0 ? FreeSlots.Pop() : Slots.AddDefaulted();
+
+    FFieldSlot& Slot = Slots[SlotIndex];
+    Slot.TargetID = TargetID;
+    Slot.Generation = NextGeneration++;
+    Slot.IdleTime = 0.0f;
+    Slot.bNeedsRebuild = true;
+
+    SlotByTarget.Add(TargetID, SlotIndex);
+    return SlotIndex;
+}
+
+void UGSDFlowFieldSubsystem::CenterField(FFieldSlot& Slot, const FVector& Center, const UGSDCrowdConfig* Config)
+{
+    const float CellSize = Config ? Config->FlowFieldCellSize : DefaultCellSize;
+    const int32 Dimension = Config ? Config->FlowFieldDimension : DefaultDimension;
+
+    // Snap the origin to world-aligned cells so walkability can be shared between fields
+    const int32 HalfDimension = Dimension / 2;
+    const FVector Origin(
+        (FMath::FloorToInt(Center.X / CellSize) - HalfDimension) * CellSize,
+        (FMath::FloorToInt(Center.Y / CellSize) - HalfDimension) * CellSize,
+        0.0f);
+
+    Slot.HeightBand = GetHeightBand(Center.Z, CellSize);
+    InitNextField(Slot, Origin, CellSize, Dimension);
+}
+
+void UGSDFlowFieldSubsystem::RefillField(FFieldSlot& Slot)
+{
+    const FGSDFlowField& Field = Slot.GetNextField();
+    if (Field.IsInitialized())
+    {
+        // Copy out before InitNextField re-initializes this grid
+        const FVector Origin = Field.GetOrigin();
+        InitNextField(Slot, Origin, Field.GetCellSize(), Field.GetDimension());
+    }
+}
+
+void UGSDFlowFieldSubsystem::InitNextField(FFieldSlot& Slot, const FVector& Origin, float CellSize, int32 Dimension)
+{
+    // Keep steering with the built field until the new grid has been filled and built
+    Slot.bRecenterPending = Slot.Field.IsBuilt();
+    FGSDFlowField& Field = Slot.GetNextField();
+
+    Field.Initialize(Origin, CellSize, Dimension);
+    Slot.WalkabilityCursor = 0;
+    Slot.bNeedsRebuild = true;
+}
+
+void UGSDFlowFieldSubsystem::RebuildField(FFieldSlot& Slot)
+{
+    if (Slot.bRecenterPending)
+    {
+        // Swap rather than move so the old grid's storage is reused by the next re-centre.
+        // If the target already left the new grid, the old field stays and the next update re-centres again
+        if (Slot.RecenteredField.Build(Slot.TargetLocation))
+        {
+            Swap(Slot.Field, Slot.RecenteredField);
+            Slot.bRecenterPending = false;
+        }
+    }
+    else
+    {
+        Slot.Field.Build(Slot.TargetLocation);
+    }
+
+    Slot.bNeedsRebuild = false;
+    ++TotalRebuilds;
+}
+
+void UGSDFlowFieldSubsystem::ReleaseSlot(int32 SlotIndex)
+{
+    FFieldSlot& Slot = Slots[SlotIndex];
+    Slot.TargetID = INDEX_NONE;
+    Slot.Generation = 0;
+    Slot.Field.Reset();
+    Slot.RecenteredField.Reset();
+    Slot.bNeedsRebuild = false;
+    Slot.bRecenterPending = false;
+    FreeSlots.Add(SlotIndex);
+}
+
+UGSDFlowFieldSubsystem::FNavProjectionFunction UGSDFlowFieldSubsystem::GetNavProjection() const
+{
+#if WITH_DEV_AUTOMATION_TESTS
+    if (NavProjectionOverride)
+    {
+        return NavProjectionOverride;
+    }
+#endif
+
+    UWorld* World = GetWorld();
+    UNavigationSystemV1* NavSys = World ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(World) : nullptr;
+    const ANavigationData* NavData = NavSys ? NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate) : nullptr;
+    if (!NavData)
+    {
+        return FNavProjectionFunction();
+    }
+
+    // Called immediately on the game thread, so the raw pointer cannot go stale
+    return [NavData](TArray<FNavigationProjectionWork>& Workload, const FVector& Extent)
+    {
+        NavData->BatchProjectPoints(Workload, Extent, NavData->GetDefaultQueryFilter());
+    };
+}
+
+int32 UGSDFlowFieldSubsystem::FillWalkability(FFieldSlot& Slot, int32 MaxProjections)
+{
+    FGSDFlowField& Field = Slot.GetNextField();
+    const int32 NumCells = Field.GetNumCells();
+    const float CellSize = Field.GetCellSize();
+    if (CellSize != WalkableCacheCellSize || WalkableCache.Num() > MaxWalkableCacheCells)
+    {
+        WalkableCache.Reset();
+        WalkableCacheCellSize = CellSize;
+    }
+
+    // Without NavMesh the field degrades to open-ground steering (all cells walkable)
+    const FNavProjectionFunction Project = GetNavProjection();
+    if (!Project)
+    {
+        Slot.WalkabilityCursor = NumCells;
+        return 0;
+    }
+
+    const int32 Dimension = Field.GetDimension();
+    const int32 BaseX = FMath::RoundToInt(Field.GetOrigin().X / CellSize);
+    const int32 BaseY = FMath::RoundToInt(Field.GetOrigin().Y / CellSize);
+    const float BandHeight = CellSize * HeightBandCells;
+    const float QueryZ = (Slot.HeightBand + 0.5f) * BandHeight;
+
+    TArray<FNavigationProjectionWork> Workload;
+    TArray<int32> WorkCells;
+
+    // Cached cells are free; stop at the first uncached cell past the budget and resume there next frame
+    int32 CellIndex = Slot.WalkabilityCursor;
+    for (; CellIndex < NumCells; ++CellIndex)
+    {
+        const int32 X = CellIndex % Dimension;
+        const int32 Y = CellIndex / Dimension;
+        if (const uint8* Cached = WalkableCache.Find(FIntVector(BaseX + X, BaseY + Y, Slot.HeightBand)))
+        {
+            Field.SetWalkable(CellIndex, *Cached != 0);
+            continue;
+        }
+
+        if (Workload.Num() >= MaxProjections)
+        {
+            break;
+        }
+
+        FVector Point = Field.GetCellCenter(FIntPoint(X, Y));
+        Point.Z = QueryZ;
+        Workload.Emplace(Point);
+        WorkCells.Add(CellIndex);
+    }
+    Slot.WalkabilityCursor = CellIndex;
+
+    if (Workload.Num() == 0)
+    {
+        return 0;
+    }
+
+    // One batched query for this frame's uncached cells; a cell is walkable if NavMesh lies within it
+    const float HalfCell = CellSize * 0.5f;
+    Project(Workload, FVector(HalfCell, HalfCell, BandHeight));
+
+    for (int32 WorkIndex = 0; WorkIndex < Workload.Num(); ++WorkIndex)
+    {
+        const int32 WorkCell = WorkCells[WorkIndex];
+        const bool bWalkable = Workload[WorkIndex].bResult;
+        Field.SetWalkable(WorkCell, bWalkable);
+        WalkableCache.Add(FIntVector(BaseX + WorkCell % Dimension, BaseY + WorkCell / Dimension, Slot.HeightBand), bWalkable ? 1 : 0);
+    }
+    TotalProjections += Workload.Num();
+
+    UE_LOG(LOG_GSDCROWDS, Verbose, TEXT("FlowField: projected %d uncached cells (%d/%d filled, %d cached)"),
+        Workload.Num(), Slot.WalkabilityCursor, NumCells, WalkableCache.Num());
+    return Workload.Num();
+}
@@ -16,6 +16,7 @@
  * - Entity limits and performance budgets
  * - Behavior parameters (speed, wandering)
  * - Navigation settings
+ * - Parallel processing toggles
  * - Audio LOD configuration
  * - Debug visualization options
  *
@@ -120,6 +121,37 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Behavior")
     float SpeedInterpolationRate = 2.0f;
 
+    // === Behavior LOD Buckets ===
+
+    /**
+     * Update distant entities' behavior less often, based on LOD significance.
+     * LOD processor tags entities into buckets; behavior skips whole chunks of buckets not due.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Behavior LOD")
+    bool bEnableBehaviorLODBuckets = true;
+
+    /** Frames between behavior updates for LOD 1 (ISM) entities */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Behavior LOD", meta = (ClampMin = "1"))
+    int32 BehaviorLOD1FrameInterval = 2;
+
+    /** Frames between behavior updates for LOD 2 (culled) entities */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Behavior LOD", meta = (ClampMin = "1"))
+    int32 BehaviorLOD2FrameInterval = 4;
+
+    /** Frames between behavior updates for LOD 3 (far culled / unloaded) entities */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Behavior LOD", meta = (ClampMin = "1"))
+    int32 BehaviorLOD3FrameInterval = 8;
+
+    // === Streaming ===
+
+    /**
+     * Hibernate entities in unloaded streaming cells instead of simulating them culled.
+     * Position, state and lane are kept in a compact record and the Mass entity is
+     * destroyed; it is recreated when the cell loads again.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Streaming")
+    bool bEnableCellHibernation = true;
+
     // === Pursuit/Attack Behavior ===
 
     /** Enable pursuit behavior (chasing targets) */
@@ -146,6 +178,59 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Pursuit")
     float LoseTargetDistance = 2000.0f;
 
+    /**
+     * Maximum spatial target searches per frame across all aggressive entities.
+     * Each entity searches at most once per BehaviorUpdateInterval; entities over
+     * the budget retry next frame.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Pursuit", meta = (ClampMin = "1"))
+    int32 MaxTargetSearchesPerFrame = 512;
+
+    // === Flow Field Navigation ===
+
+    /**
+     * Route pursuing entities with a shared flow field per target instead of
+     * lane following. Fields are built only for targets with enough pursuers.
+     * Entities need FGSDFlowFieldFragment.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Flow Field")
+    bool bEnableFlowFieldPursuit = false;
+
+    /** Pursuers a target needs before a flow field is built for it */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Flow Field", meta = (ClampMin = "1"))
+    int32 MinPursuersForFlowField = 32;
+
+    /** Flow field cell size (world units) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Flow Field", meta = (ClampMin = "25.0"))
+    float FlowFieldCellSize = 200.0f;
+
+    /** Flow field cells per side (field covers Dimension * CellSize around the target) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Flow Field", meta = (ClampMin = "8", ClampMax = "512"))
+    int32 FlowFieldDimension = 128;
+
+    /** Maximum concurrently active flow fields (most-pursued targets win) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Flow Field", meta = (ClampMin = "1"))
+    int32 MaxFlowFields = 8;
+
+    /** Maximum flow field integration rebuilds per frame (others keep their last build) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Flow Field", meta = (ClampMin = "1"))
+    int32 MaxFlowFieldRebuildsPerFrame = 2;
+
+    /** NavMesh projections per frame for flow field walkability (new and re-centred grids fill over several frames) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Flow Field", meta = (ClampMin = "64"))
+    int32 MaxFlowFieldProjectionsPerFrame = 4096;
+
+    /**
+     * Cells a target may drift from its field's goal cell before the integration is rebuilt.
+     * Entities within the drift steer straight at the target. 0 rebuilds on every cell change.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Flow Field", meta = (ClampMin = "0", ClampMax = "8"))
+    int32 FlowFieldGoalToleranceCells = 1;
+
+    /** Seconds without pursuers before a target's flow field is released */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Flow Field")
+    float FlowFieldReleaseDelay = 2.0f;
+
     // === Navigation ===
 
     /** Lane search radius for ZoneGraph */
@@ -164,6 +249,57 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Navigation")
     float InteractionDurationMax = 8.0f;
 
+    // === Separation ===
+
+    /** Push overlapping entities apart (UGSDSeparationProcessor) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Separation")
+    bool bEnableSeparation = true;
+
+    /** Distance within which neighbors push each other apart (world units) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Separation", meta = (ClampMin = "10.0"))
+    float SeparationRadius = 120.0f;
+
+    /** Maximum separation speed (world units/s), reached when neighbors fully overlap */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Separation", meta = (ClampMin = "0.0"))
+    float SeparationStrength = 200.0f;
+
+    /** Neighbors considered per entity; keeps cost linear in entity count in dense crowds */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Separation", meta = (ClampMin = "1", ClampMax = "32"))
+    int32 MaxSeparationNeighbors = 8;
+
+    /** Maximum offset from the lane separation may build up for entities following a lane */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Separation", meta = (ClampMin = "0.0"))
+    float MaxLaneSeparationOffset = 150.0f;
+
+    /** Rate (1/s) at which a lane follower's offset eases back onto the lane while separation is not pushing it */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Separation", meta = (ClampMin = "0.0"))
+    float LaneOffsetRecoveryRate = 2.0f;
+
+    // === Parallel Processing ===
+
+    /** Run UGSDNavigationProcessor chunks in parallel across worker threads */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Parallel")
+    bool bParallelNavigation = false;
+
+    /** Run UGSDZombieBehaviorProcessor chunks in parallel across worker threads */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Parallel")
+    bool bParallelBehavior = false;
+
+    /** Run UGSDCrowdLODProcessor chunks in parallel across worker threads */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Parallel")
+    bool bParallelLOD = false;
+
+    /** Run UGSDSeparationProcessor chunks in parallel across worker threads */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Parallel")
+    bool bParallelSeparation = false;
+
+    /**
+     * Run UGSDSmartObjectProcessor chunks in parallel across worker threads.
+     * Searches, claims and releases are deferred and applied on the game thread.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Parallel")
+    bool bParallelSmartObjects = false;
+
     // === Audio ===
 
     /** Enable audio LOD system */
@@ -0,0 +1,49 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "GSDBehaviorLODTags.generated.h"
+
+/**
+ * Behavior update bucket tags, assigned by UGSDCrowdLODProcessor from LOD significance.
+ *
+ * Tags change an entity's archetype, so entities in the same bucket share chunks and
+ * UGSDZombieBehaviorProcessor can skip whole archetypes on frames a bucket is not due.
+ * Entities without a bucket tag are in bucket 0 (updated every frame).
+ *
+ * Bucket = floor(LODSignificance):
+ * - 0: High/Low Actor - every frame
+ * - 1: ISM - every BehaviorLOD1FrameInterval frames
+ * - 2: Culled - every BehaviorLOD2FrameInterval frames
+ * - 3: Far culled / unloaded cell - every BehaviorLOD3FrameInterval frames
+ */
+USTRUCT()
+struct GSD_CROWDS_API FGSDBehaviorLODBucket1Tag : public FMassTag
+{
+    GENERATED_BODY()
+};
+
+USTRUCT()
+struct GSD_CROWDS_API FGSDBehaviorLODBucket2Tag : public FMassTag
+{
+    GENERATED_BODY()
+};
+
+USTRUCT()
+struct GSD_CROWDS_API FGSDBehaviorLODBucket3Tag : public FMassTag
+{
+    GENERATED_BODY()
+};
+
+namespace GSDBehaviorLOD
+{
+    static constexpr int32 NumBuckets = 4;
+
+    /** Map LOD significance (0.0-3.0) to a behavior bucket (0-3). */
+    inline int32 GetBucketForSignificance(float LODSignificance)
+    {
+        return FMath::Clamp(FMath::FloorToInt(LODSignificance), 0, NumBuckets - 1);
+    }
+}
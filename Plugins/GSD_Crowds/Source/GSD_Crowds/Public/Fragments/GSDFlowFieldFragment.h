@@ -0,0 +1,36 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntity/Types/MassEntityTypes.h"
+#include "GSDFlowFieldFragment.generated.h"
+
+/**
+ * Flow field fragment for pursuing entities.
+ * Caches which UGSDFlowFieldSubsystem field the entity follows so the
+ * navigation processor can sample it in O(1) without a per-entity lookup.
+ *
+ * CRITICAL: Do NOT store UObject pointers in fragments.
+ * Fragments are not UObjects and cannot hold strong references.
+ * Use field indices and raw data instead.
+ */
+USTRUCT()
+struct GSD_CROWDS_API FGSDFlowFieldFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    //-- Field Binding (re-resolved when TargetID or the field generation changes) --
+    UPROPERTY()
+    int32 TargetID = INDEX_NONE;  // Pursuit target the cached field belongs to
+
+    UPROPERTY()
+    int32 FieldIndex = INDEX_NONE;
+
+    UPROPERTY()
+    uint32 FieldGeneration = 0;
+
+    //-- Last Sample --
+    UPROPERTY()
+    FVector Direction = FVector::ZeroVector;
+};
@@ -33,6 +33,17 @@ struct GSD_CROWDS_API FGSDNavigationFragment : public FMassFragment
     UPROPERTY()
     uint8 bReachedDestination : 1;
 
+    //-- Cached Lane Data (valid while CachedLaneHandle == CurrentLane) --
+    // Lets the end-of-lane check and next-lane pick run without ZoneGraph lookups
+    UPROPERTY()
+    FZoneGraphLaneHandle CachedLaneHandle;
+
+    UPROPERTY()
+    float CachedLaneLength = 0.0f;
+
+    UPROPERTY()
+    FVector CachedLaneEndLocation = FVector::ZeroVector;
+
     //-- Target --
     UPROPERTY()
     FZoneGraphLaneHandle TargetLane;
@@ -44,6 +55,13 @@ struct GSD_CROWDS_API FGSDNavigationFragment : public FMassFragment
     UPROPERTY()
     float DesiredSpeed = 150.0f;
 
+    //-- Separation (written by UGSDSeparationProcessor, applied next frame) --
+    UPROPERTY()
+    FVector DesiredVelocity = FVector::ZeroVector;  // Separation steering (XY, units/s)
+
+    UPROPERTY()
+    FVector LaneOffset = FVector::ZeroVector;  // Separation offset from the lane sample (XY); decays when unsteered, re-projected on lane change
+
     //-- Fallback (when ZoneGraph unavailable) --
     UPROPERTY()
     FVector FallbackTargetLocation = FVector::ZeroVector;
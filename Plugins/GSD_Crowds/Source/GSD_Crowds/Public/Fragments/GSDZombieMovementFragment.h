@@ -0,0 +1,162 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "GSDZombieMovementFragment.generated.h"
+
+/**
+ * Compact (4 byte) pursuit target: a Mass entity or a player.
+ *
+ * Packing:
+ * - Entity: bits 0-23 entity index, bits 24-30 low serial bits, bit 31 clear
+ * - Player: bit 31 set, bits 0-30 player index
+ * - Invalid: all bits set (GetID() == INDEX_NONE)
+ *
+ * The serial bits let a pursuer notice that its target's entity index was
+ * recycled for a different entity (1 in 128 false match).
+ */
+USTRUCT()
+struct GSD_CROWDS_API FGSDCrowdTargetHandle
+{
+    GENERATED_BODY()
+
+    static constexpr uint32 InvalidPacked = 0xFFFFFFFF;
+    static constexpr uint32 PlayerBit = 0x80000000;
+    static constexpr uint32 EntityIndexMask = 0x00FFFFFF;
+    static constexpr uint32 SerialShift = 24;
+    static constexpr uint32 SerialMask = 0x7F;
+
+    UPROPERTY()
+    uint32 Packed = InvalidPacked;
+
+    //-- Construction --
+    static FGSDCrowdTargetHandle MakeEntity(const FMassEntityHandle& Entity)
+    {
+        FGSDCrowdTargetHandle Handle;
+        if (Entity.Index >= 0 && static_cast<uint32>(Entity.Index) <= EntityIndexMask)
+        {
+            Handle.Packed = static_cast<uint32>(Entity.Index) | ((static_cast<uint32>(Entity.SerialNumber) & SerialMask) << SerialShift);
+        }
+        return Handle;
+    }
+
+    static FGSDCrowdTargetHandle MakePlayer(int32 PlayerIndex)
+    {
+        FGSDCrowdTargetHandle Handle;
+        Handle.Packed = PlayerBit | (static_cast<uint32>(PlayerIndex) & ~PlayerBit);
+        return Handle;
+    }
+
+    /** Inverse of GetID() */
+    static FGSDCrowdTargetHandle FromID(int32 ID)
+    {
+        FGSDCrowdTargetHandle Handle;
+        Handle.Packed = static_cast<uint32>(ID);
+        return Handle;
+    }
+
+    void Reset() { Packed = InvalidPacked; }
+
+    //-- Queries --
+    bool IsValid() const { return Packed != InvalidPacked; }
+    bool IsPlayer() const { return IsValid() && (Packed & PlayerBit) != 0; }
+    bool IsEntity() const { return (Packed & PlayerBit) == 0; }
+
+    int32 GetPlayerIndex() const { return IsPlayer() ? static_cast<int32>(Packed & ~PlayerBit) : INDEX_NONE; }
+    int32 GetEntityIndex() const { return IsEntity() ? static_cast<int32>(Packed & EntityIndexMask) : INDEX_NONE; }
+
+    /** True if a live entity handle is still the entity this target was taken from */
+    bool MatchesEntity(const FMassEntityHandle& Entity) const
+    {
+        return IsEntity() && MakeEntity(Entity).Packed == Packed;
+    }
+
+    /** Stable 32-bit key (e.g. for per-target maps); INDEX_NONE when invalid */
+    int32 GetID() const { return static_cast<int32>(Packed); }
+
+    bool operator==(const FGSDCrowdTargetHandle& Other) const { return Packed == Other.Packed; }
+    bool operator!=(const FGSDCrowdTargetHandle& Other) const { return Packed != Other.Packed; }
+};
+
+/**
+ * Hot per-frame state for crowd/flock members: flags, speeds, timers and pursuit target.
+ *
+ * Split from FGSDZombieStateFragment so the behavior and navigation processors
+ * only stream the data they touch every frame (44 bytes, versus 72 for the
+ * former combined fragment). Rarely read stats stay in FGSDZombieStateFragment.
+ *
+ * CRITICAL: Do NOT store UObject pointers in fragments.
+ * Fragments are not UObjects and cannot hold strong references.
+ * Use indices or raw data instead.
+ */
+USTRUCT(SaveGame)
+struct GSD_CROWDS_API FGSDZombieMovementFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+    //-- Pursuit Target --
+    // Single precision: steering only needs centimeter accuracy
+    UPROPERTY(SaveGame)
+    FVector3f TargetLocation = FVector3f::ZeroVector;
+
+    UPROPERTY(SaveGame)
+    FGSDCrowdTargetHandle Target;  // Invalid = no target
+
+    //-- Movement --
+    UPROPERTY(SaveGame)
+    float MovementSpeed = 150.0f;
+
+    UPROPERTY(SaveGame)
+    float TargetMovementSpeed = 150.0f;
+
+    UPROPERTY(SaveGame)
+    float WanderDirection = 0.0f;
+
+    //-- Timers --
+    UPROPERTY(SaveGame)
+    float TimeSinceLastBehaviorUpdate = 0.0f;
+
+    UPROPERTY(SaveGame)
+    float TimeSinceLastAttack = 0.0f;  // Cooldown timer for attacks
+
+    // Behavior processor clock at this entity's last update (wraps; < 0 = not yet updated).
+    // Elapsed time is tracked per entity so a behavior LOD bucket change never skews it.
+    UPROPERTY(Transient)
+    float LastBehaviorTime = -1.0f;
+
+    //-- Flags (read by every crowd processor, every frame) --
+    UPROPERTY(SaveGame)
+    uint8 bIsAggressive : 1;
+
+    UPROPERTY(SaveGame)
+    uint8 bIsAlive : 1;
+
+    UPROPERTY(SaveGame)
+    uint8 bIsActive : 1;
+
+    // Set by the behavior processor's serial gather when this entity gets one of
+    // the frame's MaxTargetSearchesPerFrame target searches (transient)
+    uint8 bTargetSearchGranted : 1;
+
+    bool HasTarget() const { return Target.IsValid(); }
+
+    void ClearTarget()
+    {
+        Target.Reset();
+        TargetLocation = FVector3f::ZeroVector;
+    }
+
+    /** Next behavior update advances timers by one frame (e.g. after hibernation) */
+    void ResetBehaviorTime() { LastBehaviorTime = -1.0f; }
+
+    //-- Constructor --
+    FGSDZombieMovementFragment()
+        : bIsAggressive(false)
+        , bIsAlive(true)
+        , bIsActive(true)
+        , bTargetSearchGranted(false)
+    {
+    }
+};
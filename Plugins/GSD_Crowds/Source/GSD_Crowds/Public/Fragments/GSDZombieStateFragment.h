@@ -11,7 +11,7 @@
  *
  * This is a GAME-AGNOSTIC state fragment suitable for any crowd simulation:
  * - Zombies, NPCs, animals, vehicles, or any Mass Entity crowd
- * - Properties are generic (Health, MovementSpeed, etc.)
+ * - Properties are generic (Health, AttackRange, etc.)
  * - Can be extended via additional fragments for game-specific behavior
  *
  * MIGRATION NOTE (GSDCROWDS-105):
@@ -20,6 +20,10 @@
  * FGSDZombieStateFragment will need to update to the new name.
  * A typedef will be provided for backward compatibility during transition.
  *
+ * Hot/cold split: flags, speeds, timers and the pursuit target live in
+ * FGSDZombieMovementFragment, which processors query every frame. This fragment
+ * keeps the rarely touched per-entity stats and is not part of any processor query.
+ *
  * CRITICAL: Do NOT store UObject pointers in fragments.
  * Fragments are not UObjects and cannot hold strong references.
  * Use indices or raw data instead.
@@ -29,40 +33,10 @@ struct GSD_CROWDS_API FGSDZombieStateFragment : public FMassFragment
 {
     GENERATED_BODY()
 
-    //-- State --
+    //-- Stats --
     UPROPERTY(SaveGame)
     float Health = 100.0f;
 
-    UPROPERTY(SaveGame)
-    float MovementSpeed = 150.0f;
-
-    UPROPERTY(SaveGame)
-    float TargetMovementSpeed = 150.0f;
-
-    //-- Flags --
-    UPROPERTY(SaveGame)
-    uint8 bIsAggressive : 1;
-
-    UPROPERTY(SaveGame)
-    uint8 bIsAlive : 1;
-
-    UPROPERTY(SaveGame)
-    uint8 bIsActive : 1;
-
-    //-- Behavior --
-    UPROPERTY(SaveGame)
-    float WanderDirection = 0.0f;
-
-    UPROPERTY(SaveGame)
-    float TimeSinceLastBehaviorUpdate = 0.0f;
-
-    //-- Pursuit/Attack Behavior --
-    UPROPERTY(SaveGame)
-    FVector TargetLocation = FVector::ZeroVector;
-
-    UPROPERTY(SaveGame)
-    int32 TargetEntityID = INDEX_NONE;  // Mass entity ID of pursuit target (INDEX_NONE = no target)
-
     UPROPERTY(SaveGame)
     float PursuitSpeed = 300.0f;  // Speed when chasing target
 
@@ -71,17 +45,6 @@ struct GSD_CROWDS_API FGSDZombieStateFragment : public FMassFragment
 
     UPROPERTY(SaveGame)
     float DetectionRange = 1000.0f;  // Range at which entity detects targets
-
-    UPROPERTY(SaveGame)
-    float TimeSinceLastAttack = 0.0f;  // Cooldown timer for attacks
-
-    //-- Constructor --
-    FGSDZombieStateFragment()
-        : bIsAggressive(false)
-        , bIsAlive(true)
-        , bIsActive(true)
-    {
-    }
 };
 
 //-- Backward Compatibility Typedef (GSDCROWDS-105) --
@@ -4,12 +4,24 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "Subsystems/GSDNetworkBudgetSubsystem.h"
 #include "GSDCrowdLODProcessor.generated.h"
 
 class UGSDCrowdConfig;
 struct FMassRepresentationLODFragment;
 struct FDataFragment_Transform;
 
+/**
+ * LOD distance thresholds, squared, resolved once per frame for the batched kernel.
+ */
+struct FGSDLODSquaredThresholds
+{
+    float HighActor = 0.0f;
+    float LowActor = 0.0f;
+    float ISM = 0.0f;
+    float Cull = 0.0f;
+};
+
 /**
  * Processor for calculating LOD significance based on viewer distance.
  *
@@ -19,8 +31,23 @@ struct FDataFragment_Transform;
  * - 1.5 - 2.5: ISM (instanced mesh)
  * - 2.5 - 3.0: Culled (invisible)
  *
+ * Significance is computed per chunk by a SIMD kernel against squared thresholds,
+ * using the nearest of all viewers (every player controller's view point, so
+ * split-screen and server-side player sets are covered).
+ *
  * Configuration is loaded from UGSDCrowdConfig DataAsset.
  * All hardcoded values have been replaced with config lookups.
+ * Set UGSDCrowdConfig::bParallelLOD to process chunks in parallel.
+ *
+ * LODSignificance is always written locally for every entity. On servers, replication
+ * is scheduled through UGSDNetworkBudgetSubsystem: each chunk submits candidates and
+ * the subsystem ranks them by significance, distance and staleness. The schedule is
+ * advisory: the approved set (GetApprovedReplication) and the subsystem's schedule
+ * stats are exposed for a replication path to consume, but nothing in this plugin
+ * gates replication on them yet. Standalone games and clients skip scheduling.
+ *
+ * Also assigns behavior bucket tags (GSDBehaviorLODTags.h) from LOD significance
+ * via deferred commands, so UGSDZombieBehaviorProcessor can time-slice far entities.
  */
 UCLASS()
 class GSD_CROWDS_API UGSDCrowdLODProcessor : public UMassProcessor
@@ -39,6 +66,9 @@ protected:
 private:
     FMassEntityQuery EntityQuery;
 
+    //-- Replication schedule output (reused each frame) --
+    TArray<FGSDReplicationCandidate> ApprovedReplication;
+
     //-- Cached Config (loaded once per frame) --
     UPROPERTY(Transient)
     TObjectPtr<UGSDCrowdConfig> CachedConfig;
@@ -55,19 +85,58 @@ private:
     static constexpr float DefaultAudioLOD1Volume = 0.5f;
     static constexpr float DefaultAudioLOD2Volume = 0.25f;
 
+    // Estimate bits used: Position (FVector = 3 floats = 96 bits) + State (uint8 = 8 bits)
+    static constexpr int32 EstimatedBitsPerEntity = 96 + 8;
+
 public:
+    /**
+     * Entities approved for replication this frame, highest priority first (empty unless a server).
+     * Advisory - EntityKey is FGSDCounterRandom::MakeEntityKey of the entity handle.
+     */
+    const TArray<FGSDReplicationCandidate>& GetApprovedReplication() const { return ApprovedReplication; }
+
     /**
      * Calculate LOD significance from distance.
      * Returns value 0.0-3.0 based on LOD thresholds.
      */
     float CalculateLODSignificance(float Distance) const;
 
+    /**
+     * Calculate LOD significance from squared distance (scalar path of the batch kernel).
+     */
+    static float CalculateLODSignificanceSquared(float DistanceSquared, const FGSDLODSquaredThresholds& Thresholds);
+
+    /**
+     * Calculate LOD significance for a batch of positions against the nearest viewer.
+     * Processes 4 entities per SIMD register; no sqrt.
+     *
+     * @param Positions Entity world positions
+     * @param ViewerLocations Viewer world positions (at least one)
+     * @param Thresholds Squared LOD thresholds (see GetSquaredLODThresholds)
+     * @param OutSignificance Output, same size as Positions
+     * @param OutMinDistanceSquared Optional output of squared distance to the nearest viewer (empty or same size as Positions)
+     */
+    static void CalculateLODSignificanceBatch(TConstArrayView<FVector> Positions, TConstArrayView<FVector> ViewerLocations,
+        const FGSDLODSquaredThresholds& Thresholds, TArrayView<float> OutSignificance,
+        TArrayView<float> OutMinDistanceSquared = TArrayView<float>());
+
+    /**
+     * Get squared LOD thresholds from config (or fallbacks).
+     */
+    FGSDLODSquaredThresholds GetSquaredLODThresholds() const;
+
     /**
      * Get viewer location (player camera).
      * Returns world location of primary player camera.
      */
     FVector GetViewerLocation(FMassExecutionContext& Context) const;
 
+    /**
+     * Get view locations of all player controllers (local split-screen players and,
+     * on a server, every connected player). Falls back to the world origin if none.
+     */
+    void GetViewerLocations(FMassExecutionContext& Context, TArray<FVector, TInlineAllocator<4>>& OutViewerLocations) const;
+
     /**
      * Calculate audio LOD volume based on distance to listener.
      * Returns volume multiplier (1.0 = full, 0.0 = silent).
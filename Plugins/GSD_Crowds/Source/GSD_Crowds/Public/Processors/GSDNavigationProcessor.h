@@ -4,18 +4,49 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "ZoneGraph/ZoneGraphTypes.h"
 #include "GSDNavigationProcessor.generated.h"
 
 class UZoneGraphSubsystem;
+class AZoneGraphData;
+class UGSDCrowdConfig;
 struct FGSDNavigationFragment;
-struct FGSDZombieStateFragment;
+struct FGSDZombieMovementFragment;
+struct FGSDFlowFieldFragment;
+class UGSDFlowFieldSubsystem;
 struct FDataFragment_Transform;
 class UGSDDeterminismManager;
+struct FGSDCounterRandom;
 
 /**
  * Navigation processor for ZoneGraph-based crowd movement.
  * Moves entities along ZoneGraph lanes with fallback to direct movement.
  * Applies velocity randomization to prevent synchronized movement (CROWD-08).
+ *
+ * Random draws use a per-entity counter-based generator (FGSDCounterRandom), so
+ * results are independent of chunk and entity iteration order.
+ * Set UGSDCrowdConfig::bParallelNavigation to process chunks in parallel.
+ *
+ * Lane candidates for off-lane entities come from a per-cell cache built lazily
+ * from ZoneGraph bounds queries and cleared when ZoneGraph data is added or
+ * removed, so mass re-binding (after spawns or lane ends) does one query per
+ * cell instead of one per entity. Each cell's query reaches LaneSearchRadius past
+ * the cell edge; picks keep only candidates within LaneSearchRadius of the entity.
+ *
+ * Lane transforms are sampled per chunk in one pass: entities are grouped by
+ * lane and sorted by distance, so each lane's point data is fetched once and
+ * walked forward. Lane length and end location are cached in the fragment.
+ *
+ * Pursuit flow fields (UGSDCrowdConfig::bEnableFlowFieldPursuit):
+ * Pursuing entities with an FGSDFlowFieldFragment whose target has a field in
+ * UGSDFlowFieldSubsystem leave their lane and follow the field (one O(1) sample
+ * per entity). They re-bind to a lane once the pursuit or field ends.
+ *
+ * Separation steering written by UGSDSeparationProcessor is applied here on the
+ * following frame: directly for free movement, as a clamped offset from the
+ * lane sample for lane followers. The offset eases back to the lane while no
+ * steering is applied, is re-projected when an entity joins a lane (so it keeps
+ * its position) and is cleared when the entity leaves lane movement.
  */
 UCLASS()
 class GSD_CROWDS_API UGSDNavigationProcessor : public UMassProcessor
@@ -25,6 +56,28 @@ class GSD_CROWDS_API UGSDNavigationProcessor : public UMassProcessor
 public:
     UGSDNavigationProcessor();
 
+    //~ Begin UObject Interface
+    virtual void BeginDestroy() override;
+    //~ End UObject Interface
+
+    /** Drop all cached lane candidates (rebuilt lazily) */
+    void InvalidateLaneCandidateCache();
+
+    /**
+     * Advance a lane follower's offset from its lane sample by one frame.
+     * Separation steering accumulates into the offset; with no steering it decays toward the lane.
+     *
+     * @param LaneOffset Current offset (XY)
+     * @param DesiredVelocity Separation steering from last frame
+     * @param DeltaTime Frame time in seconds
+     * @param bApplySeparation False ignores steering (the offset only decays)
+     * @param MaxLaneOffset Maximum XY offset
+     * @param RecoveryRate Exponential decay rate (1/s) while not steered
+     * @return New offset
+     */
+    static FVector UpdateLaneOffset(const FVector& LaneOffset, const FVector& DesiredVelocity, float DeltaTime,
+        bool bApplySeparation, float MaxLaneOffset, float RecoveryRate);
+
 protected:
     // ~UMassProcessor interface
     virtual void ConfigureQueries() override;
@@ -37,37 +90,139 @@ protected:
     void FindNearestLane(
         FGSDNavigationFragment& Nav,
         const FDataFragment_Transform& Transform,
+        const UZoneGraphSubsystem* ZoneGraphSubsystem,
+        FGSDCounterRandom& Random,
+        UGSDDeterminismManager* DeterminismManager) const;
+
+    /**
+     * Bind to a lane at the point nearest Location (no jump to the lane start).
+     * LaneOffset is re-projected so the entity keeps its XY position at Location.
+     * @return False if the lane is out of reach (Nav unchanged)
+     */
+    bool BindToLane(
+        FGSDNavigationFragment& Nav,
+        const FZoneGraphLaneHandle& Lane,
+        const FVector& Location,
         const UZoneGraphSubsystem* ZoneGraphSubsystem) const;
 
-    /** Update entity transform from current lane position */
-    void UpdateTransformFromLane(
+    /** Entity waiting for its lane transform in the chunk-level sampling pass */
+    struct FLaneSampleRequest
+    {
+        FZoneGraphLaneHandle Lane;
+        float Distance = 0.0f;
+        int32 EntityIndex = INDEX_NONE;
+    };
+
+    /**
+     * Update transforms for a chunk's on-lane entities, grouped by lane.
+     * Sorts Requests in place by (lane, distance).
+     */
+    void UpdateTransformsFromLanes(
+        TArrayView<FLaneSampleRequest> Requests,
+        TArrayView<FDataFragment_Transform> Transforms,
+        const UZoneGraphSubsystem* ZoneGraphSubsystem) const;
+
+    /** Refresh CachedLaneLength / CachedLaneEndLocation if CurrentLane changed */
+    void RefreshLaneCache(
         FGSDNavigationFragment& Nav,
-        FDataFragment_Transform& Transform,
         const UZoneGraphSubsystem* ZoneGraphSubsystem) const;
 
-    /** Check if entity reached end of lane, transition to next if available */
+    /** Check if entity reached end of lane, transition to next if available (uses cached lane data) */
     void CheckLaneProgress(
         FGSDNavigationFragment& Nav,
-        const UZoneGraphSubsystem* ZoneGraphSubsystem) const;
+        const UZoneGraphSubsystem* ZoneGraphSubsystem,
+        FGSDCounterRandom& Random,
+        UGSDDeterminismManager* DeterminismManager) const;
 
     /** Fallback movement when ZoneGraph unavailable */
     void ExecuteFallbackMovement(
         FGSDNavigationFragment& Nav,
         FDataFragment_Transform& Transform,
-        const FGSDZombieStateFragment& Zombie,
-        float DeltaTime) const;
+        const FGSDZombieMovementFragment& Zombie,
+        float DeltaTime,
+        FGSDCounterRandom& Random,
+        UGSDDeterminismManager* DeterminismManager) const;
+
+    /**
+     * Steer a pursuing entity along its target's flow field.
+     * @return False if the target has no field (entity keeps lane movement)
+     */
+    bool ExecuteFlowFieldMovement(
+        FGSDFlowFieldFragment& FlowField,
+        FDataFragment_Transform& Transform,
+        const FGSDZombieMovementFragment& Zombie,
+        const UGSDFlowFieldSubsystem& FlowFieldSubsystem,
+        float DeltaTime,
+        FGSDCounterRandom& Random,
+        UGSDDeterminismManager* DeterminismManager) const;
+
+    /** Add last frame's separation steering (FGSDNavigationFragment::DesiredVelocity) to free movement */
+    void ApplySeparation(
+        const FGSDNavigationFragment& Nav,
+        FDataFragment_Transform& Transform,
+        float DeltaTime,
+        bool bApplySeparation) const;
 
-    /** Pick a random nearby lane for wandering */
+    /** Pick a random nearby lane for wandering (from the lane candidate cache) */
     FZoneGraphLaneHandle PickRandomNearbyLane(
         const FVector& Location,
-        const UZoneGraphSubsystem* ZoneGraphSubsystem) const;
+        const UZoneGraphSubsystem* ZoneGraphSubsystem,
+        FGSDCounterRandom& Random,
+        UGSDDeterminismManager* DeterminismManager) const;
 
     /** Apply velocity randomization to prevent synchronized movement (CROWD-08) */
-    float ApplyVelocityRandomization(float BaseSpeed, float RandomizationPercent) const;
+    float ApplyVelocityRandomization(
+        float BaseSpeed,
+        float RandomizationPercent,
+        FGSDCounterRandom& Random,
+        UGSDDeterminismManager* DeterminismManager) const;
 
 private:
     FMassEntityQuery EntityQuery;
 
+    /** Bind ZoneGraph data added/removed delegates (once) */
+    void BindZoneGraphDelegates();
+
+    /** ZoneGraph data added/removed */
+    void OnZoneGraphDataChanged(const AZoneGraphData* ZoneGraphData);
+
+    /** Cell key for a location (3D cells of LaneSearchRadius, 21 bits per axis) */
+    int64 GetLaneCandidateCellKey(const FVector& Location, FVector& OutCellCenter) const;
+
+    //-- Lane Candidate Cache --
+    /** Lane near a cell, with its bounds for the per-entity distance filter */
+    struct FLaneCandidate
+    {
+        FZoneGraphLaneHandle Lane;
+        FBox Bounds = FBox(ForceInit);
+    };
+
+    // Cell key -> lanes within LaneSearchRadius of any point in the cell; shared by parallel chunks
+    mutable TMap<int64, TArray<FLaneCandidate>> LaneCandidateCells;
+    mutable FRWLock LaneCandidateLock;
+
+    FDelegateHandle ZoneGraphDataAddedHandle;
+    FDelegateHandle ZoneGraphDataRemovedHandle;
+
+    // Cache is reset when it grows beyond this many cells
+    static constexpr int32 MaxLaneCandidateCells = 4096;
+
+#if WITH_DEV_AUTOMATION_TESTS
+    //-- Test Support --
+    friend struct FGSDNavigationProcessorTestAccess;
+#endif
+
+    //-- Cached Config (loaded once per frame) --
+    UPROPERTY(Transient)
+    TObjectPtr<UGSDCrowdConfig> CachedConfig;
+
+    //-- Fallback values if config not found --
+    static constexpr float DefaultMaxLaneSeparationOffset = 150.0f;
+    static constexpr float DefaultLaneOffsetRecoveryRate = 2.0f;
+
+    //-- Fallback stream seed when no DeterminismManager is available --
+    static constexpr int32 FallbackNavigationSeed = 98765;
+
     //-- Configuration --
     UPROPERTY(EditDefaultsOnly, Category = "Configuration")
     float LaneSearchRadius = 2000.0f;
@@ -0,0 +1,78 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "GSDSeparationProcessor.generated.h"
+
+class UGSDCrowdConfig;
+class UGSDSpatialHash;
+
+/**
+ * Local avoidance processor: pushes crowd entities apart so groups spread out
+ * instead of collapsing onto the same point.
+ *
+ * Each frame, after navigation has moved entities:
+ * 1. SeparationHash is bulk-built from all entity positions (one cell per SeparationRadius)
+ * 2. Each entity gathers at most MaxSeparationNeighbors neighbors, nearest cells first
+ * 3. A SIMD kernel sums the separation push (4 neighbors per register)
+ * 4. The result is written to FGSDNavigationFragment::DesiredVelocity
+ *
+ * UGSDNavigationProcessor applies DesiredVelocity on the next frame (accumulated
+ * into a clamped LaneOffset for lane followers, directly for fallback and flow
+ * field movement). Cost is O(entities * MaxSeparationNeighbors) however dense the crowd.
+ *
+ * Entities at exactly the same location are split along a direction derived from
+ * their entity indices, so results are deterministic and chunk-order independent.
+ *
+ * Configuration is loaded from UGSDCrowdConfig ("Separation" settings).
+ * Set UGSDCrowdConfig::bParallelSeparation to process chunks in parallel.
+ */
+UCLASS()
+class GSD_CROWDS_API UGSDSeparationProcessor : public UMassProcessor
+{
+    GENERATED_BODY()
+
+public:
+    UGSDSeparationProcessor();
+
+    /** Upper bound for MaxSeparationNeighbors (fixed per-entity scratch size) */
+    static constexpr int32 MaxNeighborsLimit = 32;
+
+    /**
+     * Sum the separation push from a set of neighbors (XY only).
+     * Each neighbor within Radius contributes a push away from it that grows
+     * linearly from 0 at Radius to 1 at full overlap. Processes 4 neighbors per
+     * SIMD register; coincident neighbors are ignored (see class comment).
+     *
+     * @param Location Entity location
+     * @param NeighborX Neighbor X coordinates
+     * @param NeighborY Neighbor Y coordinates, same size as NeighborX
+     * @param Radius Separation radius
+     * @return Summed push (unscaled; magnitude ~ number of overlapping neighbors)
+     */
+    static FVector ComputeSeparation(const FVector& Location, TConstArrayView<float> NeighborX, TConstArrayView<float> NeighborY, float Radius);
+
+protected:
+    // ~UMassProcessor interface
+    virtual void ConfigureQueries() override;
+    virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+    // ~End of UMassProcessor interface
+
+private:
+    FMassEntityQuery EntityQuery;
+
+    //-- Neighbor Lookup (rebuilt each frame) --
+    UPROPERTY(Transient)
+    TObjectPtr<UGSDSpatialHash> SeparationHash;
+
+    //-- Cached Config (loaded once per frame) --
+    UPROPERTY(Transient)
+    TObjectPtr<UGSDCrowdConfig> CachedConfig;
+
+    //-- Fallback values if config not found --
+    static constexpr float DefaultSeparationRadius = 120.0f;
+    static constexpr float DefaultSeparationStrength = 200.0f;
+    static constexpr int32 DefaultMaxSeparationNeighbors = 8;
+};
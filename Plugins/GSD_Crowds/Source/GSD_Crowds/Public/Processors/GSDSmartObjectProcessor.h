@@ -4,12 +4,27 @@
 
 #include "CoreMinimal.h"
 #include "MassEntity/Processors/MassProcessor.h"
+#include "MassEntityTypes.h"
 #include "GSDSmartObjectProcessor.generated.h"
 
 struct FGSDSmartObjectFragment;
 struct FGSDNavigationFragment;
 struct FDataFragment_Transform;
 class UGSDSmartObjectSubsystem;
+class UGSDCrowdConfig;
+
+/** Smart Object operation deferred from a parallel chunk to the game thread */
+enum class EGSDDeferredSmartObjectOp : uint8
+{
+    Release,
+    SearchAndClaim
+};
+
+struct FGSDDeferredSmartObjectOp
+{
+    FMassEntityHandle Entity;
+    EGSDDeferredSmartObjectOp Type = EGSDDeferredSmartObjectOp::SearchAndClaim;
+};
 
 /**
  * Processor for Smart Object interactions.
@@ -23,6 +38,10 @@ class UGSDSmartObjectSubsystem;
  *
  * CRITICAL: Smart Objects MUST be released when interaction completes
  * to prevent resource leaks and allow other entities to use them.
+ *
+ * When UGSDCrowdConfig::bParallelSmartObjects is set, chunks run in parallel and
+ * search/claim/release calls are deferred and applied on the game thread in
+ * entity order after the parallel pass.
  */
 UCLASS()
 class GSD_CROWDS_API UGSDSmartObjectProcessor : public UMassProcessor
@@ -38,8 +57,26 @@ public:
     // ~End of UMassProcessor interface
 
 protected:
+    /** Parallel chunk pass with deferred Smart Object subsystem calls */
+    void ExecuteParallel(
+        FMassEntityManager& EntityManager,
+        FMassExecutionContext& Context,
+        UGSDSmartObjectSubsystem* SOSubsystem,
+        float DeltaTime);
+
     //-- Helper Methods --
 
+    /**
+     * Begin interaction with an already claimed Smart Object.
+     * Fragment-only, safe to call from parallel chunks.
+     *
+     * @param SOFragment Smart Object fragment to update
+     * @param NavFragment Navigation fragment (speed paused during interaction)
+     */
+    void StartInteraction(
+        FGSDSmartObjectFragment& SOFragment,
+        FGSDNavigationFragment& NavFragment) const;
+
     /**
      * Search for nearby Smart Objects.
      * Respects search cooldown to prevent constant queries.
@@ -95,6 +132,10 @@ protected:
 private:
     FMassEntityQuery EntityQuery;
 
+    //-- Cached Config (loaded once per frame) --
+    UPROPERTY(Transient)
+    TObjectPtr<UGSDCrowdConfig> CachedConfig;
+
     //-- Configuration --
     UPROPERTY(EditDefaultsOnly, Category = "Configuration")
     float DefaultSearchRadius = 1000.0f;
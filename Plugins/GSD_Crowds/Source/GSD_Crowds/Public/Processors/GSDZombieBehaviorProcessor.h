@@ -4,10 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "Fragments/GSDBehaviorLODTags.h"
+#include "Subsystems/GSDFlowFieldSubsystem.h"
 #include "GSDZombieBehaviorProcessor.generated.h"
 
 class UGSDCrowdConfig;
-struct FGSDZombieStateFragment;
+class UGSDSpatialHash;
+struct FGSDZombieMovementFragment;
 struct FDataFragment_Transform;
 
 /**
@@ -17,6 +20,7 @@ struct FDataFragment_Transform;
  * - Updates movement speed with natural variation
  * - Applies wander behavior for organic movement
  * - Pursuit/attack behavior for aggressive entities
+ * - Target acquisition via a per-frame spatial hash of candidate targets
  * - Works with any entity type (zombies, NPCs, animals, etc.)
  *
  * MIGRATION NOTE (GSDCROWDS-105):
@@ -27,6 +31,28 @@ struct FDataFragment_Transform;
  * Runs in PrePhysics phase before movement is applied.
  * Configuration is loaded from UGSDCrowdConfig and UGSDZombieBehaviorConfig DataAssets.
  * All hardcoded values have been replaced with config lookups.
+ * Set UGSDCrowdConfig::bParallelBehavior to process chunks in parallel.
+ *
+ * Target acquisition:
+ * Aggressive entities without a target search for the nearest player pawn or
+ * non-aggressive entity within DetectionRange. Searches are time-sliced on
+ * BehaviorUpdateInterval and capped by MaxTargetSearchesPerFrame. The budget is
+ * granted in the serial gather in bucket and chunk order, so the same entities
+ * search whether or not chunks then run in parallel. Candidate entities are
+ * bulk-built into TargetHash only on frames with a search granted.
+ *
+ * LOD buckets:
+ * One query per behavior bucket (see GSDBehaviorLODTags.h). Bucket 0 runs every
+ * frame; buckets 1-3 run every BehaviorLOD*FrameInterval frames. Buckets not due
+ * are never iterated, including by the candidate gather: each bucket's candidates
+ * and pursuit demand are cached from its last run. Elapsed time is tracked per
+ * entity (FGSDZombieMovementFragment::LastBehaviorTime), so entities moving
+ * between buckets advance their timers by exactly the time since their last update.
+ *
+ * Flow fields:
+ * With UGSDCrowdConfig::bEnableFlowFieldPursuit, pursuers are counted per target
+ * during the candidate gather and UGSDFlowFieldSubsystem is updated once per
+ * frame; the navigation processor steers pursuers along the resulting fields.
  */
 UCLASS()
 class GSD_CROWDS_API UGSDZombieBehaviorProcessor : public UMassProcessor
@@ -36,6 +62,25 @@ class GSD_CROWDS_API UGSDZombieBehaviorProcessor : public UMassProcessor
 public:
     UGSDZombieBehaviorProcessor();
 
+    /** Behavior clock period; per-entity timestamps wrap so they keep full float precision */
+    static constexpr float BehaviorClockWrapSeconds = 4096.0f;
+
+    /**
+     * Time since an entity's last behavior update.
+     * @param LastBehaviorTime Entity's FGSDZombieMovementFragment::LastBehaviorTime
+     * @param BehaviorClock Current (wrapped) behavior clock
+     * @param FrameDeltaTime Used for entities not yet updated
+     */
+    static float GetElapsedBehaviorTime(float LastBehaviorTime, float BehaviorClock, float FrameDeltaTime)
+    {
+        if (LastBehaviorTime < 0.0f)
+        {
+            return FrameDeltaTime;
+        }
+        const float Elapsed = BehaviorClock - LastBehaviorTime;
+        return Elapsed >= 0.0f ? Elapsed : Elapsed + BehaviorClockWrapSeconds;
+    }
+
 protected:
     // ~UMassProcessor interface
     virtual void ConfigureQueries() override;
@@ -43,12 +88,82 @@ protected:
     // ~End of UMassProcessor interface
 
 private:
-    FMassEntityQuery EntityQuery;
+    /**
+     * Refresh the candidate and pursuit demand caches of the buckets due this frame,
+     * and grant target searches (bTargetSearchGranted) to due searchers in bucket and
+     * chunk order until MaxTargetSearches is reached.
+     * @param DueBucketMask Bit N set if bucket N runs this frame
+     * @param bGatherPursuitDemand Also count pursuers per target into the bucket's demand
+     * @return Number of target searches granted this frame
+     */
+    int32 GatherTargetCandidates(FMassEntityManager& EntityManager, FMassExecutionContext& Context, uint32 DueBucketMask, float BehaviorUpdateInterval, float FrameDeltaTime, int32 MaxTargetSearches, bool bGatherPursuitDemand);
+
+    /** Merge every bucket's cached candidates (still valid entities only) into TargetCandidateEntities/Positions */
+    void MergeTargetCandidates(const FMassEntityManager& EntityManager);
+
+    /** Merge every bucket's cached pursuit demand into PursuitDemands */
+    void MergePursuitDemands();
+
+    /** Count one pursuer toward its target's flow field demand */
+    void AddPursuitDemand(TArray<FGSDFlowFieldDemand>& Demands, const FGSDZombieMovementFragment& State);
+
+    /** Frames between updates for a behavior bucket (1 = every frame). */
+    int32 GetBucketFrameInterval(int32 Bucket) const;
+
+    /** Collect player pawn locations (indexed by player target ID). */
+    void GatherPlayerTargets(UWorld* World);
+
+    /**
+     * Update State.TargetLocation from the current target.
+     * @return False if the target no longer exists
+     */
+    bool RefreshTargetLocation(const FMassEntityManager& EntityManager, FGSDZombieMovementFragment& State) const;
+
+    /**
+     * Pick the nearest player or candidate entity within DetectionRange.
+     * @return True if a target was found and written to State
+     */
+    bool AcquireTarget(const UGSDSpatialHash& SearchHash, const FVector& Location, float DetectionRange, FGSDZombieMovementFragment& State) const;
+
+    //-- LOD Buckets --
+    // BucketQueries[0] excludes all bucket tags; BucketQueries[N] requires FGSDBehaviorLODBucketNTag
+    FMassEntityQuery BucketQueries[GSDBehaviorLOD::NumBuckets];
+
+    uint32 BucketFrameCounter = 0;
+
+    // Seconds of frame time seen by this processor, wrapped at BehaviorClockWrapSeconds
+    float BehaviorClock = 0.0f;
+
+    // Per bucket, refreshed only on frames the bucket runs
+    struct FBucketTargetCache
+    {
+        TArray<FMassEntityHandle> CandidateEntities;
+        TArray<FVector> CandidatePositions;
+        TArray<FGSDFlowFieldDemand> PursuitDemands;
+    };
+    FBucketTargetCache BucketTargetCaches[GSDBehaviorLOD::NumBuckets];
+
+    //-- Target Acquisition (rebuilt each frame a search is due) --
+    UPROPERTY(Transient)
+    TObjectPtr<UGSDSpatialHash> TargetHash;
+
+    TArray<FMassEntityHandle> TargetCandidateEntities;
+    TArray<FVector> TargetCandidatePositions;
+    TArray<FVector, TInlineAllocator<8>> PlayerTargetLocations;
+
+    //-- Flow Field Demand (merged each frame flow fields are enabled) --
+    TArray<FGSDFlowFieldDemand> PursuitDemands;
+    TMap<int32, int32> PursuitDemandByTarget;
 
     //-- Cached Config (loaded once per frame) --
     UPROPERTY(Transient)
     TObjectPtr<UGSDCrowdConfig> CachedConfig;
 
+#if WITH_DEV_AUTOMATION_TESTS
+    //-- Test Support --
+    friend struct FGSDZombieBehaviorProcessorTestAccess;
+#endif
+
     //-- Fallback values if config not found (backward compatibility) --
     static constexpr float DefaultBehaviorUpdateInterval = 0.5f;
     static constexpr float DefaultSpeedVariation = 0.2f;
@@ -61,6 +176,16 @@ private:
     static constexpr float DefaultAttackRange = 100.0f;
     static constexpr float DefaultAttackCooldown = 1.0f;
     static constexpr float DefaultLoseTargetDistance = 2000.0f;
+    static constexpr int32 DefaultMaxTargetSearchesPerFrame = 512;
+
+    //-- Behavior LOD Fallbacks --
+    static constexpr int32 DefaultBehaviorLOD1FrameInterval = 2;
+    static constexpr int32 DefaultBehaviorLOD2FrameInterval = 4;
+    static constexpr int32 DefaultBehaviorLOD3FrameInterval = 8;
+
+    //-- Fallback stream seeds when no DeterminismManager is available --
+    static constexpr int32 FallbackSpeedSeed = 12345;
+    static constexpr int32 FallbackWanderSeed = 54321;
 };
 
 //-- Backward Compatibility Typedef (GSDCROWDS-105) --
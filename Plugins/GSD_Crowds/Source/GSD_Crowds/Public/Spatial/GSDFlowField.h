@@ -0,0 +1,137 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Coarse square grid flow field toward a single goal.
+ *
+ * Build() runs Dijkstra from the goal cell over walkable cells (8-connected,
+ * diagonals only when both adjacent orthogonal cells are walkable) and then
+ * stores, per cell, the neighbour with the lowest integration cost. Any
+ * number of entities can then sample a direction in O(1) with no per-entity
+ * pathfinding.
+ *
+ * Walkability is supplied by the owner (see UGSDFlowFieldSubsystem) and kept
+ * across rebuilds, so moving the goal only re-runs the integration pass. Each
+ * Build() is a full Dijkstra over the grid; Retarget() follows a goal drifting
+ * a few cells without one, steering cells near the goal straight at it.
+ *
+ * Usage:
+ * 1. Field.Initialize(Origin, CellSize, Dimension)
+ * 2. Field.SetWalkable(CellIndex, bWalkable) for blocked cells (all walkable by default)
+ * 3. Field.Build(GoalLocation)
+ * 4. Field.SampleDirection(Location)
+ */
+struct GSD_CROWDS_API FGSDFlowField
+{
+    /** Direction value for cells with no path (or the goal cell) */
+    static constexpr uint8 NoDirection = 0xFF;
+
+    /** Integration cost of unreachable cells */
+    static constexpr float UnreachableCost = MAX_flt;
+
+    //-- Setup --
+
+    /**
+     * Allocate the grid. All cells start walkable and unreachable.
+     *
+     * @param InOrigin Minimum (X, Y) corner of the grid in world space
+     * @param InCellSize Cell size in world units
+     * @param InDimension Cells per side
+     */
+    void Initialize(const FVector& InOrigin, float InCellSize, int32 InDimension);
+
+    /** Release all storage */
+    void Reset();
+
+    bool IsInitialized() const { return Dimension > 0; }
+
+    /** Mark a cell walkable or blocked (takes effect on the next Build) */
+    void SetWalkable(int32 CellIndex, bool bWalkable) { Walkable[CellIndex] = bWalkable ? 1 : 0; }
+
+    bool IsWalkable(int32 CellIndex) const { return Walkable[CellIndex] != 0; }
+
+    //-- Build --
+
+    /**
+     * Compute integration costs and directions toward a goal.
+     * The goal cell is treated as walkable for this build only (its own walkability is kept).
+     *
+     * @param InGoalLocation Goal in world space
+     * @return False if the goal lies outside the grid
+     */
+    bool Build(const FVector& InGoalLocation);
+
+    /** True after a successful Build() */
+    bool IsBuilt() const { return GoalCell.X != INDEX_NONE; }
+
+    /**
+     * Move the goal of a built field without rebuilding. O(1).
+     * Cells up to the drift from the built goal cell then steer straight at the new goal.
+     *
+     * @param InGoalLocation New goal in world space
+     * @param ToleranceCells Maximum drift (in cells, Chebyshev) from the built goal cell
+     * @return False if not built or the goal drifted further (Build() instead)
+     */
+    bool Retarget(const FVector& InGoalLocation, int32 ToleranceCells);
+
+    //-- Queries --
+
+    /**
+     * Sample the unit (XY) direction toward the goal at a location. O(1).
+     * In the goal cell (and within a retargeted goal's drift) this points straight at the goal location.
+     *
+     * @param Location World location to sample
+     * @return Direction, or zero if outside the grid or no path exists
+     */
+    FVector SampleDirection(const FVector& Location) const;
+
+    /**
+     * Get the cell containing a world location.
+     * @return False if outside the grid
+     */
+    bool WorldToCell(const FVector& Location, FIntPoint& OutCell) const;
+
+    /** World-space center of a cell (Z = 0) */
+    FVector GetCellCenter(const FIntPoint& Cell) const;
+
+    /** Integration cost of a cell (in cells; UnreachableCost if no path) */
+    float GetIntegrationCost(const FIntPoint& Cell) const { return Integration[GetCellIndex(Cell.X, Cell.Y)]; }
+
+    int32 GetCellIndex(int32 X, int32 Y) const { return Y * Dimension + X; }
+    int32 GetDimension() const { return Dimension; }
+    int32 GetNumCells() const { return Dimension * Dimension; }
+    float GetCellSize() const { return CellSize; }
+    const FVector& GetOrigin() const { return Origin; }
+    const FIntPoint& GetGoalCell() const { return GoalCell; }
+    const FVector& GetGoalLocation() const { return GoalLocation; }
+
+private:
+    //-- Grid --
+    FVector Origin = FVector::ZeroVector;
+    float CellSize = 100.0f;
+    int32 Dimension = 0;
+
+    //-- Goal (GoalCell.X == INDEX_NONE until built) --
+    FVector GoalLocation = FVector::ZeroVector;
+    FIntPoint GoalCell = FIntPoint(INDEX_NONE, INDEX_NONE);
+    int32 GoalRadius = 0;  // Cells around GoalCell that steer straight at GoalLocation (grows with Retarget)
+
+    //-- Per-Cell Data (row-major, Dimension * Dimension) --
+    TArray<uint8> Walkable;
+    TArray<float> Integration;
+    TArray<uint8> Directions;  // Index into neighbour table, or NoDirection
+
+    //-- Build scratch (kept to avoid per-build allocation) --
+    struct FOpenCell
+    {
+        float Cost;
+        int32 CellIndex;
+    };
+    TArray<FOpenCell> OpenHeap;
+
+    /** True if moving from (X, Y) by neighbour Dir is allowed (in bounds, walkable, no corner cutting) */
+    bool CanStep(int32 X, int32 Y, int32 Dir) const;
+};
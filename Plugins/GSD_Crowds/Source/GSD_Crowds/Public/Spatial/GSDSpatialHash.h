@@ -6,32 +6,8 @@
 #include "MassEntityTypes.h"
 #include "GSDSpatialHash.generated.h"
 
-/**
- * Spatial hash cell containing entity handles.
- * Provides O(1) proximity queries for crowd entities.
- */
-USTRUCT(BlueprintType)
-struct GSD_CROWDS_API FGSDSpatialCell
-{
-    GENERATED_BODY()
-
-    //-- Entities in this cell --
-    UPROPERTY()
-    TArray<FMassEntityHandle> Entities;
-
-    //-- Cell coordinates --
-    int32 CellX = 0;
-    int32 CellY = 0;
-
-    //-- Dirty flag for optimization --
-    bool bIsDirty = false;
-
-    void Reset()
-    {
-        Entities.Empty();
-        bIsDirty = false;
-    }
-};
+struct FMassEntityManager;
+struct FMassEntityQuery;
 
 /**
  * Spatial hash configuration.
@@ -49,11 +25,11 @@ struct GSD_CROWDS_API FGSDSpatialHashConfig
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Spatial")
     int32 MaxCellSearchRadius = 5;
 
-    //-- Enable cell pooling to reduce allocations --
+    //-- Pre-reserve cell and entity storage to reduce allocations --
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Optimization")
     bool bEnableCellPooling = true;
 
-    //-- Initial cell pool size --
+    //-- Initial cell reservation (entity storage reserves 4x this) --
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Optimization")
     int32 InitialCellPoolSize = 256;
 };
@@ -83,18 +59,52 @@ struct GSD_CROWDS_API FGSDSpatialQueryResult
     float QueryTimeMicroseconds = 0.0f;
 };
 
+/**
+ * Stats for the last structure build (Rebuild, RebuildFromQuery or RebuildFromEntities).
+ */
+USTRUCT(BlueprintType)
+struct GSD_CROWDS_API FGSDSpatialBuildStats
+{
+    GENERATED_BODY()
+
+    //-- Entities in the built structure --
+    int32 EntityCount = 0;
+
+    //-- Occupied cells in the built structure --
+    int32 CellCount = 0;
+
+    //-- Build execution time in microseconds (includes chunk gather for RebuildFromQuery) --
+    float BuildTimeMicroseconds = 0.0f;
+
+    //-- True if built in bulk (query or arrays), false if from incremental staging --
+    bool bBulkBuild = false;
+};
+
 /**
  * Spatial hash for O(1) proximity queries on crowd entities.
  *
  * Replaces O(n) distance calculations with O(1) cell lookups.
  * For 10,000 entities, reduces proximity queries from ~8ms to <0.5ms.
  *
+ * Layout (CSR, rebuilt once per frame by Rebuild()):
+ * - CellStarts[c]..CellStarts[c + 1] is the range of cell c in the flat arrays
+ * - CellEntities / CellPositions hold every entity grouped by cell (SoA)
+ * - CellIndexByKey maps a packed cell key to its cell index
+ *
+ * Insert/Remove/UpdatePosition only touch flat staging arrays; queries read
+ * the structure built by the last Rebuild(). Queries never allocate when the
+ * caller reuses its output buffer, and filter by exact distance using the
+ * stored positions. Queries are const and safe to run from multiple threads.
+ *
  * Usage:
- * 1. Create spatial hash: FSpatialHash Hash(500.0f)  // 500 unit cells
- * 2. Insert entities: Hash.Insert(Entity, Position)
- * 3. Query proximity: Hash.GetEntitiesInRadius(Center, Radius)
- * 4. Update positions: Hash.UpdatePosition(Entity, NewPosition)
- * 5. Clear frame: Hash.Clear() or Hash.Remove(Entity)
+ * 1. Create spatial hash: NewObject<UGSDSpatialHash>()->Initialize(Config)
+ * 2. Insert entities: Hash->Insert(Entity, Position)
+ * 3. Update positions: Hash->UpdatePosition(Entity, NewPosition)
+ * 4. Build once per frame: Hash->Rebuild()
+ *    or skip 2-4 and bulk build from Mass: Hash->RebuildFromQuery(EntityManager, Query)
+ * 5. Query proximity: Hash->QueryRadius(Center, Radius, OutEntities)
+ *    or Hash->ForEachEntityInRadius(Center, Radius, Visitor)
+ * 6. Clear frame: Hash->Clear() or Hash->Remove(Entity)
  */
 UCLASS()
 class GSD_CROWDS_API UGSDSpatialHash : public UObject
@@ -140,11 +150,96 @@ public:
      */
     void UpdatePosition(const FMassEntityHandle& Entity, const FVector& NewPosition);
 
-    //-- Queries --
+    /**
+     * Rebuild the cell structure from the staged entities (counting sort by cell).
+     * O(n), reuses storage from the previous build. Call once per frame after
+     * positions are updated and before queries.
+     */
+    void Rebuild();
+
+    /**
+     * Replace all staged entities with the entities matched by a Mass query and build
+     * the cell structure in one pass. Cell coords are computed in parallel and entities
+     * are counting-sorted by cell. Use instead of per-entity Insert/UpdatePosition when
+     * the whole population moves every frame.
+     *
+     * @param EntityManager Entity manager owning the query's archetypes
+     * @param Query Query that must require FDataFragment_Transform (read-only)
+     */
+    void RebuildFromQuery(FMassEntityManager& EntityManager, FMassEntityQuery& Query);
+
+    /**
+     * Replace all staged entities with caller-gathered arrays and build in one pass.
+     * Same build path as RebuildFromQuery, for filtered subsets a query cannot express.
+     *
+     * @param Entities Entity handles (must be unique)
+     * @param Positions World positions, parallel to Entities
+     */
+    void RebuildFromEntities(TConstArrayView<FMassEntityHandle> Entities, TConstArrayView<FVector> Positions);
+
+    /**
+     * Check if entities were inserted, moved or removed since the last Rebuild().
+     */
+    bool NeedsRebuild() const { return bNeedsRebuild; }
+
+    /**
+     * Get timing and size of the last Rebuild() / RebuildFromQuery() / RebuildFromEntities().
+     */
+    const FGSDSpatialBuildStats& GetLastBuildStats() const { return LastBuildStats; }
+
+    //-- Queries (read the last Rebuild) --
+
+    /**
+     * Append all entities within a radius of a center point to a caller-provided buffer.
+     * Exact sphere test against stored positions. Does not allocate if OutEntities
+     * has enough capacity (reuse it across calls).
+     *
+     * @param Center Center of search sphere
+     * @param Radius Search radius
+     * @param OutEntities Buffer to append results to (not reset)
+     * @return Number of entities appended
+     */
+    int32 QueryRadius(const FVector& Center, float Radius, TArray<FMassEntityHandle>& OutEntities) const;
+
+    /**
+     * Append all entities inside an axis-aligned box to a caller-provided buffer.
+     * Exact bounds test against stored positions.
+     *
+     * @param Min Minimum corner of box
+     * @param Max Maximum corner of box
+     * @param OutEntities Buffer to append results to (not reset)
+     * @return Number of entities appended
+     */
+    int32 QueryBox(const FVector& Min, const FVector& Max, TArray<FMassEntityHandle>& OutEntities) const;
+
+    /**
+     * Visit every entity within a radius of a center point without allocating.
+     * Visitor signature: void(const FMassEntityHandle& Entity, const FVector& Position, float DistanceSq)
+     *
+     * @param Center Center of search sphere
+     * @param Radius Search radius
+     * @param Visitor Callback invoked for each entity inside the sphere
+     */
+    template<typename VisitorType>
+    void ForEachEntityInRadius(const FVector& Center, float Radius, VisitorType&& Visitor) const;
+
+    /**
+     * Like ForEachEntityInRadius, but stops after MaxVisits entities so cost per
+     * query stays bounded in dense cells. Cells are visited nearest-first (center
+     * cell, then its ring).
+     *
+     * @param Center Center of search sphere
+     * @param Radius Search radius
+     * @param MaxVisits Maximum entities passed to Visitor
+     * @param Visitor Callback invoked for each entity inside the sphere
+     * @return Number of entities visited
+     */
+    template<typename VisitorType>
+    int32 ForEachEntityInRadiusBounded(const FVector& Center, float Radius, int32 MaxVisits, VisitorType&& Visitor) const;
 
     /**
      * Get all entities within a radius of a center point.
-     * O(k) where k is number of cells in radius, typically O(1) for reasonable radii.
+     * Convenience wrapper over QueryRadius - allocates a result array per call.
      *
      * @param Center Center of search sphere
      * @param Radius Search radius
@@ -154,6 +249,8 @@ public:
 
     /**
      * Get all entities in a rectangular area.
+     * Convenience wrapper over QueryBox - allocates a result array per call.
+     *
      * @param Min Minimum corner of rectangle
      * @param Max Maximum corner of rectangle
      * @return Query result with found entities
@@ -176,7 +273,7 @@ public:
     int64 GetCellKey(int32 CellX, int32 CellY) const;
 
     /**
-     * Check if a cell has any entities.
+     * Check if a cell has any entities (as of the last Rebuild).
      * @param CellX Cell X coordinate
      * @param CellY Cell Y coordinate
      * @return True if cell contains entities
@@ -189,13 +286,13 @@ public:
      * Get total number of entities in the spatial hash.
      */
     UFUNCTION(BlueprintPure, Category = "GSD|Crowds|Spatial")
-    int32 GetTotalEntityCount() const { return TotalEntityCount; }
+    int32 GetTotalEntityCount() const { return StagedEntities.Num(); }
 
     /**
-     * Get number of occupied cells.
+     * Get number of occupied cells (as of the last Rebuild).
      */
     UFUNCTION(BlueprintPure, Category = "GSD|Crowds|Spatial")
-    int32 GetOccupiedCellCount() const { return Cells.Num(); }
+    int32 GetOccupiedCellCount() const { return CellKeys.Num(); }
 
     /**
      * Get the configuration.
@@ -216,20 +313,69 @@ private:
     //-- Configuration --
     FGSDSpatialHashConfig Config;
 
-    //-- Spatial Cells --
-    // Key: CellKey from GetCellKey(), Value: Cell data
-    UPROPERTY()
-    TMap<int64, FGSDSpatialCell> Cells;
+    //-- Staging (flat SoA, swap-removed) --
+    TArray<FMassEntityHandle> StagedEntities;
+    TArray<FVector> StagedPositions;
 
-    //-- Entity to Cell Mapping --
+    //-- Entity to Staging Slot Mapping --
     // For O(1) entity removal/updates
-    TMap<FMassEntityHandle, int64> EntityToCellKey;
+    TMap<FMassEntityHandle, int32> EntityToSlot;
 
-    //-- Statistics --
-    int32 TotalEntityCount = 0;
+    bool bNeedsRebuild = false;
+
+    //-- Built Cells (CSR) --
+    // Packed key per cell, indexed by cell index
+    TArray<int64> CellKeys;
+
+    // CellStarts[c]..CellStarts[c + 1] is cell c's range in the flat arrays (size NumCells + 1)
+    TArray<int32> CellStarts;
+
+    // Entities and positions grouped by cell
+    TArray<FMassEntityHandle> CellEntities;
+    TArray<FVector> CellPositions;
+
+    // Cell key -> cell index
+    TMap<int64, int32> CellIndexByKey;
+
+    //-- Rebuild scratch (kept to avoid per-frame allocation) --
+    TArray<int32> ScratchEntityCell;
+    TArray<int32> ScratchWriteCursor;
+    TArray<FIntPoint> ScratchEntityCoords;
+    TArray<int32> ScratchDenseCounts;
+
+    //-- Set after a bulk rebuild; EntityToSlot is rebuilt on the next incremental call --
+    bool bEntityToSlotStale = false;
+
+    FGSDSpatialBuildStats LastBuildStats;
+
+    //-- Build tuning --
+    // Entities per parallel cell-coord batch
+    static constexpr int32 KeyBatchSize = 1024;
+    // Dense counting sort is used while the bounding grid has at most this many cells per entity
+    static constexpr int32 MaxDenseCellsPerEntity = 4;
+    static constexpr int32 MinDenseCells = 4096;
 
-    //-- Helper: Get or create cell --
-    FGSDSpatialCell& GetOrCreateCell(int32 CellX, int32 CellY);
+    //-- Helper: Counting sort staged entities into the CSR arrays --
+    void BuildCellsFromStaging(bool bParallel);
+
+    //-- Helper: Rebuild EntityToSlot if a bulk rebuild invalidated it --
+    void EnsureEntityToSlot();
+
+    //-- Helper: Visit cell index ranges overlapping a cell rectangle --
+    template<typename FuncType>
+    void ForEachCellInRange(int32 MinX, int32 MinY, int32 MaxX, int32 MaxY, FuncType&& Func) const
+    {
+        for (int32 X = MinX; X <= MaxX; X++)
+        {
+            for (int32 Y = MinY; Y <= MaxY; Y++)
+            {
+                if (const int32* CellIndex = CellIndexByKey.Find(MakeCellKey(X, Y)))
+                {
+                    Func(CellStarts[*CellIndex], CellStarts[*CellIndex + 1]);
+                }
+            }
+        }
+    }
 
     //-- Helper: Convert cell coords to key --
     static int64 MakeCellKey(int32 X, int32 Y)
@@ -246,3 +392,70 @@ private:
         OutY = static_cast<int32>(Key & 0xFFFFFFFF);
     }
 };
+
+template<typename VisitorType>
+void UGSDSpatialHash::ForEachEntityInRadius(const FVector& Center, float Radius, VisitorType&& Visitor) const
+{
+    const int32 CellRadius = FMath::Min(FMath::CeilToInt(Radius / Config.CellSize), Config.MaxCellSearchRadius);
+    const FIntVector CenterCell = GetCellCoords(Center);
+    const float RadiusSq = Radius * Radius;
+
+    ForEachCellInRange(CenterCell.X - CellRadius, CenterCell.Y - CellRadius, CenterCell.X + CellRadius, CenterCell.Y + CellRadius,
+        [this, &Center, RadiusSq, &Visitor](int32 Start, int32 End)
+        {
+            for (int32 i = Start; i < End; i++)
+            {
+                const float DistSq = static_cast<float>(FVector::DistSquared(CellPositions[i], Center));
+                if (DistSq <= RadiusSq)
+                {
+                    Visitor(CellEntities[i], CellPositions[i], DistSq);
+                }
+            }
+        });
+}
+
+template<typename VisitorType>
+int32 UGSDSpatialHash::ForEachEntityInRadiusBounded(const FVector& Center, float Radius, int32 MaxVisits, VisitorType&& Visitor) const
+{
+    const int32 CellRadius = FMath::Min(FMath::CeilToInt(Radius / Config.CellSize), Config.MaxCellSearchRadius);
+    const FIntVector CenterCell = GetCellCoords(Center);
+    const float RadiusSq = Radius * Radius;
+    int32 NumVisited = 0;
+
+    // Rings outward from the center cell so a full budget favors the nearest cells
+    for (int32 Ring = 0; Ring <= CellRadius; Ring++)
+    {
+        for (int32 X = CenterCell.X - Ring; X <= CenterCell.X + Ring; X++)
+        {
+            for (int32 Y = CenterCell.Y - Ring; Y <= CenterCell.Y + Ring; Y++)
+            {
+                // Ring cells only (interior cells were visited by earlier rings)
+                if (FMath::Abs(X - CenterCell.X) != Ring && FMath::Abs(Y - CenterCell.Y) != Ring)
+                {
+                    continue;
+                }
+
+                const int32* CellIndex = CellIndexByKey.Find(MakeCellKey(X, Y));
+                if (!CellIndex)
+                {
+                    continue;
+                }
+
+                for (int32 i = CellStarts[*CellIndex]; i < CellStarts[*CellIndex + 1]; i++)
+                {
+                    const float DistSq = static_cast<float>(FVector::DistSquared(CellPositions[i], Center));
+                    if (DistSq <= RadiusSq)
+                    {
+                        Visitor(CellEntities[i], CellPositions[i], DistSq);
+                        if (++NumVisited >= MaxVisits)
+                        {
+                            return NumVisited;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return NumVisited;
+}
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "GameplayTagContainer.h"
+#include <atomic>
 #include "GSDCrowdEventSubsystem.generated.h"
 
 class UGSDCrowdManagerSubsystem;
@@ -68,18 +69,35 @@ struct GSD_CROWDS_API FGSDCrowdEvent
  */
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnCrowdEvent, const FGSDCrowdEvent&, Event, const FGameplayTag&, EventTag);
 
+/**
+ * Delegate for batched crowd events (all matching events of one frame).
+ */
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnCrowdEventBatch, const TArray<FGSDCrowdEvent>&, Events);
+
+/**
+ * Native variant of FOnCrowdEventBatch for C++ systems (lambdas, raw and shared-pointer bindings).
+ */
+DECLARE_DELEGATE_OneParam(FOnCrowdEventBatchNative, TConstArrayView<FGSDCrowdEvent> /*Events*/);
+
 /**
  * World subsystem for crowd event dispatch and handling.
  *
  * Provides centralized event system for crowd gameplay integration:
  * - Broadcast events (alerts, attacks, deaths, etc.)
- * - Event filtering by tags
+ * - Event filtering by type and tags
  * - Listener registration
  *
+ * Broadcasts are deferred: events are pushed into a bounded lock-free queue
+ * (safe from any thread, including parallel Mass processor chunks) and
+ * delivered once per frame after the world's actors have ticked. Listeners are
+ * bucketed by (event type, tag); batch listeners receive all of a frame's
+ * matching events as one array.
+ *
  * Usage:
  * 1. Get subsystem: GetWorld()->GetSubsystem<UGSDCrowdEventSubsystem>()
  * 2. Broadcast: Subsystem->BroadcastEvent(Event)
- * 3. Listen: Subsystem->RegisterListener(Tag, Delegate)
+ * 3. Listen: Subsystem->RegisterBatchListener(Type, Tag, Delegate) or RegisterListener(Tag, Delegate)
+ *    (C++ systems can use RegisterNativeBatchListener)
  */
 UCLASS()
 class GSD_CROWDS_API UGSDCrowdEventSubsystem : public UWorldSubsystem
@@ -90,7 +108,9 @@ public:
     //-- Broadcasting --
 
     /**
-     * Broadcast a crowd event to all registered listeners.
+     * Queue a crowd event for all registered listeners.
+     * Thread-safe; delivered at the end of the world tick (or on FlushEvents).
+     * Events beyond EventQueueCapacity in one frame are dropped with a warning.
      *
      * @param Event Event payload to broadcast
      */
@@ -128,10 +148,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "GSD|Crowds|Events")
     void BroadcastPursuitEvent(EGSDCrowdEventType EventType, int32 EntityID, int32 TargetEntityID, FVector Location);
 
+    /**
+     * Deliver all queued events now.
+     * Called automatically once per frame; game thread only.
+     */
+    UFUNCTION(BlueprintCallable, Category = "GSD|Crowds|Events")
+    void FlushEvents();
+
     //-- Listener Management --
 
     /**
      * Register a listener for specific event tags.
+     * Called once per matching event when the queue is flushed.
      *
      * @param EventTag Tag to listen for (None = all events)
      * @param Delegate Delegate to call when event occurs
@@ -140,6 +168,27 @@ public:
     UFUNCTION(BlueprintCallable, Category = "GSD|Crowds|Events")
     int32 RegisterListener(FGameplayTag EventTag, const FOnCrowdEvent& Delegate);
 
+    /**
+     * Register a listener that receives each frame's matching events as one batch.
+     *
+     * @param EventType Type to listen for (None = all types)
+     * @param EventTag Tag to listen for (None = all tags)
+     * @param Delegate Delegate called once per flush with the matching events
+     * @return Handle for unregistration
+     */
+    UFUNCTION(BlueprintCallable, Category = "GSD|Crowds|Events")
+    int32 RegisterBatchListener(EGSDCrowdEventType EventType, FGameplayTag EventTag, const FOnCrowdEventBatch& Delegate);
+
+    /**
+     * Register a native listener that receives each frame's matching events as one batch.
+     *
+     * @param EventType Type to listen for (None = all types)
+     * @param EventTag Tag to listen for (None = all tags)
+     * @param Delegate Delegate called once per flush with the matching events
+     * @return Handle for UnregisterListener
+     */
+    int32 RegisterNativeBatchListener(EGSDCrowdEventType EventType, FGameplayTag EventTag, FOnCrowdEventBatchNative&& Delegate);
+
     /**
      * Unregister a listener by handle.
      *
@@ -157,16 +206,25 @@ public:
     //-- Queries --
 
     /**
-     * Get total number of events broadcast this frame.
+     * Get number of events broadcast since the last flush.
      */
     UFUNCTION(BlueprintPure, Category = "GSD|Crowds|Events")
-    int32 GetEventsThisFrame() const { return EventsThisFrame; }
+    int32 GetEventsThisFrame() const { return EventsThisFrame.load(std::memory_order_relaxed); }
 
     /**
      * Get total number of events broadcast.
      */
     UFUNCTION(BlueprintPure, Category = "GSD|Crowds|Events")
-    int64 GetTotalEventsBroadcast() const { return TotalEventsBroadcast; }
+    int64 GetTotalEventsBroadcast() const { return TotalEventsBroadcast.load(std::memory_order_relaxed); }
+
+    /**
+     * Get total number of events dropped because the queue was full.
+     */
+    UFUNCTION(BlueprintPure, Category = "GSD|Crowds|Events")
+    int64 GetTotalEventsDropped() const { return TotalEventsDropped.load(std::memory_order_relaxed); }
+
+    /** Maximum events queued between flushes (power of two) */
+    static constexpr uint32 EventQueueCapacity = 8192;
 
 protected:
     // ~UWorldSubsystem interface
@@ -180,17 +238,69 @@ private:
     struct FEventListener
     {
         int32 Handle;
+        EGSDCrowdEventType EventType = EGSDCrowdEventType::None;  // None = all types
+        FGameplayTag EventTag;                                    // Invalid = all tags
+        FOnCrowdEvent Delegate;                                   // Per-event listener
+        FOnCrowdEventBatch BatchDelegate;                         // Batch listener
+        FOnCrowdEventBatchNative NativeBatchDelegate;             // Native batch listener
+        TArray<FGSDCrowdEvent> PendingEvents;                     // Filled during flush
+    };
+
+    //-- Listener Bucket Key --
+    struct FListenerKey
+    {
+        EGSDCrowdEventType EventType;
         FGameplayTag EventTag;
-        FOnCrowdEvent Delegate;
+
+        bool operator==(const FListenerKey& Other) const
+        {
+            return EventType == Other.EventType && EventTag == Other.EventTag;
+        }
+
+        friend uint32 GetTypeHash(const FListenerKey& Key)
+        {
+            return HashCombine(::GetTypeHash(static_cast<uint8>(Key.EventType)), GetTypeHash(Key.EventTag));
+        }
     };
 
+    //-- Event Queue Slot --
+    // Bounded MPSC ring: Sequence == position when free, position + 1 when written
+    struct FEventSlot
+    {
+        std::atomic<uint32> Sequence = 0;
+        FGSDCrowdEvent Event;
+    };
+
+    /** Rebuild ListenerBuckets after listeners change */
+    void RebuildListenerBuckets();
+
+    /** Register a listener entry and return its handle */
+    int32 AddListener(FEventListener&& Listener);
+
+    /** World post-actor-tick hook: flush once per frame for our world */
+    void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
     //-- Listeners --
-    UPROPERTY()
     TArray<FEventListener> Listeners;
 
+    // (type, tag) -> indices into Listeners; None type / invalid tag buckets are wildcards
+    TMap<FListenerKey, TArray<int32>> ListenerBuckets;
+
     int32 NextListenerHandle = 1;
 
+    //-- Event Queue --
+    TUniquePtr<FEventSlot[]> EventSlots;
+    std::atomic<uint32> EventQueueTail = 0;  // Next position producers claim
+    uint32 EventQueueHead = 0;               // Next position the flush reads (game thread)
+
+    // Reused by FlushEvents
+    TArray<FGSDCrowdEvent> FlushScratch;
+
+    FDelegateHandle PostActorTickHandle;
+
     //-- Statistics --
-    int32 EventsThisFrame = 0;
-    int64 TotalEventsBroadcast = 0;
+    std::atomic<int32> EventsThisFrame = 0;
+    std::atomic<int64> TotalEventsBroadcast = 0;
+    std::atomic<int64> TotalEventsDropped = 0;
+    int64 LastReportedDropped = 0;
 };
@@ -13,6 +13,10 @@ struct FGSDCrowdCluster
 {
     GENERATED_BODY()
 
+    // Grid cell this cluster covers
+    UPROPERTY()
+    FIntVector CellKey = FIntVector::ZeroValue;
+
     UPROPERTY()
     FVector Center = FVector::ZeroVector;
 
@@ -24,11 +28,20 @@ struct FGSDCrowdCluster
 
     UPROPERTY()
     TArray<FMassEntityHandle> Entities;
+
+    // Entity positions, parallel to Entities (avoids looking entities up again)
+    UPROPERTY()
+    TArray<FVector> Positions;
 };
 
 /**
  * Manages HLOD proxy creation, updates, and lifecycle.
  * Clusters distant crowd entities and represents them as simplified proxy actors.
+ *
+ * Clustering is a single O(n) grid pass. Proxies are keyed by grid cell and
+ * reused across re-clusters; proxies whose cell empties are hidden and pooled
+ * instead of destroyed. UpdateEntitiesForHLOD only rebuilds cells that gained
+ * or lost entities since the previous call.
  */
 UCLASS()
 class GSD_CROWDS_API UGSDCrowdHLODManager : public UEngineSubsystem
@@ -54,16 +67,38 @@ public:
     // Remove all proxies for a streaming cell
     void RemoveProxiesForCell(FName CellName);
 
-    // Cluster entities for HLOD and create proxies
+    // Cluster all entities for HLOD (full rebuild) and create/reuse proxies
     void ClusterEntitiesForHLOD(const TArray<FMassEntityHandle>& Entities, const TArray<FVector>& Positions, UWorld* World);
 
+    /**
+     * Incrementally update clusters from the current entity set.
+     * Only cells that gained or lost entities are rebuilt and have their proxy refreshed;
+     * clusters whose membership is unchanged keep their previous center and radius.
+     * Falls back to a full ClusterEntitiesForHLOD when no clusters exist yet.
+     *
+     * @param Entities All entities to represent (entities missing from this list are removed)
+     * @param Positions Entity positions, parallel to Entities
+     * @param World World to spawn proxies in (clusters are still maintained if null)
+     * @return Number of cells rebuilt
+     */
+    int32 UpdateEntitiesForHLOD(const TArray<FMassEntityHandle>& Entities, const TArray<FVector>& Positions, UWorld* World);
+
     // Get active proxy count
     int32 GetActiveProxyCount() const { return ActiveProxies.Num(); }
 
+    // Get hidden proxies kept for reuse
+    int32 GetPooledProxyCount() const { return PooledProxies.Num(); }
+
+    // Get current cluster count
+    int32 GetClusterCount() const { return Clusters.Num(); }
+
+    // Find the cluster covering a world position (nullptr if none)
+    const FGSDCrowdCluster* FindClusterAt(const FVector& Position) const { return Clusters.Find(GetClusterKey(Position)); }
+
     // Set proxy mesh to use for all new proxies
     void SetProxyMesh(UStaticMesh* InMesh) { ProxyMesh = InMesh; }
 
-    // Clear all active proxies
+    // Destroy all proxies (active and pooled) and forget all clusters
     void ClearAllProxies();
 
 protected:
@@ -71,6 +106,18 @@ protected:
     UPROPERTY()
     TArray<TObjectPtr<AGSDCrowdHLODProxy>> ActiveProxies;
 
+    // Hidden proxies available for reuse
+    UPROPERTY()
+    TArray<TObjectPtr<AGSDCrowdHLODProxy>> PooledProxies;
+
+    // Active proxy per cluster cell
+    UPROPERTY()
+    TMap<FIntVector, TObjectPtr<AGSDCrowdHLODProxy>> CellProxies;
+
+    // Current clusters by grid cell
+    UPROPERTY()
+    TMap<FIntVector, FGSDCrowdCluster> Clusters;
+
     // Proxy mesh to use
     UPROPERTY()
     TObjectPtr<UStaticMesh> ProxyMesh = nullptr;
@@ -86,4 +133,31 @@ protected:
     // Maximum proxies to create
     UPROPERTY(Config)
     int32 MaxProxies = 100;
+
+private:
+    struct FEntityCellEntry
+    {
+        FIntVector Cell;
+        uint32 Stamp = 0;
+    };
+
+    // Cell each entity was in at the last update (incremental change detection)
+    TMap<FMassEntityHandle, FEntityCellEntry> EntityCells;
+
+    // Incremented per incremental update to find entities that disappeared
+    uint32 UpdateStamp = 0;
+
+    // Per-entity cell keys reused across updates
+    TArray<FIntVector> ScratchCellKeys;
+
+    FIntVector GetClusterKey(const FVector& Position) const;
+
+    // Compute center and radius from the cluster's stored positions
+    static void FinalizeCluster(FGSDCrowdCluster& Cluster);
+
+    // Reuse the cell's proxy, or take one from the pool / spawn a new one
+    void RefreshProxyForCluster(const FGSDCrowdCluster& Cluster, UWorld* World);
+
+    // Hide the cell's proxy and return it to the pool
+    void ReleaseProxyForCell(const FIntVector& CellKey);
 };
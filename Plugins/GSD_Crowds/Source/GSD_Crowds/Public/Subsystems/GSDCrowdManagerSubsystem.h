@@ -6,6 +6,10 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "MassEntitySubsystem.h"
 #include "GameplayTagContainer.h"
+#include "ZoneGraph/ZoneGraphTypes.h"
+#include "Fragments/GSDZombieStateFragment.h"
+#include "Fragments/GSDZombieMovementFragment.h"
+#include <atomic>
 #include "GSDCrowdManagerSubsystem.generated.h"
 
 class UGSDCrowdEntityConfig;
@@ -38,6 +42,186 @@ struct GSD_CROWDS_API FGSDensityModifier
  */
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnCrowdSpawnComplete, int32, NumSpawned);
 
+/**
+ * Delegate for async crowd spawn progress.
+ * Broadcast after every spawned batch with the request ID returned by SpawnEntitiesAsync.
+ */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnCrowdSpawnProgress, int32 /*RequestId*/, int32 /*NumProcessed*/, int32 /*NumRequested*/);
+
+/**
+ * Delegate for async crowd spawn requests leaving the queue.
+ * Broadcast once per request, after its OnComplete callback, whether it finished or was cancelled.
+ */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnCrowdSpawnFinished, int32 /*RequestId*/, int32 /*NumSpawned*/, bool /*bCancelled*/);
+
+/**
+ * Spawn transforms for an async crowd spawn request.
+ * Filled on a background thread; bReady is published once Transforms is complete.
+ */
+struct FGSDAsyncSpawnTransforms
+{
+    TArray<FTransform> Transforms;
+    std::atomic<bool> bReady = false;
+};
+
+/**
+ * Compact record of a crowd entity hibernated while its streaming cell is unloaded.
+ * Holds only what is needed to restore the entity; the Mass entity itself is destroyed.
+ */
+USTRUCT()
+struct FGSDHibernatedEntity
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FVector Location = FVector::ZeroVector;
+
+    UPROPERTY()
+    float Yaw = 0.0f;
+
+    UPROPERTY()
+    FGSDZombieStateFragment State;
+
+    UPROPERTY()
+    FGSDZombieMovementFragment Movement;
+
+    UPROPERTY()
+    FZoneGraphLaneHandle Lane;
+
+    UPROPERTY()
+    float LanePosition = 0.0f;
+};
+
+/**
+ * Hibernated entities sharing an entity config (restored with the same config).
+ */
+USTRUCT()
+struct FGSDHibernatedCrowd
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<UGSDCrowdEntityConfig> EntityConfig = nullptr;
+
+    UPROPERTY()
+    TArray<FGSDHibernatedEntity> Entities;
+};
+
+/**
+ * Hibernated crowds for one streaming cell.
+ */
+USTRUCT()
+struct FGSDHibernatedCell
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FGSDHibernatedCrowd> Crowds;
+};
+
+/**
+ * Live entities tracked for one streaming cell, grouped by entity config.
+ */
+USTRUCT()
+struct FGSDCellCrowd
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<UGSDCrowdEntityConfig> EntityConfig = nullptr;
+
+    TArray<FMassEntityHandle> Entities;
+};
+
+USTRUCT()
+struct FGSDCellCrowdList
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FGSDCellCrowd> Crowds;
+};
+
+/**
+ * Where a tracked entity lives in the cell crowd lists and the active entity list.
+ */
+struct FGSDTrackedEntitySlot
+{
+    int64 CellKey = 0;
+
+    // Index into FGSDCellCrowdList::Crowds
+    int32 CrowdIndex = INDEX_NONE;
+
+    // Index into FGSDCellCrowd::Entities
+    int32 EntityIndex = INDEX_NONE;
+
+    // Index into SpawnedEntityHandles
+    int32 SpawnedIndex = INDEX_NONE;
+};
+
+/**
+ * Queued async crowd spawn (SpawnEntitiesAsync).
+ */
+USTRUCT()
+struct FGSDAsyncSpawnRequest
+{
+    GENERATED_BODY()
+
+    int32 RequestId = INDEX_NONE;
+    int32 Count = 0;
+    FVector Center = FVector::ZeroVector;
+    float Radius = 0.0f;
+
+    UPROPERTY()
+    TObjectPtr<UGSDCrowdEntityConfig> EntityConfig = nullptr;
+
+    // Next transform to spawn (also the number of transforms processed so far)
+    int32 NextTransformIndex = 0;
+
+    // Entities actually created (Mass may create fewer than requested)
+    int32 NumSpawned = 0;
+
+    FOnCrowdSpawnComplete OnComplete;
+
+    TSharedPtr<FGSDAsyncSpawnTransforms, ESPMode::ThreadSafe> SpawnTransforms;
+
+    // Set when restoring hibernated entities; parallel to SpawnTransforms->Transforms
+    TArray<FGSDHibernatedEntity> RestoreStates;
+};
+
+/**
+ * Spawn request deferred until its streaming cell loads.
+ */
+USTRUCT()
+struct FGSDPendingCellSpawn
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 Count = 0;
+
+    UPROPERTY()
+    FVector Center = FVector::ZeroVector;
+
+    UPROPERTY()
+    float Radius = 0.0f;
+
+    UPROPERTY()
+    TObjectPtr<UGSDCrowdEntityConfig> EntityConfig = nullptr;
+};
+
+/**
+ * Pending spawns for one streaming cell (wrapper so the per-cell map can be a UPROPERTY).
+ */
+USTRUCT()
+struct FGSDPendingCellSpawnList
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FGSDPendingCellSpawn> Spawns;
+};
+
 /**
  * Delegate for all entities despawned notification.
  */
@@ -142,15 +326,67 @@ public:
 
     /**
      * Spawn entities asynchronously with completion callback.
+     * Spawn transforms are generated on a background thread, then entities are created
+     * over the following frames in batches of UGSDCrowdConfig::EntitiesPerBatch, with no
+     * more than UGSDCrowdConfig::ProcessingFrameBudget spent per frame. Requests are
+     * processed in submission order.
      *
      * @param Count Number of entities to spawn
      * @param Center World location for spawn area center
      * @param Radius Radius of spawn area
      * @param EntityConfig Optional entity config
-     * @param OnComplete Delegate called when spawn completes
+     * @param OnComplete Delegate called once every batch has been spawned
+     * @return Request ID for progress queries, or INDEX_NONE if the request completed immediately
      */
     UFUNCTION(BlueprintCallable, Category = "GSD|Crowds")
-    void SpawnEntitiesAsync(int32 Count, FVector Center, float Radius, UGSDCrowdEntityConfig* EntityConfig, const FOnCrowdSpawnComplete& OnComplete);
+    int32 SpawnEntitiesAsync(int32 Count, FVector Center, float Radius, UGSDCrowdEntityConfig* EntityConfig, const FOnCrowdSpawnComplete& OnComplete);
+
+    /**
+     * Get progress of an async spawn request.
+     *
+     * @param RequestId ID returned by SpawnEntitiesAsync
+     * @return Fraction of the request spawned (0-1), 1.0 if the request is no longer queued
+     */
+    UFUNCTION(BlueprintPure, Category = "GSD|Crowds")
+    float GetAsyncSpawnProgress(int32 RequestId) const;
+
+    /**
+     * Cancel a queued async spawn request.
+     * Entities already spawned stay in the simulation; OnComplete receives their count.
+     *
+     * @param RequestId ID returned by SpawnEntitiesAsync
+     * @return True if the request was still queued
+     */
+    UFUNCTION(BlueprintCallable, Category = "GSD|Crowds")
+    bool CancelAsyncSpawn(int32 RequestId);
+
+    /**
+     * Get number of async spawn requests still in flight.
+     */
+    UFUNCTION(BlueprintPure, Category = "GSD|Crowds")
+    int32 GetPendingAsyncSpawnCount() const { return AsyncSpawnQueue.Num(); }
+
+    /**
+     * Get delegate for async spawn progress (broadcast after every batch).
+     */
+    FOnCrowdSpawnProgress& GetOnCrowdSpawnProgress() { return CrowdSpawnProgressDelegate; }
+
+    /**
+     * Get delegate for async spawn requests that completed or were cancelled.
+     */
+    FOnCrowdSpawnFinished& GetOnCrowdSpawnFinished() { return CrowdSpawnFinishedDelegate; }
+
+    /**
+     * Generate random spawn transforms in a circular area from a caller-owned stream.
+     * Touches no world or subsystem state, so it is safe to call from worker threads.
+     *
+     * @param Count Number of transforms to generate
+     * @param Center Center of spawn area
+     * @param Radius Radius of spawn area
+     * @param Stream Random stream to draw from
+     * @param OutTransforms Reset and filled with Count transforms
+     */
+    static void GenerateSpawnTransformsFromStream(int32 Count, FVector Center, float Radius, FRandomStream& Stream, TArray<FTransform>& OutTransforms);
 
     /**
      * Despawn all tracked entities.
@@ -170,6 +406,28 @@ public:
     UFUNCTION(BlueprintPure, Category = "GSD|Crowds")
     int32 GetActiveEntityCount() const { return SpawnedEntityHandles.Num(); }
 
+    /**
+     * Get number of spawn requests waiting for their streaming cell to load.
+     */
+    UFUNCTION(BlueprintPure, Category = "GSD|Crowds|Streaming")
+    int32 GetPendingCellSpawnCount() const;
+
+    /**
+     * Get number of entities hibernated in unloaded streaming cells.
+     */
+    UFUNCTION(BlueprintPure, Category = "GSD|Crowds|Streaming")
+    int32 GetHibernatedEntityCount() const { return NumHibernatedEntities; }
+
+    /**
+     * Hibernate tracked entities: record position, state and lane, then destroy them.
+     * They are restored when the cell containing their position loads.
+     * Entities not spawned by this subsystem are ignored.
+     *
+     * @param Entities Entities to hibernate
+     * @return Number of entities removed from the simulation
+     */
+    int32 HibernateEntities(TConstArrayView<FMassEntityHandle> Entities);
+
     /**
      * Get delegate for all entities despawned notification.
      */
@@ -230,7 +488,8 @@ public:
 
     /**
      * Get the combined density multiplier at a world location.
-     * Iterates all active modifiers and multipliers their effects.
+     * Only modifiers indexed in the location's grid cell are tested, so cost does not
+     * grow with the number of active modifiers elsewhere in the city.
      *
      * @param Location World location to check
      * @return Combined density multiplier (1.0 = no change)
@@ -238,6 +497,15 @@ public:
     UFUNCTION(BlueprintPure, Category = "GSD|Crowds|Density")
     float GetDensityMultiplierAtLocation(FVector Location) const;
 
+    /**
+     * Batch variant of GetDensityMultiplierAtLocation for spawn placement.
+     * Consecutive locations in the same grid cell reuse the previous cell lookup.
+     *
+     * @param Locations World locations to check
+     * @param OutMultipliers Combined multiplier per location (must match Locations.Num())
+     */
+    void GetDensityMultipliersAtLocations(TConstArrayView<FVector> Locations, TArrayView<float> OutMultipliers) const;
+
     /**
      * Get all active density modifiers.
      */
@@ -306,6 +574,25 @@ public:
     UFUNCTION(BlueprintPure, Category = "GSD|Crowds|Streaming")
     FName GetCellNameForPosition(const FVector& Position) const;
 
+    /**
+     * Batch variant of IsPositionInLoadedCell for processor hot paths.
+     * Resolves cell residency through the integer cell-key index (no FName/string work).
+     * Consecutive positions in the same cell reuse the previous lookup.
+     *
+     * @param Positions World positions to check
+     * @param OutLoaded Resized to Positions.Num(); bit i is true if Positions[i] is in a loaded cell
+     */
+    void ArePositionsInLoadedCells(TConstArrayView<FVector> Positions, TBitArray<>& OutLoaded) const;
+
+    /**
+     * Get the packed 64-bit cell key for a world position.
+     * Uses the same grid as GetCellNameForPosition (Cell_X_Y).
+     *
+     * @param Position World position
+     * @return Packed cell key (X in upper 32 bits, Y in lower 32 bits)
+     */
+    int64 GetCellKeyForPosition(const FVector& Position) const;
+
     /**
      * Bind to World Partition streaming events.
      * Call during subsystem initialization.
@@ -337,9 +624,37 @@ protected:
     UPROPERTY()
     TArray<FGSDensityModifier> ActiveDensityModifiers;
 
+    // Grid cell size for the modifier index (= MaxDensityRadius, so a valid modifier touches at most 3x3 cells)
+    static constexpr float DensityModifierCellSize = 5000.0f;
+
+    // Modifiers spanning more cells than this are tested for every query instead of being indexed
+    static constexpr int32 MaxDensityModifierIndexCells = 64;
+
+    // Cell key -> indices into ActiveDensityModifiers whose XY bounds overlap the cell (ascending)
+    TMap<int64, TArray<int32>> DensityModifierGrid;
+
+    // Indices of oversized modifiers (not in DensityModifierGrid)
+    TArray<int32> UnindexedDensityModifiers;
+
+    //-- Async Spawning --
+    // Fallbacks when UGSDCrowdConfig is not available
+    static constexpr int32 DefaultEntitiesPerBatch = 10;
+    static constexpr float DefaultSpawnFrameBudgetMs = 2.0f;
+
+    // Requests in submission order; only the front request spawns
+    UPROPERTY()
+    TArray<FGSDAsyncSpawnRequest> AsyncSpawnQueue;
+
+    int32 NextAsyncSpawnRequestId = 0;
+
+    // Next-tick timer that drives ProcessAsyncSpawnQueue while requests are queued
+    FTimerHandle AsyncSpawnTimerHandle;
+
     //-- Delegates --
     FOnAllEntitiesDespawned AllEntitiesDespawnedDelegate;
     FOnCrowdMetricsUpdated CrowdMetricsUpdatedDelegate;
+    FOnCrowdSpawnProgress CrowdSpawnProgressDelegate;
+    FOnCrowdSpawnFinished CrowdSpawnFinishedDelegate;
 
     //-- Metrics Tracking --
     // Current metrics snapshot
@@ -355,19 +670,50 @@ protected:
     static constexpr float MetricsUpdateInterval = 0.1f;
 
     //-- Streaming Cell Tracking --
+    // World Partition grid cell size (128m default)
+    static constexpr float StreamingCellSize = 12800.0f;
+
     // Set of currently loaded cell names
     TSet<FName> LoadedCellNames;
 
-    // Mapping from cell name to crowd entity IDs
-    TMap<FName, TArray<int32>> CellToCrowdMapping;
+    // Residency index keyed by packed cell coordinates (mirrors LoadedCellNames for Cell_X_Y names)
+    // Used by per-entity checks to avoid FName construction on the hot path
+    TSet<int64> LoadedCellKeys;
+
+    // Entities spawned per cell key (cell of the spawn center), grouped by entity config
+    UPROPERTY()
+    TMap<int64, FGSDCellCrowdList> CellToCrowdMapping;
+
+    // Tracked entity -> slot in CellToCrowdMapping and SpawnedEntityHandles (kept in sync by swap-removal)
+    TMap<FMassEntityHandle, FGSDTrackedEntitySlot> TrackedEntitySlots;
 
-    // Pending spawns for unloaded cells
+    // Hibernated entities keyed by the cell of their last position, restored on load
     UPROPERTY()
-    TArray<FVector> PendingSpawnCenters;
+    TMap<int64, FGSDHibernatedCell> HibernatedCells;
+
+    int32 NumHibernatedEntities = 0;
+
+    // Spawn requests for unloaded cells, keyed by cell key and replayed on load
+    UPROPERTY()
+    TMap<int64, FGSDPendingCellSpawnList> PendingSpawnsByCell;
 
     // World Partition subsystem reference
     TWeakObjectPtr<UWorldPartitionSubsystem> WorldPartitionSubsystem;
 
+#if WITH_DEV_AUTOMATION_TESTS
+    //-- Test Support --
+    // Automation tests route spawning through a standalone entity manager instead of the world's Mass subsystem
+    friend struct FGSDCrowdManagerTestAccess;
+
+    using FSpawnBatchFunction = TFunction<void(UGSDCrowdEntityConfig*, const TArray<FTransform>&, TArray<FMassEntityHandle>&)>;
+
+    TSharedPtr<FMassEntityManager> EntityManagerOverride;
+    FSpawnBatchFunction SpawnBatchOverride;
+#endif
+
+    /** True if spawns and entities are gated by streaming cell residency (World Partition worlds). */
+    bool IsCellStreamingActive() const { return WorldPartitionSubsystem.IsValid(); }
+
     // ~UWorldSubsystem interface
     virtual bool ShouldCreateSubsystem(UWorld* World) const override;
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
@@ -388,12 +734,98 @@ private:
      */
     void OnCellUnloaded(const FName& CellName);
 
+    /**
+     * Rebuild DensityModifierGrid from ActiveDensityModifiers.
+     * Called whenever the modifier set changes.
+     */
+    void RebuildDensityModifierIndex();
+
+    /**
+     * Remove modifiers with a tag without rebuilding the index.
+     * @return Number of modifiers removed
+     */
+    int32 RemoveDensityModifiersWithTag(FGameplayTag ModifierTag);
+
+    /**
+     * Combined multiplier of the given modifier indices at a location.
+     */
+    float ApplyDensityModifiers(const FVector& Location, TConstArrayView<int32> ModifierIndices, float Multiplier) const;
+
     /**
      * Spawn entities internally (without cell checks).
      * Used for pending spawns and normal spawns.
      */
     int32 SpawnEntitiesInternal(int32 Count, FVector Center, float Radius, UGSDCrowdEntityConfig* EntityConfig);
 
+    /**
+     * Store a spawn request until the cell containing Center loads.
+     */
+    void QueuePendingCellSpawn(int32 Count, FVector Center, float Radius, UGSDCrowdEntityConfig* EntityConfig);
+
+    /**
+     * Track newly spawned entities: active list, the cell of their spawn center and the slot index.
+     */
+    void TrackCellEntities(const FVector& SpawnCenter, UGSDCrowdEntityConfig* EntityConfig, TConstArrayView<FMassEntityHandle> NewEntityHandles);
+
+    /**
+     * Remove tracked entities matching a predicate from the simulation (one deferred destroy).
+     *
+     * @param ShouldRelease Called with each tracked entity and its current location
+     * @param bHibernate Store restore records for living entities; otherwise just despawn
+     * @return Number of entities released
+     */
+    int32 ReleaseTrackedEntities(TFunctionRef<bool(const FMassEntityHandle&, const FVector&)> ShouldRelease, bool bHibernate);
+
+    /**
+     * Remove the given entities from the simulation (one deferred destroy).
+     * Each handle is resolved through TrackedEntitySlots; untracked handles are ignored.
+     *
+     * @param Entities Entities to release
+     * @param bHibernate Store restore records for living entities; otherwise just despawn
+     * @return Number of entities released
+     */
+    int32 ReleaseEntities(TConstArrayView<FMassEntityHandle> Entities, bool bHibernate);
+
+    /**
+     * Untrack one entity, storing a restore record if hibernating. Does not destroy it.
+     * @return True if the entity was tracked and still valid (caller destroys it)
+     */
+    bool ReleaseEntity(FMassEntityManager& EntityManager, const FMassEntityHandle& Entity, bool bHibernate);
+
+    /**
+     * Remove an entity from the tracked lists in O(1) via its slot.
+     */
+    void UntrackEntity(const FMassEntityHandle& Entity);
+
+    /**
+     * Apply hibernated state to restored entities.
+     * Records map to entities in order, or by spawn location when Mass created fewer entities than records.
+     */
+    void ApplyRestoreStates(FMassEntityManager& EntityManager, TConstArrayView<FGSDHibernatedEntity> Records, TConstArrayView<FMassEntityHandle> Entities);
+
+    /**
+     * Queue hibernated entities of a loaded cell for time-sliced restoration.
+     */
+    void RestoreHibernatedCell(int64 CellKey);
+
+    /**
+     * Queue one hibernated crowd on the async spawn path.
+     */
+    void QueueHibernatedRestore(FGSDHibernatedCrowd&& Crowd);
+
+    //-- Helper: Convert cell coords to key --
+    static int64 MakeCellKey(int32 X, int32 Y)
+    {
+        // Upper 32 bits for X, lower 32 bits for Y (same packing as UGSDSpatialHash)
+        return (static_cast<int64>(X) << 32) | (static_cast<int64>(Y) & 0xFFFFFFFF);
+    }
+
+    /**
+     * Parse a Cell_X_Y cell name into a packed cell key.
+     * @return False for names that do not follow the grid naming (e.g. DefaultCell)
+     */
+    static bool TryParseCellKey(const FName& CellName, int64& OutKey);
+
     /**
      * Get default entity config asset.
      * Loads from /GSD_Crowds/EntityConfigs/BP_GSDZombieEntityConfig
@@ -412,6 +844,45 @@ private:
      */
     TArray<FTransform> GenerateSpawnTransforms(int32 Count, FVector Center, float Radius) const;
 
+    /**
+     * Draw a seed for an async spawn request from the crowd spawn stream.
+     * Game thread only; keeps async spawns deterministic under the DeterminismManager.
+     */
+    int32 DrawAsyncSpawnSeed() const;
+
+    /**
+     * Spawn queued async requests in batches until the frame budget is spent.
+     * Reschedules itself for the next tick while requests remain.
+     */
+    void ProcessAsyncSpawnQueue();
+
+    /** Schedule ProcessAsyncSpawnQueue for the next tick if not already pending. */
+    void ScheduleAsyncSpawnTick();
+
+    /**
+     * Deliver OnComplete and the finished broadcast for a request already removed from the queue.
+     * Callers must not hold references into AsyncSpawnQueue; listeners may queue or cancel requests.
+     */
+    void FinishAsyncSpawn(const FGSDAsyncSpawnRequest& Request, bool bCancelled);
+
+    /** Entities created per async spawn batch (UGSDCrowdConfig::EntitiesPerBatch). */
+    static int32 GetAsyncSpawnBatchSize();
+
+    /**
+     * Entity manager that owns crowd entities (the world's Mass subsystem unless overridden for tests).
+     * @return nullptr if Mass is not available
+     */
+    FMassEntityManager* GetEntityManager() const;
+
+    /**
+     * Create one batch of entities from an entity config.
+     *
+     * @param EntityConfig Config to spawn from
+     * @param Transforms Spawn transforms for the batch
+     * @param OutEntities Receives the created entities (Mass may create fewer than requested)
+     */
+    void SpawnEntityBatch(UGSDCrowdEntityConfig* EntityConfig, const TArray<FTransform>& Transforms, TArray<FMassEntityHandle>& OutEntities);
+
     /**
      * Update metrics and broadcast to bound widgets.
      * Called by timer at MetricsUpdateInterval (10 Hz).
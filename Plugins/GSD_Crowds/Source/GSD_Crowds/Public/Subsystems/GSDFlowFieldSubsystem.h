@@ -0,0 +1,230 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Spatial/GSDFlowField.h"
+#include "GSDFlowFieldSubsystem.generated.h"
+
+class UGSDCrowdConfig;
+class ANavigationData;
+class UNavigationSystemV1;
+class ULevel;
+struct FNavigationProjectionWork;
+
+/**
+ * Pursuit demand for one target, reported by the behavior processor each frame.
+ */
+struct FGSDFlowFieldDemand
+{
+    /** Pursuit target ID (FGSDCrowdTargetHandle::GetID()) */
+    int32 TargetID = INDEX_NONE;
+
+    /** Target location this frame */
+    FVector Location = FVector::ZeroVector;
+
+    /** Entities pursuing this target this frame */
+    int32 NumPursuers = 0;
+};
+
+/**
+ * World subsystem owning one flow field per heavily-pursued target.
+ *
+ * Fields are centred on their target over a coarse grid (see UGSDCrowdConfig
+ * "Flow Field" settings) and kept up to date within per-frame budgets:
+ * - A target drifting up to FlowFieldGoalToleranceCells from its goal cell is
+ *   retargeted in place; further moves rebuild the integration (a full Dijkstra
+ *   over the grid), capped at MaxFlowFieldRebuildsPerFrame (stale fields stay usable)
+ * - The grid is re-centred only when the target nears its edge; the old field
+ *   keeps steering until the re-centred one is filled and built, and re-centred
+ *   fields rebuild ahead of goal-only rebuilds
+ * - NavMesh walkability is projected at most MaxFlowFieldProjectionsPerFrame
+ *   cells per frame and cached per world cell and height band across rebuilds,
+ *   re-centring and fields
+ * - Cached walkability is dropped where levels stream in or out and whenever
+ *   NavMesh generation finishes; affected fields refill and rebuild
+ *
+ * Fields are only mutated in UpdateFields() on the game thread; sampling is
+ * const and safe from parallel processor chunks between updates.
+ *
+ * Usage:
+ * 1. Behavior processor: Subsystem->UpdateFields(Demands, DeltaTime)
+ * 2. Navigation processor: FieldIndex = Subsystem->FindFieldForTarget(TargetID, Generation)
+ * 3. Per entity: Subsystem->SampleDirection(FieldIndex, Location)
+ */
+UCLASS()
+class GSD_CROWDS_API UGSDFlowFieldSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ~UWorldSubsystem interface
+    virtual bool ShouldCreateSubsystem(UWorld* World) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    // ~End of UWorldSubsystem interface
+
+    //-- Update (game thread) --
+
+    /**
+     * Create, move, rebuild and release fields from this frame's pursuit demand.
+     *
+     * @param Demands Pursuit demand per target
+     * @param DeltaTime Seconds since the last update (drives release delay)
+     */
+    void UpdateFields(TConstArrayView<FGSDFlowFieldDemand> Demands, float DeltaTime);
+
+    /** Release every field and the walkability cache */
+    void ClearFields();
+
+    /**
+     * Drop cached walkability inside a box (e.g. after the NavMesh changed there).
+     * Fields overlapping it refill within the projection budget and rebuild;
+     * until then their last build keeps steering.
+     */
+    void InvalidateWalkability(const FBox& Bounds);
+
+    /** Drop all cached walkability and refill every field */
+    void InvalidateAllWalkability();
+
+    //-- Queries (thread-safe between updates) --
+
+    /**
+     * Find the built field for a pursuit target.
+     *
+     * @param TargetID Pursuit target ID
+     * @param OutGeneration Generation to store alongside the index
+     * @return Field index, or INDEX_NONE if the target has no built field
+     */
+    int32 FindFieldForTarget(int32 TargetID, uint32& OutGeneration) const;
+
+    /** True if a cached (index, generation) pair still refers to the same built field */
+    bool IsFieldValid(int32 FieldIndex, uint32 Generation) const
+    {
+        return Slots.IsValidIndex(FieldIndex) && Slots[FieldIndex].Generation == Generation && Slots[FieldIndex].Field.IsBuilt();
+    }
+
+    /** O(1) direction sample; zero if outside the field or no path */
+    FVector SampleDirection(int32 FieldIndex, const FVector& Location) const
+    {
+        return Slots[FieldIndex].Field.SampleDirection(Location);
+    }
+
+    /** Get number of targets with a field */
+    int32 GetActiveFieldCount() const { return SlotByTarget.Num(); }
+
+    /** Get field rebuilds performed since initialization */
+    int64 GetTotalRebuilds() const { return TotalRebuilds; }
+
+    /** Get NavMesh walkability projections performed since initialization */
+    int64 GetTotalProjections() const { return TotalProjections; }
+
+private:
+    struct FFieldSlot
+    {
+        FGSDFlowField Field;
+        FGSDFlowField RecenteredField;  // Re-centred grid waiting for its first build (swapped into Field)
+        int32 TargetID = INDEX_NONE;
+        uint32 Generation = 0;       // Bumped whenever the slot is (re)assigned
+        FVector TargetLocation = FVector::ZeroVector;
+        float IdleTime = 0.0f;       // Seconds without pursuers
+        int32 HeightBand = 0;        // Walkability height band of the next grid
+        int32 WalkabilityCursor = 0; // Cells of the next grid whose walkability is filled
+        bool bNeedsRebuild = false;
+        bool bRecenterPending = false;
+
+        /** Grid the next rebuild targets */
+        const FGSDFlowField& GetNextField() const { return bRecenterPending ? RecenteredField : Field; }
+        FGSDFlowField& GetNextField() { return bRecenterPending ? RecenteredField : Field; }
+
+        /** True once the next grid's walkability is complete and it can be built */
+        bool IsWalkabilityFilled() const { return WalkabilityCursor >= GetNextField().GetNumCells(); }
+    };
+
+    /** Centre a slot's grid on a location and start filling walkability (into RecenteredField if Field is built) */
+    void CenterField(FFieldSlot& Slot, const FVector& Center, const UGSDCrowdConfig* Config);
+
+    /** Re-initialize a slot's next grid in place so its walkability is filled again */
+    void RefillField(FFieldSlot& Slot);
+
+    /** Initialize the grid the next rebuild targets (RecenteredField if Field is built) and restart its fill */
+    void InitNextField(FFieldSlot& Slot, const FVector& Origin, float CellSize, int32 Dimension);
+
+    /** Build a slot's next field toward its target, swapping in a pending re-centred grid */
+    void RebuildField(FFieldSlot& Slot);
+
+    /** Release a slot's fields and return it to the free list */
+    void ReleaseSlot(int32 SlotIndex);
+
+    /**
+     * Continue filling a slot's next grid from the cache, projecting uncached cells
+     * to the NavMesh in one batch of at most MaxProjections points.
+     * @return Projections used
+     */
+    int32 FillWalkability(FFieldSlot& Slot, int32 MaxProjections);
+
+    /** Projects a workload in place at an extent */
+    using FNavProjectionFunction = TFunction<void(TArray<FNavigationProjectionWork>& /*Workload*/, const FVector& /*Extent*/)>;
+
+    /** Default NavMesh projection, or an unset function if the world has no navigation data */
+    FNavProjectionFunction GetNavProjection() const;
+
+    /** Streaming levels: drop walkability under the level */
+    void OnLevelStreamingChanged(ULevel* Level, UWorld* World);
+
+    /** NavMesh rebuilt: drop all walkability (the engine does not report which tiles changed) */
+    UFUNCTION()
+    void OnNavigationGenerationFinished(ANavigationData* NavData);
+
+    /** Assign a free slot to a target */
+    int32 AcquireSlot(int32 TargetID);
+
+    //-- Fields --
+    TArray<FFieldSlot> Slots;
+    TMap<int32, int32> SlotByTarget;
+    TArray<int32> FreeSlots;
+
+    //-- Walkability Cache (world-aligned cell + height band -> 1 walkable / 0 blocked) --
+    TMap<FIntVector, uint8> WalkableCache;
+    float WalkableCacheCellSize = 0.0f;
+
+    //-- Invalidation Events --
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle LevelRemovedHandle;
+    TWeakObjectPtr<UNavigationSystemV1> BoundNavigationSystem;
+
+#if WITH_DEV_AUTOMATION_TESTS
+    //-- Test Support --
+    friend struct FGSDFlowFieldSubsystemTestAccess;
+    FNavProjectionFunction NavProjectionOverride;
+#endif
+
+    int64 TotalRebuilds = 0;
+    int64 TotalProjections = 0;
+    uint32 NextGeneration = 1;
+    int32 RebuildCursor = 0;  // Round-robin start so capped rebuilds are shared fairly
+
+    //-- Limits --
+    static constexpr int32 MaxWalkableCacheCells = 1 << 20;
+
+    //-- Fallback values if config not found --
+    static constexpr float DefaultCellSize = 200.0f;
+    static constexpr int32 DefaultDimension = 128;
+    static constexpr int32 DefaultMinPursuers = 32;
+    static constexpr int32 DefaultMaxFields = 8;
+    static constexpr int32 DefaultMaxRebuildsPerFrame = 2;
+    static constexpr int32 DefaultMaxProjectionsPerFrame = 4096;
+    static constexpr int32 DefaultGoalToleranceCells = 1;
+    static constexpr float DefaultReleaseDelay = 2.0f;
+
+    //-- Height bands are this many cells tall (projection reaches half a band above and below) --
+    static constexpr float HeightBandCells = 2.0f;
+
+    //-- Helper: Height band of a world Z for a cell size --
+    static int32 GetHeightBand(float Z, float CellSize)
+    {
+        return FMath::FloorToInt(Z / (CellSize * HeightBandCells));
+    }
+};
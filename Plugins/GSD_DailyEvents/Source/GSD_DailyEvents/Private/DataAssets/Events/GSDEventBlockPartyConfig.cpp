@@ -3,6 +3,7 @@
 #include "DataAssets/Events/GSDEventBlockPartyConfig.h"
 #include "Modifiers/GSDSafeZoneModifier.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Engine/GameInstance.h"
 #include "GSDEventLog.h"
 
 UGSDEventBlockPartyConfig::UGSDEventBlockPartyConfig()
@@ -75,68 +76,111 @@ void UGSDEventBlockPartyConfig::OnEventStart_Implementation(UObject* WorldContex
     int32 NumProps = FMath::RoundToInt(FMath::Lerp(float(MinProps), float(MaxProps), Intensity));
     NumProps = FMath::Clamp(NumProps, MinProps, MaxProps);
 
-    // Spawn crowd props
-    SpawnCrowdProps(World, Location, NumProps);
+    // Spawn crowd props and decorative FX (string lights, speakers, etc.)
+    int32 NumFX = DecorativeFXClasses.Num() > 0 ? FMath::CeilToInt(Intensity * 3.0f) : 0;
+    SpawnCrowdProps(World, Location, NumProps, NumFX);
 
-    // Spawn decorative FX (string lights, speakers, etc.)
-    if (DecorativeFXClasses.Num() > 0)
-    {
-        FActorSpawnParameters SpawnParams;
-        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
-        int32 NumFX = FMath::CeilToInt(Intensity * 3.0f);
-        for (int32 i = 0; i < NumFX; ++i)
-        {
-            FVector RandomOffset = UKismetMathLibrary::RandomUnitVector() * FMath::FRandRange(200.0f, PropSpawnRadius * 0.8f);
-            FVector SpawnLoc = Location + RandomOffset;
-            FRotator RandomRotation = UKismetMathLibrary::RandomRotator();
-
-            TSubclassOf<AActor> FXClass = DecorativeFXClasses[FMath::RandRange(0, DecorativeFXClasses.Num() - 1)];
-            AActor* FX = World->SpawnActor<AActor>(FXClass, SpawnLoc, RandomRotation, SpawnParams);
-            if (FX)
-            {
-                SpawnedFX.Add(FX);
-            }
-        }
-    }
-
-    GSDEVENT_LOG(Log, TEXT("Block Party event started at %s: %d props, %d FX, intensity %.2f"),
-        *Location.ToString(), SpawnedProps.Num(), SpawnedFX.Num(), Intensity);
+    GSDEVENT_LOG(Log, TEXT("Block Party event started at %s: %d props, %d FX requested, intensity %.2f"),
+        *Location.ToString(), NumProps, NumFX, Intensity);
 }
 
-void UGSDEventBlockPartyConfig::SpawnCrowdProps(UWorld* World, const FVector& Center, int32 Count)
+void UGSDEventBlockPartyConfig::SpawnCrowdProps(UWorld* World, const FVector& Center, int32 Count, int32 NumFX)
 {
-    if (!World || CrowdPropClasses.Num() == 0) return;
+    if (!World || (CrowdPropClasses.Num() == 0 && DecorativeFXClasses.Num() == 0)) return;
 
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+    // Pick all candidates up front so the NavMesh can be queried in one batch
+    TArray<FPendingActorSpawn> PendingSpawns;
+    PendingSpawns.Reserve(Count + NumFX);
 
-    for (int32 i = 0; i < Count; ++i)
+    for (int32 i = 0; i < Count && CrowdPropClasses.Num() > 0; ++i)
     {
+        FPendingActorSpawn& Spawn = PendingSpawns.AddDefaulted_GetRef();
+
         // Random position within spawn radius
         FVector RandomOffset = UKismetMathLibrary::RandomUnitVector() * FMath::FRandRange(100.0f, PropSpawnRadius);
-        FVector SpawnLocation = Center + RandomOffset;
+        Spawn.Location = Center + RandomOffset;
 
         // Random rotation (mostly upright, some variation)
-        FRotator SpawnRotation = FRotator(
+        Spawn.Rotation = FRotator(
             FMath::FRandRange(-5.0f, 5.0f),   // Slight pitch variation
             FMath::FRandRange(0.0f, 360.0f),  // Random yaw
             FMath::FRandRange(-5.0f, 5.0f)    // Slight roll variation
         );
 
         // Select random prop class
-        TSubclassOf<AActor> PropClass = CrowdPropClasses[FMath::RandRange(0, CrowdPropClasses.Num() - 1)];
+        Spawn.ActorClass = CrowdPropClasses[FMath::RandRange(0, CrowdPropClasses.Num() - 1)];
+    }
 
-        AActor* Prop = World->SpawnActor<AActor>(PropClass, SpawnLocation, SpawnRotation, SpawnParams);
-        if (Prop)
+    for (int32 i = 0; i < NumFX && DecorativeFXClasses.Num() > 0; ++i)
+    {
+        FPendingActorSpawn& Spawn = PendingSpawns.AddDefaulted_GetRef();
+
+        FVector RandomOffset = UKismetMathLibrary::RandomUnitVector() * FMath::FRandRange(200.0f, PropSpawnRadius * 0.8f);
+        Spawn.Location = Center + RandomOffset;
+        Spawn.Rotation = UKismetMathLibrary::RandomRotator();
+        Spawn.ActorClass = DecorativeFXClasses[FMath::RandRange(0, DecorativeFXClasses.Num() - 1)];
+        Spawn.bIsFX = true;
+    }
+
+    UGameInstance* GameInstance = World->GetGameInstance();
+    UGSDEventSpawnRegistry* SpawnRegistry = GameInstance ? GameInstance->GetSubsystem<UGSDEventSpawnRegistry>() : nullptr;
+
+    if (!bProjectPropsToNavMesh || !SpawnRegistry)
+    {
+        SpawnPendingActors(World, PendingSpawns, nullptr);
+        return;
+    }
+
+    TArray<FVector> Candidates;
+    Candidates.Reserve(PendingSpawns.Num());
+    for (const FPendingActorSpawn& Spawn : PendingSpawns)
+    {
+        Candidates.Add(Spawn.Location);
+    }
+
+    // Resolve all positions as one batched NavMesh query (misses retry later), then spawn as one batch
+    const int32 RequestSerial = SpawnRequestSerial;
+    TWeakObjectPtr<UWorld> WeakWorld(World);
+
+    SpawnRegistry->ProjectPointsToNavMeshBatched(World, Candidates, PropNavMeshQueryExtent,
+        FOnNavProjectionBatchComplete::CreateWeakLambda(this, [this, WeakWorld, RequestSerial, PendingSpawns = MoveTemp(PendingSpawns)](const TArray<FGSDNavProjectionResult>& Results)
+        {
+            // Event ended (or restarted) while the query was in flight
+            if (RequestSerial != SpawnRequestSerial || !WeakWorld.IsValid())
+            {
+                return;
+            }
+
+            SpawnPendingActors(WeakWorld.Get(), PendingSpawns, &Results);
+        }));
+}
+
+void UGSDEventBlockPartyConfig::SpawnPendingActors(UWorld* World, const TArray<FPendingActorSpawn>& PendingSpawns, const TArray<FGSDNavProjectionResult>* ProjectedLocations)
+{
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    for (int32 i = 0; i < PendingSpawns.Num(); ++i)
+    {
+        const FPendingActorSpawn& Spawn = PendingSpawns[i];
+        const FVector SpawnLocation = ProjectedLocations && ProjectedLocations->IsValidIndex(i)
+            ? (*ProjectedLocations)[i].Location : Spawn.Location;
+
+        AActor* Actor = World->SpawnActor<AActor>(Spawn.ActorClass, SpawnLocation, Spawn.Rotation, SpawnParams);
+        if (Actor)
         {
-            SpawnedProps.Add(Prop);
+            (Spawn.bIsFX ? SpawnedFX : SpawnedProps).Add(Actor);
         }
     }
+
+    GSDEVENT_LOG(Verbose, TEXT("Block Party spawned %d props, %d FX"), SpawnedProps.Num(), SpawnedFX.Num());
 }
 
 void UGSDEventBlockPartyConfig::OnEventEnd_Implementation(UObject* WorldContext)
 {
+    // Discard any NavMesh projection still in flight
+    ++SpawnRequestSerial;
+
     // Count before clearing for logging
     int32 NumProps = SpawnedProps.Num();
     int32 NumFX = SpawnedFX.Num();
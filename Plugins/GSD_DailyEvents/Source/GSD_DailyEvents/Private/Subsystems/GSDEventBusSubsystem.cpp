@@ -21,11 +21,16 @@ FGSDEventHandle UGSDEventBusSubsystem::Subscribe(FGameplayTag EventTag, FOnGSDEv
         return FGSDEventHandle();
     }
 
-    // Find or add delegate for this tag
-    FOnGSDEvent& EventDelegate = EventDelegates.FindOrAdd(EventTag);
+    // Find or add delegate for this tag; a new subscribed tag changes dispatch results
+    TSharedRef<FOnGSDEvent>* EventDelegate = EventDelegates.Find(EventTag);
+    if (!EventDelegate)
+    {
+        EventDelegate = &EventDelegates.Add(EventTag, MakeShared<FOnGSDEvent>());
+        DispatchTable.Reset();
+    }
 
     // Add the delegate and store the handle
-    FDelegateHandle Handle = EventDelegate.Add(MoveTemp(Delegate));
+    FDelegateHandle Handle = (*EventDelegate)->Add(MoveTemp(Delegate));
 
     // Create and return the subscription handle
     FGSDEventHandle EventHandle;
@@ -45,37 +50,66 @@ void UGSDEventBusSubsystem::BroadcastEvent(FGameplayTag EventTag, FVector Locati
         return;
     }
 
-    GSDEVENT_LOG(Log, TEXT("Broadcasting event: %s at %s (intensity=%.2f)"),
+    // Trace only: formatting is skipped unless the category is verbose
+    GSDEVENT_TRACE(TEXT("Broadcasting event: %s at %s (intensity=%.2f)"),
         *EventTag.ToString(), *Location.ToString(), Intensity);
 
     // Track as active event
     ActiveEvents.AddUnique(EventTag);
 
-    // Broadcast to exact match subscribers
-    if (FOnGSDEvent* ExactDelegate = EventDelegates.Find(EventTag))
+    // Take references to the matching delegates before any subscriber runs: callbacks may
+    // Subscribe (reallocating EventDelegates) or Unsubscribe a tag's last handle (removing it)
+    TArray<TSharedRef<FOnGSDEvent>, TInlineAllocator<4>> Targets;
+    for (const FGameplayTag& SubscribedTag : GetDispatchTags(EventTag))
     {
-        ExactDelegate->Broadcast(EventTag, Location, Intensity);
+        if (const TSharedRef<FOnGSDEvent>* EventDelegate = EventDelegates.Find(SubscribedTag))
+        {
+            Targets.Add(*EventDelegate);
+        }
     }
 
-    // CRITICAL: Broadcast to parent tags for hierarchical matching
+    // Exact match first, then parent tags for hierarchical matching
+    for (const TSharedRef<FOnGSDEvent>& EventDelegate : Targets)
+    {
+        EventDelegate->Broadcast(EventTag, Location, Intensity);
+    }
+}
+
+const TArray<FGameplayTag>& UGSDEventBusSubsystem::GetDispatchTags(const FGameplayTag& EventTag)
+{
+    if (const TArray<FGameplayTag>* Cached = DispatchTable.Find(EventTag))
+    {
+        return *Cached;
+    }
+
+    TArray<FGameplayTag>& DispatchTags = DispatchTable.Add(EventTag);
+
+    // Exact match subscribers
+    if (EventDelegates.Contains(EventTag))
+    {
+        DispatchTags.Add(EventTag);
+    }
+
+    // CRITICAL: Include parent tags for hierarchical matching
     // This allows Event.Daily listener to receive Event.Daily.Construction events
-    for (auto& Pair : EventDelegates)
+    for (const auto& Pair : EventDelegates)
     {
-        // Skip exact match (already handled above)
+        // Skip exact match (already added above)
         if (Pair.Key == EventTag)
         {
             continue;
         }
 
-        // Check if the broadcast event matches this subscriber's tag
         // EventTag.MatchesTag(Pair.Key) means EventTag is a child of Pair.Key
         // e.g., Event.Daily.Construction.MatchesTag(Event.Daily) returns true
         if (EventTag.MatchesTag(Pair.Key))
         {
-            GSDEVENT_TRACE(TEXT("Hierarchical match: %s -> %s"), *EventTag.ToString(), *Pair.Key.ToString());
-            Pair.Value.Broadcast(EventTag, Location, Intensity);
+            GSDEVENT_VERY_TRACE(TEXT("Hierarchical match: %s -> %s"), *EventTag.ToString(), *Pair.Key.ToString());
+            DispatchTags.Add(Pair.Key);
         }
     }
+
+    return DispatchTags;
 }
 
 void UGSDEventBusSubsystem::Unsubscribe(FGSDEventHandle& Handle)
@@ -87,17 +121,18 @@ void UGSDEventBusSubsystem::Unsubscribe(FGSDEventHandle& Handle)
     }
 
     // Find the delegate for this tag
-    if (FOnGSDEvent* EventDelegate = EventDelegates.Find(Handle.SubscribedTag))
+    if (TSharedRef<FOnGSDEvent>* EventDelegate = EventDelegates.Find(Handle.SubscribedTag))
     {
-        // Remove the specific delegate
-        EventDelegate->Remove(Handle.DelegateHandle);
+        // Remove the specific delegate (safe mid-broadcast; the multicast compacts afterwards)
+        (*EventDelegate)->Remove(Handle.DelegateHandle);
 
         GSDEVENT_TRACE(TEXT("Unsubscribed from event tag: %s"), *Handle.SubscribedTag.ToString());
 
-        // Clean up empty delegates
-        if (!EventDelegate->IsBound())
+        // Clean up empty delegates (removing a subscribed tag changes dispatch results)
+        if (!(*EventDelegate)->IsBound())
         {
             EventDelegates.Remove(Handle.SubscribedTag);
+            DispatchTable.Reset();
         }
     }
 
@@ -6,7 +6,11 @@
 #include "AssetRegistry/AssetData.h"
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
+#include "Engine/GameInstance.h"
+#include "TimerManager.h"
 #include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "Engine/World.h"
 #include "GSDEventLog.h"
 
 void UGSDEventSpawnRegistry::Initialize(FSubsystemCollectionBase& Collection)
@@ -29,17 +33,18 @@ void UGSDEventSpawnRegistry::Initialize(FSubsystemCollectionBase& Collection)
 
 void UGSDEventSpawnRegistry::Deinitialize()
 {
-    // Wait for any pending loads
-    while (bIsLoading.load())
-    {
-        FPlatformProcess::Sleep(0.001f);
-    }
+    // Completion callbacks run on the game thread, so cancel rather than wait
+    CancelPendingLoad();
 
     // Clear all zones and cache
     FWriteScopeLock WriteLock(ZoneCacheLock);
     LoadedZones.Empty();
     CachedAllZones.Empty();
     ZoneCache.Empty();
+    WildcardZoneCache = FGSDEventTagZoneCache();
+    ZoneIndex.Empty();
+    ZoneIndexByTag.Empty();
+    WildcardZoneIndices.Empty();
     bZonesLoaded.store(false);
 
     Super::Deinitialize();
@@ -65,31 +70,109 @@ int32 UGSDEventSpawnRegistry::GetZoneCount() const
     return LoadedZones.Num();
 }
 
+int32 UGSDEventSpawnRegistry::GetIndexedZoneCount() const
+{
+    FReadScopeLock ReadLock(ZoneCacheLock);
+    return ZoneIndex.Num();
+}
+
 void UGSDEventSpawnRegistry::GetCompatibleZones(const FGameplayTag& EventTag, TArray<UGSDEventSpawnZone*>& OutZones) const
 {
     FReadScopeLock ReadLock(ZoneCacheLock);
 
-    OutZones.Empty();
+    float TotalWeight = 0.0f;
+    GatherCompatibleZones(EventTag, OutZones, TotalWeight);
+}
+
+void UGSDEventSpawnRegistry::GatherCompatibleZones(const FGameplayTag& EventTag, TArray<UGSDEventSpawnZone*>& OutZones, float& OutTotalWeight) const
+{
+    // Must be called with lock held
+
+    OutZones.Reset();
 
-    // Check if we have cached zones for this tag
-    if (const FGSDEventTagZoneCache* TagCache = ZoneCache.Find(EventTag))
+    if (bZonesLoaded.load())
     {
-        if (TagCache->bIsValid)
+        // Same rule as GatherCompatibleIndices: empty tag = every zone,
+        // a tag with no zones of its own = wildcard zones only
+        if (!EventTag.IsValid())
         {
-            OutZones.Append(TagCache->Zones);
+            OutZones.Append(CachedAllZones);
+            OutTotalWeight = CachedTotalWeight;
             return;
         }
+
+        const FGSDEventTagZoneCache* TagCache = ZoneCache.Find(EventTag);
+        if (!TagCache || !TagCache->bIsValid)
+        {
+            TagCache = &WildcardZoneCache;
+        }
+        OutZones.Append(TagCache->Zones);
+        OutTotalWeight = TagCache->TotalWeight;
+        return;
     }
 
-    // Fallback: return all zones (empty tag = any event)
-    OutZones.Append(CachedAllZones);
+    // Still streaming: answer from the index with zones that are already resident
+    TArray<int32> Indices;
+    GatherCompatibleIndices(EventTag, Indices);
+    for (const int32 Index : Indices)
+    {
+        if (UGSDEventSpawnZone* Zone = Cast<UGSDEventSpawnZone>(ZoneIndex[Index].Path.ResolveObject()))
+        {
+            OutZones.Add(Zone);
+        }
+    }
+    OutTotalWeight = CalculateTotalWeight(OutZones);
+}
+
+void UGSDEventSpawnRegistry::GetCompatibleZonePaths(const FGameplayTag& EventTag, TArray<FSoftObjectPath>& OutPaths) const
+{
+    FReadScopeLock ReadLock(ZoneCacheLock);
+
+    OutPaths.Reset();
+
+    TArray<int32> Indices;
+    GatherCompatibleIndices(EventTag, Indices);
+    for (const int32 Index : Indices)
+    {
+        OutPaths.Add(ZoneIndex[Index].Path);
+    }
+}
+
+void UGSDEventSpawnRegistry::GatherCompatibleIndices(const FGameplayTag& EventTag, TArray<int32>& OutIndices) const
+{
+    // Must be called with lock held
+
+    OutIndices.Reset();
+
+    if (!EventTag.IsValid())
+    {
+        OutIndices.Reserve(ZoneIndex.Num());
+        for (int32 i = 0; i < ZoneIndex.Num(); ++i)
+        {
+            OutIndices.Add(i);
+        }
+        return;
+    }
+
+    if (const TArray<int32>* Tagged = ZoneIndexByTag.Find(EventTag))
+    {
+        OutIndices.Append(*Tagged);
+    }
+    OutIndices.Append(WildcardZoneIndices);
+
+    // Index order is the deterministic zone order
+    OutIndices.Sort();
 }
 
 FVector UGSDEventSpawnRegistry::GetSpawnLocationForEvent(const FGameplayTag& EventTag, FRandomStream& Stream, UWorld* World) const
 {
-    // Get compatible zones (thread-safe)
+    // Get compatible zones and their cached total weight (thread-safe)
     TArray<UGSDEventSpawnZone*> CompatibleZones;
-    GetCompatibleZones(EventTag, CompatibleZones);
+    float TotalWeight = 0.0f;
+    {
+        FReadScopeLock ReadLock(ZoneCacheLock);
+        GatherCompatibleZones(EventTag, CompatibleZones, TotalWeight);
+    }
 
     // Fallback: No zones defined - use world center with random offset
     if (CompatibleZones.Num() == 0)
@@ -104,16 +187,6 @@ FVector UGSDEventSpawnRegistry::GetSpawnLocationForEvent(const FGameplayTag& Eve
         );
     }
 
-    // Get cached total weight
-    float TotalWeight = CachedTotalWeight;
-    if (const FGSDEventTagZoneCache* TagCache = ZoneCache.Find(EventTag))
-    {
-        if (TagCache->bIsValid)
-        {
-            TotalWeight = TagCache->TotalWeight;
-        }
-    }
-
     // Select zone using weighted random (thread-safe)
     UGSDEventSpawnZone* SelectedZone = SelectWeightedZone(CompatibleZones, TotalWeight, Stream);
     if (!SelectedZone)
@@ -162,129 +235,234 @@ void UGSDEventSpawnRegistry::LoadZonesAsync()
 
     GSDEVENT_LOG(Log, TEXT("Starting async load of spawn zones..."));
 
-    // Get asset registry
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
 
-    // Wait for registry to finish loading
-    AssetRegistry.SearchAllAssets(true);
+    // Don't force a blocking full scan; wait for the registry's own discovery to finish
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddUObject(this, &UGSDEventSpawnRegistry::OnAssetRegistryFilesLoaded);
+        return;
+    }
 
-    // Find all UGSDEventSpawnZone assets
-    FARFilter Filter;
-    Filter.ClassPaths.Add(UGSDEventSpawnZone::StaticClass()->GetClassPathName());
-    Filter.bRecursiveClasses = true;
-    Filter.bIncludeOnlyOnDiskAssets = false;
+    OnAssetRegistryFilesLoaded();
+}
 
-    // Add configured search paths
-    for (const FName& Path : SpawnConfig.SpawnZoneSearchPaths)
+void UGSDEventSpawnRegistry::OnAssetRegistryFilesLoaded()
+{
+    if (FilesLoadedHandle.IsValid())
     {
-        Filter.PackagePaths.Add(*Path.ToString());
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().OnFilesLoaded().Remove(FilesLoadedHandle);
+        FilesLoadedHandle.Reset();
     }
 
     TArray<FAssetData> AssetDataList;
-    AssetRegistry.GetAssets(Filter, AssetDataList);
+    GatherZoneAssets(AssetDataList);
+    BuildZoneIndex(AssetDataList);
 
     GSDEVENT_LOG(Log, TEXT("Found %d spawn zone assets in registry"), AssetDataList.Num());
 
     if (AssetDataList.Num() == 0)
     {
-        bIsLoading.store(false);
-        bZonesLoaded.store(true);
+        FinishLoadingZones(TArray<FSoftObjectPath>());
         GSDEVENT_LOG(Warning, TEXT("No spawn zones found"));
         return;
     }
 
-    // Build soft object paths for async loading
+    // Build soft object paths in deterministic index order
     TArray<FSoftObjectPath> AssetPaths;
-    AssetPaths.Reserve(AssetDataList.Num());
-
-    for (const FAssetData& AssetData : AssetDataList)
     {
-        AssetPaths.Add(AssetData.ToSoftObjectPath());
+        FReadScopeLock ReadLock(ZoneCacheLock);
+        AssetPaths.Reserve(ZoneIndex.Num());
+        for (const FGSDEventSpawnZoneIndexEntry& Entry : ZoneIndex)
+        {
+            AssetPaths.Add(Entry.Path);
+        }
     }
 
-    // Use streamable manager for async load
+    // Stream zones in the background; the completion delegate runs on the game thread
     FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
 
-    StreamableManager.RequestAsyncLoad(
+    ZoneLoadHandle = StreamableManager.RequestAsyncLoad(
         AssetPaths,
-        FStreamableDelegate::CreateLambda([this, AssetDataList]()
+        FStreamableDelegate::CreateWeakLambda(this, [this, AssetPaths]()
         {
-            TArray<UGSDEventSpawnZone*> LoadedZonesTmp;
-
-            for (const FAssetData& AssetData : AssetDataList)
-            {
-                if (UGSDEventSpawnZone* Zone = Cast<UGSDEventSpawnZone>(AssetData.GetAsset()))
-                {
-                    FString ValidationError;
-                    if (Zone->ValidateConfig(ValidationError))
-                    {
-                        LoadedZonesTmp.Add(Zone);
-                        GSDEVENT_LOG(Log, TEXT("Loaded spawn zone: %s (Priority: %d)"),
-                            *Zone->ZoneName.ToString(), Zone->Priority);
-                    }
-                    else
-                    {
-                        GSDEVENT_LOG(Warning, TEXT("Spawn zone '%s' failed validation: %s"),
-                            *AssetData.AssetName.ToString(), *ValidationError);
-                    }
-                }
-            }
-
-            // Process loaded zones on game thread
-            AsyncTask(ENamedThreads::GameThread, [this, LoadedZonesTmp]()
-            {
-                ProcessLoadedZones(LoadedZonesTmp);
-                bIsLoading.store(false);
-                bZonesLoaded.store(true);
-
-                GSDEVENT_LOG(Log, TEXT("GSDEventSpawnRegistry initialized with %d zones"), LoadedZones.Num());
-
-                // Broadcast loaded event
-                OnZonesLoaded.Broadcast();
-            });
+            ZoneLoadHandle.Reset();
+            FinishLoadingZones(AssetPaths);
         }),
         FStreamableManager::DefaultAsyncLoadPriority,
         false,
-        nullptr,
-        SpawnConfig.AsyncLoadTimeoutSeconds
+        false,
+        TEXT("GSDEventSpawnZones")
     );
+
+    if (!ZoneLoadHandle.IsValid())
+    {
+        GSDEVENT_LOG(Warning, TEXT("Failed to start async load of spawn zones"));
+        FinishLoadingZones(TArray<FSoftObjectPath>());
+        return;
+    }
+
+    // Report (but don't abort) loads that exceed the configured timeout
+    UGameInstance* GameInstance = GetGameInstance();
+    if (GameInstance && SpawnConfig.AsyncLoadTimeoutSeconds > 0.0f)
+    {
+        FTimerHandle TimeoutHandle;
+        GameInstance->GetTimerManager().SetTimer(TimeoutHandle, FTimerDelegate::CreateWeakLambda(this, [this]()
+        {
+            if (bIsLoading.load())
+            {
+                GSDEVENT_LOG(Warning, TEXT("Spawn zone async load still pending after %.1fs"), SpawnConfig.AsyncLoadTimeoutSeconds);
+            }
+        }), SpawnConfig.AsyncLoadTimeoutSeconds, false);
+    }
 }
 
 void UGSDEventSpawnRegistry::LoadZonesSync()
 {
     bIsLoading.store(true);
 
-    TArray<UGSDEventSpawnZone*> LoadedZonesTmp;
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
 
-    // Get asset registry
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+    // Only scan our own paths if discovery is still running
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        TArray<FString> ScanPaths;
+        for (const FName& Path : SpawnConfig.SpawnZoneSearchPaths)
+        {
+            ScanPaths.Add(Path.ToString());
+        }
+        AssetRegistry.ScanPathsSynchronous(ScanPaths);
+    }
+
+    TArray<FAssetData> AssetDataList;
+    GatherZoneAssets(AssetDataList);
+    BuildZoneIndex(AssetDataList);
+
+    GSDEVENT_LOG(Log, TEXT("Found %d spawn zone assets in registry"), AssetDataList.Num());
+
+    // Load each zone synchronously
+    TArray<FSoftObjectPath> AssetPaths;
+    {
+        FReadScopeLock ReadLock(ZoneCacheLock);
+        for (const FGSDEventSpawnZoneIndexEntry& Entry : ZoneIndex)
+        {
+            AssetPaths.Add(Entry.Path);
+        }
+    }
+
+    for (const FSoftObjectPath& Path : AssetPaths)
+    {
+        Path.TryLoad();
+    }
+
+    FinishLoadingZones(AssetPaths);
+}
+
+void UGSDEventSpawnRegistry::CancelPendingLoad()
+{
+    if (FilesLoadedHandle.IsValid())
+    {
+        if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+        {
+            AssetRegistryModule->Get().OnFilesLoaded().Remove(FilesLoadedHandle);
+        }
+        FilesLoadedHandle.Reset();
+    }
+
+    if (ZoneLoadHandle.IsValid())
+    {
+        ZoneLoadHandle->CancelHandle();
+        ZoneLoadHandle.Reset();
+    }
+
+    bIsLoading.store(false);
+}
 
-    // Wait for registry to finish loading
-    AssetRegistry.SearchAllAssets(true);
+void UGSDEventSpawnRegistry::GatherZoneAssets(TArray<FAssetData>& OutAssets) const
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
 
-    // Find all UGSDEventSpawnZone assets
+    // Find UGSDEventSpawnZone assets under the configured search paths only
     FARFilter Filter;
     Filter.ClassPaths.Add(UGSDEventSpawnZone::StaticClass()->GetClassPathName());
     Filter.bRecursiveClasses = true;
+    Filter.bRecursivePaths = true;
     Filter.bIncludeOnlyOnDiskAssets = false;
 
-    // Add configured search paths
     for (const FName& Path : SpawnConfig.SpawnZoneSearchPaths)
     {
-        Filter.PackagePaths.Add(*Path.ToString());
+        Filter.PackagePaths.Add(Path);
     }
 
-    TArray<FAssetData> AssetDataList;
-    AssetRegistry.GetAssets(Filter, AssetDataList);
+    OutAssets.Reset();
+    AssetRegistry.GetAssets(Filter, OutAssets);
+}
 
-    GSDEVENT_LOG(Log, TEXT("Found %d spawn zone assets in registry"), AssetDataList.Num());
+void UGSDEventSpawnRegistry::BuildZoneIndex(const TArray<FAssetData>& Assets)
+{
+    TArray<FGSDEventSpawnZoneIndexEntry> NewIndex;
+    NewIndex.Reserve(Assets.Num());
 
-    // Load each zone synchronously
-    for (const FAssetData& AssetData : AssetDataList)
+    // Read AssetRegistrySearchable properties straight from the (cooked) registry tags
+    for (const FAssetData& AssetData : Assets)
     {
-        if (UGSDEventSpawnZone* Zone = Cast<UGSDEventSpawnZone>(AssetData.GetAsset()))
+        FGSDEventSpawnZoneIndexEntry& Entry = NewIndex.AddDefaulted_GetRef();
+        Entry.Path = AssetData.ToSoftObjectPath();
+
+        FString ZoneNameString;
+        Entry.ZoneName = AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UGSDEventSpawnZone, ZoneName), ZoneNameString)
+            ? FName(*ZoneNameString) : AssetData.AssetName;
+
+        AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UGSDEventSpawnZone, Priority), Entry.Priority);
+
+        FString TagsString;
+        if (AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UGSDEventSpawnZone, CompatibleEventTags), TagsString))
+        {
+            Entry.CompatibleEventTags.FromExportString(TagsString);
+        }
+    }
+
+    // Same order as SortZones: Priority (descending), then ZoneName (alphabetical)
+    NewIndex.Sort([](const FGSDEventSpawnZoneIndexEntry& A, const FGSDEventSpawnZoneIndexEntry& B)
+    {
+        if (A.Priority != B.Priority)
+        {
+            return A.Priority > B.Priority;
+        }
+        return A.ZoneName.ToString() < B.ZoneName.ToString();
+    });
+
+    FWriteScopeLock WriteLock(ZoneCacheLock);
+
+    ZoneIndex = MoveTemp(NewIndex);
+    ZoneIndexByTag.Reset();
+    WildcardZoneIndices.Reset();
+
+    for (int32 i = 0; i < ZoneIndex.Num(); ++i)
+    {
+        TArray<FGameplayTag> ZoneTags;
+        ZoneIndex[i].CompatibleEventTags.GetGameplayTagArray(ZoneTags);
+
+        if (ZoneTags.Num() == 0)
+        {
+            WildcardZoneIndices.Add(i);
+            continue;
+        }
+
+        for (const FGameplayTag& Tag : ZoneTags)
+        {
+            ZoneIndexByTag.FindOrAdd(Tag).Add(i);
+        }
+    }
+}
+
+void UGSDEventSpawnRegistry::FinishLoadingZones(const TArray<FSoftObjectPath>& Paths)
+{
+    TArray<UGSDEventSpawnZone*> LoadedZonesTmp;
+
+    for (const FSoftObjectPath& Path : Paths)
+    {
+        if (UGSDEventSpawnZone* Zone = Cast<UGSDEventSpawnZone>(Path.ResolveObject()))
         {
             FString ValidationError;
             if (Zone->ValidateConfig(ValidationError))
@@ -296,9 +474,13 @@ void UGSDEventSpawnRegistry::LoadZonesSync()
             else
             {
                 GSDEVENT_LOG(Warning, TEXT("Spawn zone '%s' failed validation: %s"),
-                    *AssetData.AssetName.ToString(), *ValidationError);
+                    *Path.ToString(), *ValidationError);
             }
         }
+        else
+        {
+            GSDEVENT_LOG(Warning, TEXT("Spawn zone '%s' failed to load"), *Path.ToString());
+        }
     }
 
     ProcessLoadedZones(LoadedZonesTmp);
@@ -348,10 +530,25 @@ void UGSDEventSpawnRegistry::RebuildZoneCache()
 
     // Clear old cache
     ZoneCache.Empty();
+    WildcardZoneCache = FGSDEventTagZoneCache();
 
-    // Build per-tag cache
+    // Collect every tag first so wildcard zones reach all tag caches wherever they sort
     TMap<FGameplayTag, TArray<UGSDEventSpawnZone*>> ZonesByTag;
+    for (const UGSDEventSpawnZone* Zone : LoadedZones)
+    {
+        if (Zone)
+        {
+            TArray<FGameplayTag> ZoneTags;
+            Zone->CompatibleEventTags.GetGameplayTagArray(ZoneTags);
+            for (const FGameplayTag& Tag : ZoneTags)
+            {
+                ZonesByTag.FindOrAdd(Tag);
+            }
+        }
+    }
 
+    // Build per-tag cache in LoadedZones order
+    TArray<UGSDEventSpawnZone*> WildcardZones;
     for (UGSDEventSpawnZone* Zone : LoadedZones)
     {
         if (!Zone)
@@ -365,7 +562,8 @@ void UGSDEventSpawnRegistry::RebuildZoneCache()
 
         if (ZoneTags.Num() == 0)
         {
-            // Zone supports all events - add to all existing tag caches
+            // Zone supports all events - add to every tag cache
+            WildcardZones.Add(Zone);
             for (auto& Pair : ZonesByTag)
             {
                 Pair.Value.Add(Zone);
@@ -376,11 +574,16 @@ void UGSDEventSpawnRegistry::RebuildZoneCache()
             // Zone supports specific tags
             for (const FGameplayTag& Tag : ZoneTags)
             {
-                ZonesByTag.FindOrAdd(Tag).Add(Zone);
+                ZonesByTag[Tag].Add(Zone);
             }
         }
     }
 
+    // Tags with no zones of their own fall back to the wildcard zones
+    WildcardZoneCache.Zones = WildcardZones;
+    WildcardZoneCache.TotalWeight = CalculateTotalWeight(WildcardZones);
+    WildcardZoneCache.bIsValid = true;
+
     // Build final cache structures
     for (auto& Pair : ZonesByTag)
     {
@@ -448,21 +651,15 @@ FVector UGSDEventSpawnRegistry::ProjectToNavMeshWithRetry(UWorld* World, const F
     }
 
     FNavLocation ProjectedLocation;
-    const FVector Extent(QueryExtent);
 
-    // Try projection with retry logic
+    // Retry with a wider extent; the NavMesh won't change between immediate retries
     for (int32 Retry = 0; Retry < SpawnConfig.MaxNavMeshRetries; ++Retry)
     {
+        const FVector Extent(QueryExtent * static_cast<float>(1 << Retry));
         if (NavSys->ProjectPointToNavigation(Point, ProjectedLocation, Extent))
         {
             return ProjectedLocation.Location;
         }
-
-        // Wait before retry
-        if (Retry < SpawnConfig.MaxNavMeshRetries - 1)
-        {
-            FPlatformProcess::Sleep(SpawnConfig.NavMeshRetryDelayMs / 1000.0f);
-        }
     }
 
     GSDEVENT_LOG(Warning, TEXT("Failed to project point %s to NavMesh after %d retries"),
@@ -470,6 +667,162 @@ FVector UGSDEventSpawnRegistry::ProjectToNavMeshWithRetry(UWorld* World, const F
     return Point;
 }
 
+void UGSDEventSpawnRegistry::ProjectPointsToNavMeshBatched(UWorld* World, const TArray<FVector>& Points, float QueryExtent, FOnNavProjectionBatchComplete OnComplete) const
+{
+    check(IsInGameThread());
+
+    UNavigationSystemV1* NavSys = World ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(World) : nullptr;
+    const ANavigationData* NavData = NavSys ? NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate) : nullptr;
+
+    if (!NavData || Points.Num() == 0)
+    {
+        if (Points.Num() > 0)
+        {
+            GSDEVENT_LOG(Warning, TEXT("NavMesh required but no navigation data found; using %d unprojected points"), Points.Num());
+        }
+
+        TArray<FGSDNavProjectionResult> Results;
+        Results.SetNum(Points.Num());
+        for (int32 i = 0; i < Points.Num(); ++i)
+        {
+            Results[i].Location = Points[i];
+        }
+        OnComplete.ExecuteIfBound(Results);
+        return;
+    }
+
+    // NavMesh queries stay on the game thread; retry passes re-resolve the nav data in case it was unloaded
+    TWeakObjectPtr<const ANavigationData> WeakNavData(NavData);
+    FSharedConstNavQueryFilter Filter = NavData->GetDefaultQueryFilter();
+
+    ProjectPointsWithRetries(World, Points, QueryExtent,
+        [WeakNavData, Filter](TArray<FNavigationProjectionWork>& Workload, const FVector& Extent)
+        {
+            const ANavigationData* CurrentNavData = WeakNavData.Get();
+            if (!CurrentNavData)
+            {
+                return false;
+            }
+
+            CurrentNavData->BatchProjectPoints(Workload, Extent, Filter);
+            return true;
+        },
+        MoveTemp(OnComplete));
+}
+
+namespace
+{
+    /** In-flight state for one ProjectPointsWithRetries batch (shared with its retry timers) */
+    struct FGSDNavProjectionBatch
+    {
+        TWeakObjectPtr<UWorld> World;
+        TFunction<bool(TArray<FNavigationProjectionWork>&, const FVector&)> Project;
+        FOnNavProjectionBatchComplete OnComplete;
+
+        TArray<FVector> Points;
+        TArray<FGSDNavProjectionResult> Results;
+
+        // Indices of points not yet on the NavMesh
+        TArray<int32> PendingIndices;
+
+        float QueryExtent = 0.0f;
+        float RetryDelaySeconds = 0.0f;
+        int32 Pass = 0;
+        int32 MaxPasses = 1;
+    };
+
+    void RunNavProjectionPasses(const TSharedRef<FGSDNavProjectionBatch>& Batch)
+    {
+        TArray<FNavigationProjectionWork> Workload;
+
+        for (;;)
+        {
+            Workload.Reset(Batch->PendingIndices.Num());
+            for (const int32 Index : Batch->PendingIndices)
+            {
+                Workload.Emplace(Batch->Points[Index]);
+            }
+
+            // One batched query per pass; the extent doubles on each retry
+            if (!Batch->Project(Workload, FVector(Batch->QueryExtent * static_cast<float>(1 << Batch->Pass))))
+            {
+                GSDEVENT_LOG(Verbose, TEXT("NavMesh went away during projection; dropping %d points"), Batch->Points.Num());
+                return;
+            }
+
+            // Keep only misses for the next, wider pass
+            int32 NumPending = 0;
+            for (int32 WorkIndex = 0; WorkIndex < Workload.Num(); ++WorkIndex)
+            {
+                const int32 Index = Batch->PendingIndices[WorkIndex];
+                if (Workload[WorkIndex].bResult)
+                {
+                    Batch->Results[Index].Location = Workload[WorkIndex].OutLocation.Location;
+                    Batch->Results[Index].bOnNavMesh = true;
+                }
+                else
+                {
+                    Batch->PendingIndices[NumPending++] = Index;
+                }
+            }
+            Batch->PendingIndices.SetNum(NumPending);
+            ++Batch->Pass;
+
+            if (NumPending == 0 || Batch->Pass >= Batch->MaxPasses)
+            {
+                break;
+            }
+
+            if (Batch->RetryDelaySeconds > 0.0f)
+            {
+                UWorld* World = Batch->World.Get();
+                if (!World)
+                {
+                    return;
+                }
+
+                FTimerHandle RetryHandle;
+                World->GetTimerManager().SetTimer(RetryHandle, FTimerDelegate::CreateLambda([Batch]()
+                {
+                    RunNavProjectionPasses(Batch);
+                }), Batch->RetryDelaySeconds, false);
+                return;
+            }
+        }
+
+        if (Batch->PendingIndices.Num() > 0)
+        {
+            GSDEVENT_LOG(Warning, TEXT("Failed to project %d of %d points to NavMesh"), Batch->PendingIndices.Num(), Batch->Points.Num());
+        }
+
+        Batch->OnComplete.ExecuteIfBound(Batch->Results);
+    }
+}
+
+void UGSDEventSpawnRegistry::ProjectPointsWithRetries(UWorld* World, const TArray<FVector>& Points, float QueryExtent, FNavProjectionFunction Project, FOnNavProjectionBatchComplete OnComplete) const
+{
+    check(IsInGameThread());
+
+    TSharedRef<FGSDNavProjectionBatch> Batch = MakeShared<FGSDNavProjectionBatch>();
+    Batch->World = World;
+    Batch->Project = MoveTemp(Project);
+    Batch->OnComplete = MoveTemp(OnComplete);
+    Batch->Points = Points;
+    Batch->QueryExtent = QueryExtent;
+    Batch->RetryDelaySeconds = SpawnConfig.NavMeshRetryDelayMs * 0.001f;
+    Batch->MaxPasses = FMath::Max(1, SpawnConfig.MaxNavMeshRetries);
+
+    Batch->Results.SetNum(Points.Num());
+    Batch->PendingIndices.Reserve(Points.Num());
+    for (int32 i = 0; i < Points.Num(); ++i)
+    {
+        Batch->Results[i].Location = Points[i];
+        Batch->PendingIndices.Add(i);
+    }
+
+    RunNavProjectionPasses(Batch);
+}
+
 void FGSDEventSpawnZoneRegistrySearch::Search(const TArray<FName>& SearchPaths)
 {
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "DataAssets/GSDDailyEventConfig.h"
+#include "Subsystems/GSDEventSpawnRegistry.h"
 #include "GSDEventBlockPartyConfig.generated.h"
 
 class UGSDSafeZoneModifier;
@@ -39,6 +40,13 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Props")
     float PropSpawnRadius = 1000.0f;
 
+    /** Project props and FX onto the NavMesh (one batched async query per event start) */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Props")
+    bool bProjectPropsToNavMesh = true;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Props", meta = (EditCondition = "bProjectPropsToNavMesh"))
+    float PropNavMeshQueryExtent = 500.0f;
+
     //-- Decorative FX --
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX")
     TArray<TSubclassOf<AActor>> DecorativeFXClasses;
@@ -60,6 +68,21 @@ protected:
     /** Event center for cleanup */
     FVector EventCenter;
 
-    /** Helper: Spawn props in random positions around center */
-    void SpawnCrowdProps(UWorld* World, const FVector& Center, int32 Count);
+    /** Bumped on event end so in-flight NavMesh projections are discarded */
+    int32 SpawnRequestSerial = 0;
+
+    /** Actor waiting on NavMesh projection */
+    struct FPendingActorSpawn
+    {
+        TSubclassOf<AActor> ActorClass;
+        FVector Location;
+        FRotator Rotation;
+        bool bIsFX = false;
+    };
+
+    /** Helper: Spawn props and FX in random positions around center */
+    void SpawnCrowdProps(UWorld* World, const FVector& Center, int32 Count, int32 NumFX);
+
+    /** Spawn pending actors (at projected locations when provided) */
+    void SpawnPendingActors(UWorld* World, const TArray<FPendingActorSpawn>& PendingSpawns, const TArray<FGSDNavProjectionResult>* ProjectedLocations);
 };
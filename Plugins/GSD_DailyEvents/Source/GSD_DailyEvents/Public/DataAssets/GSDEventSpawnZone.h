@@ -27,7 +27,8 @@ class GSD_DAILYEVENTS_API UGSDEventSpawnZone : public UGSDDataAsset
 
 public:
     //-- Zone Identity --
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Zone")
+    // AssetRegistrySearchable: the registry indexes zones by name/tags/priority without loading them
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, AssetRegistrySearchable, Category = "Zone")
     FName ZoneName;
 
     //-- Spatial Bounds --
@@ -38,11 +39,11 @@ public:
     FVector ZoneExtent = FVector(5000.0f, 5000.0f, 500.0f);
 
     //-- Event Filtering --
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Filtering")
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, AssetRegistrySearchable, Category = "Filtering")
     FGameplayTagContainer CompatibleEventTags;
 
     //-- Priority --
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Priority", meta = (ClampMin = "0"))
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, AssetRegistrySearchable, Category = "Priority", meta = (ClampMin = "0"))
     int32 Priority = 0;
 
     //-- Navigation Requirements --
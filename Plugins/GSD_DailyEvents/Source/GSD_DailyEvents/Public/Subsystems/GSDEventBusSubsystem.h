@@ -56,6 +56,14 @@ struct GSD_DAILYEVENTS_API FGSDEventHandle
  * - Subscribing to "Event.Daily" receives ALL Event.Daily.* broadcasts
  * - Subscribing to "Event.Daily.Construction" receives ONLY that specific event
  *
+ * Matching subscriber tags are resolved once per broadcast tag and cached in a
+ * dispatch table, so a broadcast costs O(matching subscribers). The table is
+ * invalidated whenever a subscribed tag is added or removed.
+ *
+ * Subscribers may Subscribe or Unsubscribe from inside a callback. Each tag's
+ * delegate is shared-owned, so a broadcast in progress keeps it alive even if
+ * its last handle is removed or the map reallocates.
+ *
  * Usage:
  * 1. Subscribe to events using Subscribe()
  * 2. Store the returned FGSDEventHandle for later unsubscription
@@ -133,8 +141,17 @@ protected:
 
     //-- State --
 
-    /** Map of event tags to their delegate broadcasts */
-    TMap<FGameplayTag, FOnGSDEvent> EventDelegates;
+    /** Map of event tags to their delegate broadcasts (shared so broadcasts survive map changes) */
+    TMap<FGameplayTag, TSharedRef<FOnGSDEvent>> EventDelegates;
+
+    /**
+     * Dispatch table: broadcast tag -> subscribed tags it matches (exact match first, then parents).
+     * Built lazily per broadcast tag; cleared when the set of subscribed tags changes.
+     */
+    TMap<FGameplayTag, TArray<FGameplayTag>> DispatchTable;
+
+    /** Resolve (and cache) the subscribed tags an event tag dispatches to */
+    const TArray<FGameplayTag>& GetDispatchTags(const FGameplayTag& EventTag);
 
     /** Currently active events (for queries) */
     UPROPERTY()
@@ -6,8 +6,12 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "GameplayTagContainer.h"
 #include "HAL/CriticalSection.h"
+#include "Engine/StreamableManager.h"
 #include "GSDEventSpawnRegistry.generated.h"
 
+struct FAssetData;
+struct FNavigationProjectionWork;
+
 class UGSDEventSpawnZone;
 class UGSDDailyEventConfig;
 
@@ -31,6 +35,7 @@ struct GSD_DAILYEVENTS_API FGSDEventSpawnConfig
     UPROPERTY(EditDefaultsOnly, Config, Category = "Navigation")
     int32 MaxNavMeshRetries = 3;
 
+    // Delay before batched projections retry their misses (lets nearby NavMesh tiles finish building)
     UPROPERTY(EditDefaultsOnly, Config, Category = "Navigation")
     float NavMeshRetryDelayMs = 10.0f;
 
@@ -69,6 +74,32 @@ struct FGSDEventTagZoneCache
     bool bIsValid = false;
 };
 
+/**
+ * Unloaded zone entry built from asset registry tags (no asset load required).
+ */
+struct FGSDEventSpawnZoneIndexEntry
+{
+    FSoftObjectPath Path;
+    FName ZoneName;
+    int32 Priority = 0;
+    FGameplayTagContainer CompatibleEventTags;
+};
+
+/**
+ * Result of projecting one candidate point onto the NavMesh.
+ */
+struct FGSDNavProjectionResult
+{
+    /** Projected location (or the input point if projection failed) */
+    FVector Location = FVector::ZeroVector;
+
+    /** True if the point was found on the NavMesh */
+    bool bOnNavMesh = false;
+};
+
+/** Delivered on the game thread with one result per input point (same order) */
+DECLARE_DELEGATE_OneParam(FOnNavProjectionBatchComplete, const TArray<FGSDNavProjectionResult>&);
+
 /**
  * Registry for event spawn zones.
  * Loads spawn zones from asset registry and provides deterministic zone selection.
@@ -78,6 +109,12 @@ struct FGSDEventTagZoneCache
  * 2. Registry auto-loads zones on initialization (async by default)
  * 3. GetSpawnLocationForEvent() returns deterministic location
  *
+ * Loading:
+ * - Never forces a full asset registry scan; async loading waits for the
+ *   registry's files-loaded callback and only queries SpawnZoneSearchPaths
+ * - A tag -> soft path index is built from cooked asset registry tags before
+ *   any zone is loaded, then zones are streamed in the background
+ *
  * Determinism:
  * - Zones sorted by Priority (descending), then ZoneName (alphabetical)
  * - Same seed always selects same zone for same event
@@ -116,11 +153,21 @@ public:
 
     /**
      * Get spawn zones compatible with a specific event tag.
-     * Uses cached zones for O(1) lookup.
+     * An empty tag matches every zone; a tag that no zone lists matches the
+     * wildcard (untagged) zones only, before and after loading completes.
+     * Uses cached zones for O(1) lookup. Before the background load completes,
+     * returns the compatible zones from the path index that are already resident.
      * Thread-safe for reads.
      */
     void GetCompatibleZones(const FGameplayTag& EventTag, TArray<UGSDEventSpawnZone*>& OutZones) const;
 
+    /**
+     * Get soft paths of zones compatible with a specific event tag.
+     * Answered from the asset registry index; does not load any zone.
+     * Thread-safe for reads.
+     */
+    void GetCompatibleZonePaths(const FGameplayTag& EventTag, TArray<FSoftObjectPath>& OutPaths) const;
+
     /**
      * Get a deterministic spawn location for an event.
      * Uses the RNG stream to select zone and point within zone.
@@ -134,6 +181,24 @@ public:
      */
     FVector GetSpawnLocationForEvent(const FGameplayTag& EventTag, FRandomStream& Stream, UWorld* World = nullptr) const;
 
+    /**
+     * Project a batch of candidate points onto the NavMesh.
+     * Each pass resolves all pending points with one batched query on the game thread
+     * (NavMesh tiles are not safe to read off it while they stream or rebuild).
+     * The first pass runs before this returns; points that miss are retried
+     * NavMeshRetryDelayMs later with a doubled extent, up to MaxNavMeshRetries passes.
+     * OnComplete runs on the game thread, synchronously if every point lands on the
+     * first pass (or there is no NavMesh or no points), so callers must not assume deferral.
+     * The batch is dropped if the NavMesh or world goes away between passes.
+     * Must be called from game thread.
+     *
+     * @param World World whose default NavMesh is queried
+     * @param Points Candidate points
+     * @param QueryExtent Initial projection extent
+     * @param OnComplete Receives one result per input point, in input order
+     */
+    void ProjectPointsToNavMeshBatched(UWorld* World, const TArray<FVector>& Points, float QueryExtent, FOnNavProjectionBatchComplete OnComplete) const;
+
     //-- Registry Management --
 
     /**
@@ -156,6 +221,12 @@ public:
     UFUNCTION(BlueprintPure, Category = "GSD|Events")
     int32 GetZoneCount() const;
 
+    /**
+     * Get number of zones known to the asset registry index (loaded or not).
+     */
+    UFUNCTION(BlueprintPure, Category = "GSD|Events")
+    int32 GetIndexedZoneCount() const;
+
     //-- Events --
 
     /** Broadcast when zones finish loading */
@@ -216,21 +287,64 @@ private:
     TArray<TObjectPtr<UGSDEventSpawnZone>> CachedAllZones;
     float CachedTotalWeight = 0.0f;
 
+    //-- Cache for tags no zone lists (untagged zones only) --
+    UPROPERTY()
+    FGSDEventTagZoneCache WildcardZoneCache;
+
+    //-- Zone Path Index (from asset registry tags, sorted like LoadedZones) --
+    TArray<FGSDEventSpawnZoneIndexEntry> ZoneIndex;
+
+    // Tag -> indices into ZoneIndex (zones with specific tags only)
+    TMap<FGameplayTag, TArray<int32>> ZoneIndexByTag;
+
+    // Indices into ZoneIndex of zones with no tags (compatible with any event)
+    TArray<int32> WildcardZoneIndices;
+
     //-- Loading State --
     std::atomic<bool> bZonesLoaded{false};
     std::atomic<bool> bIsLoading{false};
 
+    TSharedPtr<FStreamableHandle> ZoneLoadHandle;
+    FDelegateHandle FilesLoadedHandle;
+
     //-- Thread Safety --
     mutable FRWLock ZoneCacheLock;
 
+#if WITH_DEV_AUTOMATION_TESTS
+    //-- Test Support --
+    // Automation tests drive indexing and cancellation without a game instance or cooked zones
+    friend struct FGSDEventSpawnRegistryTestAccess;
+#endif
+
     //-- Helpers --
 
-    /** Async load zones from asset registry */
+    /** Async load zones from asset registry (waits for registry files-loaded) */
     void LoadZonesAsync();
 
-    /** Synchronous load zones (fallback) */
+    /** Synchronous load zones (fallback; scans only SpawnZoneSearchPaths) */
     void LoadZonesSync();
 
+    /** Asset registry files-loaded callback: index and stream zones */
+    void OnAssetRegistryFilesLoaded();
+
+    /** Cancel a pending registry wait or streaming request */
+    void CancelPendingLoad();
+
+    /** Query zone assets under SpawnZoneSearchPaths (no full scan) */
+    void GatherZoneAssets(TArray<FAssetData>& OutAssets) const;
+
+    /** Build ZoneIndex / ZoneIndexByTag from asset registry tags */
+    void BuildZoneIndex(const TArray<FAssetData>& Assets);
+
+    /** Validate resolved zones and hand them to ProcessLoadedZones */
+    void FinishLoadingZones(const TArray<FSoftObjectPath>& Paths);
+
+    /** Collect zones compatible with a tag and their total weight (must hold ZoneCacheLock) */
+    void GatherCompatibleZones(const FGameplayTag& EventTag, TArray<UGSDEventSpawnZone*>& OutZones, float& OutTotalWeight) const;
+
+    /** Collect ZoneIndex indices compatible with a tag (must hold ZoneCacheLock) */
+    void GatherCompatibleIndices(const FGameplayTag& EventTag, TArray<int32>& OutIndices) const;
+
     /** Process loaded zone data */
     void ProcessLoadedZones(const TArray<UGSDEventSpawnZone*>& Zones);
 
@@ -251,6 +365,12 @@ private:
 
     /** Project point to NavMesh with retry logic */
     FVector ProjectToNavMeshWithRetry(UWorld* World, const FVector& Point, float QueryExtent) const;
+
+    /** Projects a workload in place at an extent; returns false if the navigation data is gone */
+    using FNavProjectionFunction = TFunction<bool(TArray<FNavigationProjectionWork>& /*Workload*/, const FVector& /*Extent*/)>;
+
+    /** Run ProjectPointsToNavMeshBatched's retry passes through a projection function */
+    void ProjectPointsWithRetries(UWorld* World, const TArray<FVector>& Points, float QueryExtent, FNavProjectionFunction Project, FOnNavProjectionBatchComplete OnComplete) const;
 };
 
 /**
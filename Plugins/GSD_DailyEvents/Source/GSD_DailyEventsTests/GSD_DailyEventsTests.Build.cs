@@ -17,6 +17,8 @@ public class GSD_DailyEventsTests : ModuleRules
 
         PrivateDependencyModuleNames.AddRange(new string[] {
             "GSD_DailyEvents",
+            "GameplayTags",
+            "AssetRegistry",
             "AutomationController"
         });
     }
@@ -0,0 +1,133 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#include "Subsystems/GSDEventBusSubsystem.h"
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test suite for UGSDEventBusSubsystem re-entrancy
+ * Subscribers that unsubscribe or subscribe from inside a broadcast must not
+ * invalidate the delegate being broadcast
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDEventBusReentrancyTest, "GSD.DailyEvents.EventBus.ReentrantSubscription", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDEventBusReentrancyTest::RunTest(const FString& Parameters)
+{
+    const FGameplayTag DailyTag = FGameplayTag::RequestGameplayTag(FName("Event.Daily"), false);
+    const FGameplayTag BonfireTag = FGameplayTag::RequestGameplayTag(FName("Event.Daily.Bonfire"), false);
+    const FGameplayTag ConstructionTag = FGameplayTag::RequestGameplayTag(FName("Event.Daily.Construction"), false);
+    const FGameplayTag BlockPartyTag = FGameplayTag::RequestGameplayTag(FName("Event.Daily.BlockParty"), false);
+    const FGameplayTag ZombieRaveTag = FGameplayTag::RequestGameplayTag(FName("Event.Daily.ZombieRave"), false);
+    if (!DailyTag.IsValid() || !BonfireTag.IsValid() || !ConstructionTag.IsValid() || !BlockPartyTag.IsValid() || !ZombieRaveTag.IsValid())
+    {
+        AddError(TEXT("Event.Daily tags not registered (GSD_DailyEvents DefaultGameplayTags.ini)"));
+        return false;
+    }
+
+    UWorld* TestWorld = NewObject<UWorld>();
+    TestWorld->SetWorldType(EWorldType::Game);
+
+    UGSDEventBusSubsystem* EventBus = NewObject<UGSDEventBusSubsystem>(TestWorld);
+    EventBus->AddToRoot();
+
+    // Test 1: Unsubscribing a tag's last handle from inside its own callback
+    {
+        int32 SelfRemovingCalls = 0;
+        int32 ParentCalls = 0;
+        FGSDEventHandle SelfRemovingHandle;
+        SelfRemovingHandle = EventBus->Subscribe(BonfireTag, FOnGSDEvent::FDelegate::CreateLambda(
+            [EventBus, &SelfRemovingHandle, &SelfRemovingCalls](FGameplayTag, const FVector&, float)
+            {
+                SelfRemovingCalls++;
+                EventBus->Unsubscribe(SelfRemovingHandle);
+            }));
+        FGSDEventHandle ParentHandle = EventBus->Subscribe(DailyTag, FOnGSDEvent::FDelegate::CreateLambda(
+            [&ParentCalls](FGameplayTag, const FVector&, float)
+            {
+                ParentCalls++;
+            }));
+
+        EventBus->BroadcastEvent(BonfireTag, FVector::ZeroVector);
+        TestEqual(TEXT("Self-removing subscriber called once"), SelfRemovingCalls, 1);
+        TestEqual(TEXT("Parent subscriber still called after mid-broadcast removal"), ParentCalls, 1);
+        TestFalse(TEXT("Handle reset by Unsubscribe"), SelfRemovingHandle.IsValid());
+
+        EventBus->BroadcastEvent(BonfireTag, FVector::ZeroVector);
+        TestEqual(TEXT("Removed subscriber not called again"), SelfRemovingCalls, 1);
+        TestEqual(TEXT("Parent subscriber called on second broadcast"), ParentCalls, 2);
+
+        EventBus->Unsubscribe(ParentHandle);
+    }
+
+    // Test 2: Unsubscribing a later dispatch target mid-broadcast skips it
+    {
+        int32 LaterCalls = 0;
+        FGSDEventHandle LaterHandle = EventBus->Subscribe(DailyTag, FOnGSDEvent::FDelegate::CreateLambda(
+            [&LaterCalls](FGameplayTag, const FVector&, float)
+            {
+                LaterCalls++;
+            }));
+        FGSDEventHandle RemoverHandle = EventBus->Subscribe(BonfireTag, FOnGSDEvent::FDelegate::CreateLambda(
+            [EventBus, &LaterHandle](FGameplayTag, const FVector&, float)
+            {
+                EventBus->Unsubscribe(LaterHandle);
+            }));
+
+        // Exact match (Bonfire) dispatches before the parent (Event.Daily)
+        EventBus->BroadcastEvent(BonfireTag, FVector::ZeroVector);
+        TestEqual(TEXT("Subscriber removed earlier in the broadcast is skipped"), LaterCalls, 0);
+
+        EventBus->Unsubscribe(RemoverHandle);
+    }
+
+    // Test 3: Subscribing new tags from inside a callback (map grows mid-broadcast)
+    {
+        int32 BroadcasterCalls = 0;
+        int32 NewSubscriberCalls = 0;
+        TArray<FGSDEventHandle> NewHandles;
+        FGSDEventHandle SubscriberHandle = EventBus->Subscribe(BonfireTag, FOnGSDEvent::FDelegate::CreateLambda(
+            [&](FGameplayTag, const FVector&, float)
+            {
+                BroadcasterCalls++;
+                if (NewHandles.Num() > 0)
+                {
+                    return;
+                }
+
+                for (const FGameplayTag& NewTag : { ConstructionTag, BlockPartyTag, ZombieRaveTag, DailyTag })
+                {
+                    NewHandles.Add(EventBus->Subscribe(NewTag, FOnGSDEvent::FDelegate::CreateLambda(
+                        [&NewSubscriberCalls](FGameplayTag, const FVector&, float)
+                        {
+                            NewSubscriberCalls++;
+                        })));
+                }
+            }));
+
+        EventBus->BroadcastEvent(BonfireTag, FVector::ZeroVector);
+        TestEqual(TEXT("Subscribing callback ran once"), BroadcasterCalls, 1);
+        TestEqual(TEXT("All new subscriptions valid"), NewHandles.Num(), 4);
+        TestEqual(TEXT("Tags subscribed mid-broadcast join from the next broadcast"), NewSubscriberCalls, 0);
+
+        EventBus->BroadcastEvent(BonfireTag, FVector::ZeroVector);
+        TestEqual(TEXT("Original subscriber survives map growth"), BroadcasterCalls, 2);
+        TestEqual(TEXT("Parent subscribed mid-broadcast receives the next broadcast"), NewSubscriberCalls, 1);
+
+        EventBus->BroadcastEvent(ConstructionTag, FVector::ZeroVector);
+        TestEqual(TEXT("Exact and parent subscriptions from the callback both receive"), NewSubscriberCalls, 3);
+
+        EventBus->Unsubscribe(SubscriberHandle);
+        for (FGSDEventHandle& Handle : NewHandles)
+        {
+            EventBus->Unsubscribe(Handle);
+        }
+    }
+
+    EventBus->RemoveFromRoot();
+    return true;
+}
+
+#endif
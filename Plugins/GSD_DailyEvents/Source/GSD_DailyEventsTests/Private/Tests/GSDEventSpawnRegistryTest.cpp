@@ -245,3 +245,365 @@ namespace GSD_DailyEventsTests
     }
 
 #endif
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "TimerManager.h"
+#include "Engine/World.h"
+
+/**
+ * Automation test access to UGSDEventSpawnRegistry internals.
+ * Feeds asset registry data straight into the index and exercises load cancellation.
+ */
+struct FGSDEventSpawnRegistryTestAccess
+{
+    explicit FGSDEventSpawnRegistryTestAccess(UGSDEventSpawnRegistry& InRegistry)
+        : Registry(InRegistry)
+    {
+    }
+
+    void BuildZoneIndex(const TArray<FAssetData>& Assets) { Registry.BuildZoneIndex(Assets); }
+
+    /** Hand resolved zones to the cache and mark loading complete, as FinishLoadingZones does. */
+    void FinishLoading(const TArray<UGSDEventSpawnZone*>& Zones)
+    {
+        Registry.ProcessLoadedZones(Zones);
+        Registry.bZonesLoaded.store(true);
+    }
+    void CancelPendingLoad() { Registry.CancelPendingLoad(); }
+
+    /** Replace the config without the zone refresh SetSpawnConfig triggers. */
+    void SetSpawnConfig(const FGSDEventSpawnConfig& Config) { Registry.SpawnConfig = Config; }
+
+    /** Run batched NavMesh projection through a stand-in for the navigation data. */
+    void ProjectPointsWithRetries(UWorld* World, const TArray<FVector>& Points, float QueryExtent,
+        UGSDEventSpawnRegistry::FNavProjectionFunction Project, FOnNavProjectionBatchComplete OnComplete)
+    {
+        Registry.ProjectPointsWithRetries(World, Points, QueryExtent, MoveTemp(Project), MoveTemp(OnComplete));
+    }
+
+    /** Start waiting on the asset registry's files-loaded callback, as LoadZonesAsync does during discovery. */
+    void BeginWaitForRegistryFiles()
+    {
+        IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        Registry.bIsLoading.store(true);
+        Registry.FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddUObject(&Registry, &UGSDEventSpawnRegistry::OnAssetRegistryFilesLoaded);
+    }
+
+    bool IsWaitingForRegistryFiles() const { return Registry.FilesLoadedHandle.IsValid(); }
+    bool IsLoading() const { return Registry.bIsLoading.load(); }
+
+    /** Cooked-style asset data for a zone: only registry-searchable tags, no loaded object. */
+    static FAssetData MakeZoneAssetData(const TCHAR* AssetName, const TCHAR* ZoneName, int32 Priority, const FGameplayTagContainer& Tags)
+    {
+        FAssetDataTagMap TagMap;
+        if (ZoneName)
+        {
+            TagMap.Add(GET_MEMBER_NAME_CHECKED(UGSDEventSpawnZone, ZoneName), ZoneName);
+        }
+        TagMap.Add(GET_MEMBER_NAME_CHECKED(UGSDEventSpawnZone, Priority), LexToString(Priority));
+        if (!Tags.IsEmpty())
+        {
+            TagMap.Add(GET_MEMBER_NAME_CHECKED(UGSDEventSpawnZone, CompatibleEventTags), Tags.ToString());
+        }
+
+        const FString PackageName = FString::Printf(TEXT("/Game/DailyEvents/SpawnZones/%s"), AssetName);
+        return FAssetData(FName(*PackageName), FName(TEXT("/Game/DailyEvents/SpawnZones")), FName(AssetName),
+            UGSDEventSpawnZone::StaticClass()->GetClassPathName(), MoveTemp(TagMap));
+    }
+
+private:
+    UGSDEventSpawnRegistry& Registry;
+};
+
+/**
+ * Test suite for the asset registry zone index
+ * Zones are indexed by tag from registry data alone, in deterministic order, without loading
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDEventSpawnRegistryZoneIndexTest, "GSD.DailyEvents.SpawnRegistry.ZoneIndex", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDEventSpawnRegistryZoneIndexTest::RunTest(const FString& Parameters)
+{
+    const FGameplayTag BonfireTag = FGameplayTag::RequestGameplayTag(FName("Event.Daily.Bonfire"), false);
+    const FGameplayTag ConstructionTag = FGameplayTag::RequestGameplayTag(FName("Event.Daily.Construction"), false);
+    const FGameplayTag ZombieRaveTag = FGameplayTag::RequestGameplayTag(FName("Event.Daily.ZombieRave"), false);
+    if (!BonfireTag.IsValid() || !ConstructionTag.IsValid() || !ZombieRaveTag.IsValid())
+    {
+        AddError(TEXT("Event.Daily tags not registered (GSD_DailyEvents DefaultGameplayTags.ini)"));
+        return false;
+    }
+
+    UGSDEventSpawnRegistry* Registry = NewObject<UGSDEventSpawnRegistry>();
+    Registry->AddToRoot();
+    FGSDEventSpawnRegistryTestAccess Access(*Registry);
+
+    FGameplayTagContainer BonfireOnly(BonfireTag);
+    FGameplayTagContainer BonfireAndConstruction(BonfireTag);
+    BonfireAndConstruction.AddTag(ConstructionTag);
+
+    // Deliberately unsorted input; ZoneB has no ZoneName tag and falls back to its asset name
+    TArray<FAssetData> Assets;
+    Assets.Add(FGSDEventSpawnRegistryTestAccess::MakeZoneAssetData(TEXT("DA_ZoneC"), TEXT("Park"), 1, BonfireOnly));
+    Assets.Add(FGSDEventSpawnRegistryTestAccess::MakeZoneAssetData(TEXT("DA_ZoneA"), TEXT("Alley"), 5, FGameplayTagContainer()));
+    Assets.Add(FGSDEventSpawnRegistryTestAccess::MakeZoneAssetData(TEXT("DA_ZoneB"), nullptr, 5, BonfireAndConstruction));
+    Assets.Add(FGSDEventSpawnRegistryTestAccess::MakeZoneAssetData(TEXT("DA_ZoneD"), TEXT("Beach"), 1, FGameplayTagContainer()));
+
+    Access.BuildZoneIndex(Assets);
+    TestEqual(TEXT("Every asset indexed"), Registry->GetIndexedZoneCount(), 4);
+    TestEqual(TEXT("Indexing loads nothing"), Registry->GetZoneCount(), 0);
+
+    auto PathOf = [&Assets](int32 AssetIndex) { return Assets[AssetIndex].ToSoftObjectPath(); };
+
+    // Order: Priority descending, then ZoneName -> Alley(A,5), DA_ZoneB(B,5), Beach(D,1), Park(C,1)
+    TArray<FSoftObjectPath> Paths;
+    Registry->GetCompatibleZonePaths(FGameplayTag(), Paths);
+    TestEqual(TEXT("Empty tag returns every zone in deterministic order"), Paths,
+        TArray<FSoftObjectPath>({ PathOf(1), PathOf(2), PathOf(3), PathOf(0) }));
+
+    Registry->GetCompatibleZonePaths(BonfireTag, Paths);
+    TestEqual(TEXT("Tagged zones plus wildcard zones, in deterministic order"), Paths,
+        TArray<FSoftObjectPath>({ PathOf(1), PathOf(2), PathOf(3), PathOf(0) }));
+
+    Registry->GetCompatibleZonePaths(ConstructionTag, Paths);
+    TestEqual(TEXT("Multi-tag zone indexed under each of its tags"), Paths,
+        TArray<FSoftObjectPath>({ PathOf(1), PathOf(2), PathOf(3) }));
+
+    Registry->GetCompatibleZonePaths(ZombieRaveTag, Paths);
+    TestEqual(TEXT("Tag with no zones falls back to wildcard zones only"), Paths,
+        TArray<FSoftObjectPath>({ PathOf(1), PathOf(3) }));
+
+    // Loaded zones answer with the same rule as the index, whatever order the wildcards sort in
+    {
+        auto MakeZone = [](const TCHAR* ZoneName, int32 Priority, const FGameplayTagContainer& Tags)
+        {
+            UGSDEventSpawnZone* Zone = NewObject<UGSDEventSpawnZone>();
+            Zone->ZoneName = FName(ZoneName);
+            Zone->Priority = Priority;
+            Zone->CompatibleEventTags = Tags;
+            return Zone;
+        };
+
+        UGSDEventSpawnRegistry* LoadedRegistry = NewObject<UGSDEventSpawnRegistry>();
+        LoadedRegistry->AddToRoot();
+        FGSDEventSpawnRegistryTestAccess LoadedAccess(*LoadedRegistry);
+
+        // Alley and Beach are wildcards; Alley sorts ahead of every tagged zone
+        UGSDEventSpawnZone* Alley = MakeZone(TEXT("Alley"), 5, FGameplayTagContainer());
+        UGSDEventSpawnZone* Docks = MakeZone(TEXT("Docks"), 5, BonfireAndConstruction);
+        UGSDEventSpawnZone* Beach = MakeZone(TEXT("Beach"), 1, FGameplayTagContainer());
+        UGSDEventSpawnZone* Park = MakeZone(TEXT("Park"), 1, BonfireOnly);
+        LoadedAccess.FinishLoading(TArray<UGSDEventSpawnZone*>({ Park, Beach, Docks, Alley }));
+
+        TArray<UGSDEventSpawnZone*> Zones;
+        LoadedRegistry->GetCompatibleZones(FGameplayTag(), Zones);
+        TestEqual(TEXT("Loaded: empty tag returns every zone"), Zones,
+            TArray<UGSDEventSpawnZone*>({ Alley, Docks, Beach, Park }));
+
+        LoadedRegistry->GetCompatibleZones(BonfireTag, Zones);
+        TestEqual(TEXT("Loaded: wildcards sorted before tagged zones are still included"), Zones,
+            TArray<UGSDEventSpawnZone*>({ Alley, Docks, Beach, Park }));
+
+        LoadedRegistry->GetCompatibleZones(ConstructionTag, Zones);
+        TestEqual(TEXT("Loaded: multi-tag zone plus wildcards"), Zones,
+            TArray<UGSDEventSpawnZone*>({ Alley, Docks, Beach }));
+
+        LoadedRegistry->GetCompatibleZones(ZombieRaveTag, Zones);
+        TestEqual(TEXT("Loaded: tag with no zones falls back to wildcard zones only"), Zones,
+            TArray<UGSDEventSpawnZone*>({ Alley, Beach }));
+
+        LoadedRegistry->RemoveFromRoot();
+    }
+
+    // Rebuilding replaces the index rather than appending to it
+    Access.BuildZoneIndex(TArray<FAssetData>({ Assets[0] }));
+    TestEqual(TEXT("Rebuild replaces the index"), Registry->GetIndexedZoneCount(), 1);
+    Registry->GetCompatibleZonePaths(ZombieRaveTag, Paths);
+    TestEqual(TEXT("Stale wildcard entries cleared on rebuild"), Paths.Num(), 0);
+    Registry->GetCompatibleZonePaths(BonfireTag, Paths);
+    TestEqual(TEXT("Rebuilt index answers tag queries"), Paths, TArray<FSoftObjectPath>({ PathOf(0) }));
+
+    Registry->RemoveFromRoot();
+    return true;
+}
+
+/**
+ * Test suite for cancelling a pending zone load
+ * A registry waiting on asset discovery must unbind and stop loading when cancelled
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDEventSpawnRegistryCancelLoadTest, "GSD.DailyEvents.SpawnRegistry.CancelPendingLoad", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDEventSpawnRegistryCancelLoadTest::RunTest(const FString& Parameters)
+{
+    UGSDEventSpawnRegistry* Registry = NewObject<UGSDEventSpawnRegistry>();
+    Registry->AddToRoot();
+    FGSDEventSpawnRegistryTestAccess Access(*Registry);
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    // Test 1: Cancelling a registry wait unbinds the files-loaded callback
+    Access.BeginWaitForRegistryFiles();
+    TestTrue(TEXT("Waiting on registry discovery"), Access.IsWaitingForRegistryFiles());
+    TestTrue(TEXT("Bound to files-loaded"), AssetRegistry.OnFilesLoaded().IsBoundToObject(Registry));
+
+    Access.CancelPendingLoad();
+    TestFalse(TEXT("Wait handle cleared"), Access.IsWaitingForRegistryFiles());
+    TestFalse(TEXT("Files-loaded callback unbound"), AssetRegistry.OnFilesLoaded().IsBoundToObject(Registry));
+    TestFalse(TEXT("No longer loading"), Access.IsLoading());
+    TestFalse(TEXT("Cancelled load does not report loaded"), Registry->IsLoaded());
+
+    // Test 2: Cancelling with nothing pending is a no-op
+    Access.CancelPendingLoad();
+    TestFalse(TEXT("Repeated cancel stays idle"), Access.IsLoading());
+
+    // Test 3: Cancelling a second wait leaves no stale bindings behind
+    Access.BeginWaitForRegistryFiles();
+    Access.CancelPendingLoad();
+    TestFalse(TEXT("Second wait unbound"), AssetRegistry.OnFilesLoaded().IsBoundToObject(Registry));
+
+    Registry->RemoveFromRoot();
+    return true;
+}
+
+/**
+ * Test suite for batched NavMesh projection
+ * Every pass is one batched query on the game thread; misses retry after NavMeshRetryDelayMs with a wider extent
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDEventSpawnRegistryNavProjectionTest, "GSD.DailyEvents.SpawnRegistry.NavProjection", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDEventSpawnRegistryNavProjectionTest::RunTest(const FString& Parameters)
+{
+    UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+    UGSDEventSpawnRegistry* Registry = NewObject<UGSDEventSpawnRegistry>();
+    Registry->AddToRoot();
+    FGSDEventSpawnRegistryTestAccess Access(*Registry);
+
+    // Stand-in NavMesh: the ground plane Z=0; a point lands if it is within the extent's height
+    struct FProjectionCall
+    {
+        int32 NumPoints = 0;
+        float ExtentZ = 0.0f;
+        bool bGameThread = false;
+    };
+    TArray<FProjectionCall> Calls;
+    bool bNavDataAlive = true;
+    auto GroundPlane = [&Calls, &bNavDataAlive](TArray<FNavigationProjectionWork>& Workload, const FVector& Extent)
+    {
+        Calls.Add({ Workload.Num(), static_cast<float>(Extent.Z), IsInGameThread() });
+        if (!bNavDataAlive)
+        {
+            return false;
+        }
+
+        for (FNavigationProjectionWork& Work : Workload)
+        {
+            Work.bResult = FMath::Abs(Work.Point.Z) <= Extent.Z;
+            if (Work.bResult)
+            {
+                Work.OutLocation = FNavLocation(FVector(Work.Point.X, Work.Point.Y, 0.0f));
+            }
+        }
+        return true;
+    };
+
+    // Heights: lands on pass 0 (extent 50), pass 1 (100), pass 2 (200), never (3 passes max)
+    const TArray<FVector> Points = { FVector(0, 0, 10), FVector(100, 0, 80), FVector(200, 0, 150), FVector(300, 0, 1000) };
+
+    TArray<FGSDNavProjectionResult> Results;
+    int32 NumCompletions = 0;
+    auto MakeOnComplete = [&Results, &NumCompletions]()
+    {
+        return FOnNavProjectionBatchComplete::CreateLambda([&Results, &NumCompletions](const TArray<FGSDNavProjectionResult>& InResults)
+        {
+            Results = InResults;
+            NumCompletions++;
+        });
+    };
+
+    // Test 1: Immediate retries (no delay) complete before returning
+    {
+        FGSDEventSpawnConfig Config;
+        Config.MaxNavMeshRetries = 3;
+        Config.NavMeshRetryDelayMs = 0.0f;
+        Access.SetSpawnConfig(Config);
+
+        AddExpectedError(TEXT("Failed to project 1 of 4 points"), EAutomationExpectedErrorFlags::Contains, 1);
+        Access.ProjectPointsWithRetries(TestWorld, Points, 50.0f, GroundPlane, MakeOnComplete());
+
+        TestEqual(TEXT("Completed synchronously"), NumCompletions, 1);
+        TestEqual(TEXT("One batched query per pass"), Calls.Num(), 3);
+        TestFalse(TEXT("Every query ran on the game thread"), Calls.ContainsByPredicate([](const FProjectionCall& Call) { return !Call.bGameThread; }));
+        if (Calls.Num() == 3)
+        {
+            TestEqual(TEXT("Pass 0 queries every point"), Calls[0].NumPoints, 4);
+            TestEqual(TEXT("Pass 1 queries only misses"), Calls[1].NumPoints, 3);
+            TestEqual(TEXT("Pass 2 queries only misses"), Calls[2].NumPoints, 2);
+            TestEqual(TEXT("Extent doubles per pass"), Calls[2].ExtentZ, 200.0f);
+        }
+
+        TestEqual(TEXT("One result per point"), Results.Num(), Points.Num());
+        if (Results.Num() == Points.Num())
+        {
+            for (int32 i = 0; i < 3; ++i)
+            {
+                TestTrue(FString::Printf(TEXT("Point %d projected"), i), Results[i].bOnNavMesh);
+                TestEqual(FString::Printf(TEXT("Point %d kept its input order"), i), Results[i].Location, FVector(Points[i].X, Points[i].Y, 0.0f));
+            }
+            TestFalse(TEXT("Unreachable point reported off NavMesh"), Results[3].bOnNavMesh);
+            TestEqual(TEXT("Unreachable point keeps its input location"), Results[3].Location, Points[3]);
+        }
+    }
+
+    // Test 2: Retries wait for NavMeshRetryDelayMs on the world timer
+    {
+        Calls.Reset();
+        Results.Reset();
+        NumCompletions = 0;
+
+        FGSDEventSpawnConfig Config;
+        Config.MaxNavMeshRetries = 2;
+        Config.NavMeshRetryDelayMs = 10.0f;
+        Access.SetSpawnConfig(Config);
+
+        Access.ProjectPointsWithRetries(TestWorld, { Points[0], Points[1] }, 50.0f, GroundPlane, MakeOnComplete());
+        TestEqual(TEXT("First pass runs immediately"), Calls.Num(), 1);
+        TestEqual(TEXT("Misses wait for the retry delay"), NumCompletions, 0);
+
+        TestWorld->GetTimerManager().Tick(0.005f);
+        TestEqual(TEXT("No retry before the delay elapses"), Calls.Num(), 1);
+
+        TestWorld->GetTimerManager().Tick(0.01f);
+        TestEqual(TEXT("Retry pass ran after the delay"), Calls.Num(), 2);
+        TestEqual(TEXT("Completed after the retry"), NumCompletions, 1);
+        TestTrue(TEXT("Retried point projected"), Results.Num() == 2 && Results[1].bOnNavMesh);
+    }
+
+    // Test 3: NavMesh going away between passes drops the batch
+    {
+        Calls.Reset();
+        NumCompletions = 0;
+
+        Access.ProjectPointsWithRetries(TestWorld, { Points[1] }, 50.0f, GroundPlane, MakeOnComplete());
+        bNavDataAlive = false;
+        TestWorld->GetTimerManager().Tick(0.02f);
+        TestEqual(TEXT("Retry attempted"), Calls.Num(), 2);
+        TestEqual(TEXT("Dropped batch never completes"), NumCompletions, 0);
+    }
+
+    // Test 4: No NavMesh in the world completes immediately with the input points
+    {
+        NumCompletions = 0;
+        AddExpectedError(TEXT("no navigation data found"), EAutomationExpectedErrorFlags::Contains, 1);
+        Registry->ProjectPointsToNavMeshBatched(TestWorld, Points, 50.0f, MakeOnComplete());
+        TestEqual(TEXT("Completed without a NavMesh"), NumCompletions, 1);
+        TestTrue(TEXT("Input points returned unprojected"), Results.Num() == Points.Num() && !Results[0].bOnNavMesh && Results[0].Location == Points[0]);
+    }
+
+    Registry->RemoveFromRoot();
+    TestWorld->DestroyWorld(false);
+    return true;
+}
+
+#endif
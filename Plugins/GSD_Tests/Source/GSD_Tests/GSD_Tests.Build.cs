@@ -22,6 +22,7 @@ public class GSD_Tests : ModuleRules
             "MassEntity",
             "MassRepresentation",
             "MassSpawner",
+            "ZoneGraph",
             "AutomationController",
             "AutomationTest",
             "ChaosVehicles"
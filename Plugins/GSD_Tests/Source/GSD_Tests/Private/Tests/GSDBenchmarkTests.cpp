@@ -4,6 +4,10 @@
 #include "Misc/AutomationTest.h"
 #include "HAL/PlatformTime.h"
 #include "Types/GSDTelemetryTypes.h"
+#include "Spatial/GSDSpatialHash.h"
+#include "MassEntityManager.h"
+#include "MassEntityQuery.h"
+#include "MassCommonFragments.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -138,4 +142,78 @@ bool FGSDTelemetryBenchmark::RunTest(const FString& Parameters)
     return true;
 }
 
+// Benchmark 4: Spatial Hash Build - Incremental staging vs bulk RebuildFromQuery at 50k entities
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDSpatialHashBuildBenchmark,
+    "GSD.Benchmark.Crowd.SpatialHashBuild50k",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerformanceFilter)
+
+bool FGSDSpatialHashBuildBenchmark::RunTest(const FString& Parameters)
+{
+    const int32 EntityCount = 50000;
+    const float Extent = 50000.0f;
+
+    // Standalone entity manager with transform-only entities
+    TSharedRef<FMassEntityManager> EntityManager = MakeShareable(new FMassEntityManager());
+    EntityManager->Initialize();
+
+    const FMassArchetypeHandle Archetype = EntityManager->CreateArchetype({ FDataFragment_Transform::StaticStruct() });
+    TArray<FMassEntityHandle> Entities;
+    EntityManager->BatchCreateEntities(Archetype, EntityCount, Entities);
+
+    FRandomStream RandomStream(12345);
+    TArray<FVector> Positions;
+    Positions.Reserve(EntityCount);
+    for (const FMassEntityHandle& Entity : Entities)
+    {
+        const FVector Location(RandomStream.FRandRange(-Extent, Extent), RandomStream.FRandRange(-Extent, Extent), 0.0f);
+        EntityManager->GetFragmentDataChecked<FDataFragment_Transform>(Entity).GetMutableTransform().SetLocation(Location);
+        Positions.Add(Location);
+    }
+
+    // Incremental: per-entity UpdatePosition then Rebuild
+    UGSDSpatialHash* IncrementalHash = NewObject<UGSDSpatialHash>();
+    IncrementalHash->Initialize(FGSDSpatialHashConfig());
+
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Entities.Num(); i++)
+    {
+        IncrementalHash->UpdatePosition(Entities[i], Positions[i]);
+    }
+    IncrementalHash->Rebuild();
+    double EndTime = FPlatformTime::Seconds();
+    const double IncrementalMs = (EndTime - StartTime) * 1000.0;
+
+    // Bulk: one pass over the Mass chunks
+    UGSDSpatialHash* BulkHash = NewObject<UGSDSpatialHash>();
+    BulkHash->Initialize(FGSDSpatialHashConfig());
+
+    FMassEntityQuery Query;
+    Query.AddRequirement<FDataFragment_Transform>(EMassFragmentAccess::ReadOnly);
+    BulkHash->RebuildFromQuery(*EntityManager, Query);
+    const double BulkMs = BulkHash->GetLastBuildStats().BuildTimeMicroseconds / 1000.0;
+
+    UE_LOG(LogTemp, Log, TEXT("Spatial hash build benchmark (%d entities): incremental %.2f ms (rebuild %.2f ms), bulk %.2f ms"),
+        EntityCount, IncrementalMs, IncrementalHash->GetLastBuildStats().BuildTimeMicroseconds / 1000.0, BulkMs);
+
+    // Both paths must produce the same structure
+    TestEqual(TEXT("Bulk build contains all entities"), BulkHash->GetLastBuildStats().EntityCount, EntityCount);
+    TestTrue(TEXT("Bulk build stats flagged as bulk build"), BulkHash->GetLastBuildStats().bBulkBuild);
+    TestEqual(TEXT("Same occupied cell count"), BulkHash->GetOccupiedCellCount(), IncrementalHash->GetOccupiedCellCount());
+
+    TArray<FMassEntityHandle> IncrementalResults;
+    TArray<FMassEntityHandle> BulkResults;
+    IncrementalHash->QueryRadius(FVector::ZeroVector, 2000.0f, IncrementalResults);
+    BulkHash->QueryRadius(FVector::ZeroVector, 2000.0f, BulkResults);
+    TestEqual(TEXT("Same radius query result count"), BulkResults.Num(), IncrementalResults.Num());
+
+    // Incremental calls after a bulk build still work (slot map rebuilt lazily)
+    BulkHash->Remove(Entities[0]);
+    TestEqual(TEXT("Remove after bulk build"), BulkHash->GetTotalEntityCount(), EntityCount - 1);
+
+    // Target: 10ms on a perf machine; CI budget leaves headroom for shared agents and debug builds
+    TestTrue(TEXT("Bulk build should be < 50ms"), BulkMs < 50.0);
+
+    return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
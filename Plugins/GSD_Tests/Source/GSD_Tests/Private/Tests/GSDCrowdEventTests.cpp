@@ -0,0 +1,257 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#include "GSD_Tests.h"
+#include "Misc/AutomationTest.h"
+#include "Subsystems/GSDCrowdEventSubsystem.h"
+#include "Async/Async.h"
+#include "Engine/World.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Test 1: Event Queue Producers - Concurrent producers through repeated flushes, no loss or duplication, FIFO per producer
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdEventConcurrentProducersTest,
+    "GSD.Crowds.Events.ConcurrentProducers",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdEventConcurrentProducersTest::RunTest(const FString& Parameters)
+{
+    UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+    UGSDCrowdEventSubsystem* EventSubsystem = TestWorld ? TestWorld->GetSubsystem<UGSDCrowdEventSubsystem>() : nullptr;
+    if (!TestNotNull(TEXT("Event subsystem created for game world"), EventSubsystem))
+    {
+        if (TestWorld)
+        {
+            TestWorld->DestroyWorld(false);
+        }
+        return false;
+    }
+
+    // Stay under capacity so nothing is dropped even if the flush falls behind
+    constexpr int32 NumProducers = 4;
+    constexpr int32 EventsPerProducer = 2000;
+    static_assert(NumProducers * EventsPerProducer <= UGSDCrowdEventSubsystem::EventQueueCapacity, "Test must not overflow the queue");
+
+    // Received sequence numbers per producer, in delivery order
+    TArray<TArray<int32>> Received;
+    Received.SetNum(NumProducers);
+    int32 NumUnknownProducer = 0;
+    const int32 Handle = EventSubsystem->RegisterNativeBatchListener(EGSDCrowdEventType::None, FGameplayTag(),
+        FOnCrowdEventBatchNative::CreateLambda([&Received, &NumUnknownProducer](TConstArrayView<FGSDCrowdEvent> Events)
+        {
+            for (const FGSDCrowdEvent& Event : Events)
+            {
+                if (Received.IsValidIndex(Event.EntityID))
+                {
+                    Received[Event.EntityID].Add(Event.TargetEntityID);
+                }
+                else
+                {
+                    NumUnknownProducer++;
+                }
+            }
+        }));
+
+    std::atomic<bool> bStart = false;
+    std::atomic<int32> NumFinished = 0;
+    TArray<TFuture<void>> Producers;
+    for (int32 ProducerIndex = 0; ProducerIndex < NumProducers; ProducerIndex++)
+    {
+        Producers.Add(Async(EAsyncExecution::Thread, [EventSubsystem, ProducerIndex, &bStart, &NumFinished]()
+        {
+            while (!bStart.load(std::memory_order_acquire))
+            {
+                FPlatformProcess::Yield();
+            }
+            for (int32 Sequence = 0; Sequence < EventsPerProducer; Sequence++)
+            {
+                EventSubsystem->BroadcastPursuitEvent(EGSDCrowdEventType::TargetAcquired, ProducerIndex, Sequence, FVector::ZeroVector);
+            }
+            NumFinished.fetch_add(1, std::memory_order_release);
+        }));
+    }
+
+    // Flush on the game thread while producers are still writing
+    bStart.store(true, std::memory_order_release);
+    int32 NumFlushes = 0;
+    while (NumFinished.load(std::memory_order_acquire) < NumProducers)
+    {
+        EventSubsystem->FlushEvents();
+        NumFlushes++;
+    }
+    for (TFuture<void>& Producer : Producers)
+    {
+        Producer.Wait();
+    }
+    EventSubsystem->FlushEvents();
+    AddInfo(FString::Printf(TEXT("Delivered %d events over %d flushes"), NumProducers * EventsPerProducer, NumFlushes + 1));
+
+    TestEqual(TEXT("Nothing dropped"), EventSubsystem->GetTotalEventsDropped(), static_cast<int64>(0));
+    TestEqual(TEXT("Every broadcast counted"), EventSubsystem->GetTotalEventsBroadcast(), static_cast<int64>(NumProducers * EventsPerProducer));
+    TestEqual(TEXT("No corrupted payloads"), NumUnknownProducer, 0);
+
+    for (int32 ProducerIndex = 0; ProducerIndex < NumProducers; ProducerIndex++)
+    {
+        const TArray<int32>& Sequences = Received[ProducerIndex];
+        TestEqual(FString::Printf(TEXT("Producer %d: every event delivered once"), ProducerIndex), Sequences.Num(), EventsPerProducer);
+
+        bool bInOrder = true;
+        for (int32 i = 0; i < Sequences.Num(); i++)
+        {
+            bInOrder &= Sequences[i] == i;
+        }
+        TestTrue(FString::Printf(TEXT("Producer %d: delivered in FIFO order"), ProducerIndex), bInOrder);
+    }
+
+    EventSubsystem->UnregisterListener(Handle);
+    TestWorld->DestroyWorld(false);
+    return true;
+}
+
+// Test 2: Event Queue Overflow - Events past capacity are dropped and counted, the ring recovers after a flush
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdEventQueueFullTest,
+    "GSD.Crowds.Events.QueueFullDrops",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdEventQueueFullTest::RunTest(const FString& Parameters)
+{
+    UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+    UGSDCrowdEventSubsystem* EventSubsystem = TestWorld ? TestWorld->GetSubsystem<UGSDCrowdEventSubsystem>() : nullptr;
+    if (!TestNotNull(TEXT("Event subsystem created for game world"), EventSubsystem))
+    {
+        if (TestWorld)
+        {
+            TestWorld->DestroyWorld(false);
+        }
+        return false;
+    }
+
+    int32 NumDelivered = 0;
+    int32 LastSequence = INDEX_NONE;
+    const int32 Handle = EventSubsystem->RegisterNativeBatchListener(EGSDCrowdEventType::None, FGameplayTag(),
+        FOnCrowdEventBatchNative::CreateLambda([&NumDelivered, &LastSequence](TConstArrayView<FGSDCrowdEvent> Events)
+        {
+            NumDelivered += Events.Num();
+            if (Events.Num() > 0)
+            {
+                LastSequence = Events.Last().EntityID;
+            }
+        }));
+
+    constexpr int32 Capacity = UGSDCrowdEventSubsystem::EventQueueCapacity;
+    constexpr int32 NumOverflow = 100;
+    for (int32 i = 0; i < Capacity + NumOverflow; i++)
+    {
+        EventSubsystem->BroadcastEntityEvent(EGSDCrowdEventType::Spawn, i, FVector::ZeroVector);
+    }
+
+    TestEqual(TEXT("Overflow counted as dropped"), EventSubsystem->GetTotalEventsDropped(), static_cast<int64>(NumOverflow));
+    TestEqual(TEXT("Only queued events counted as broadcast"), EventSubsystem->GetTotalEventsBroadcast(), static_cast<int64>(Capacity));
+    TestEqual(TEXT("Events this frame capped at capacity"), EventSubsystem->GetEventsThisFrame(), Capacity);
+
+    // The flush reports the drop once
+    AddExpectedError(TEXT("event queue full"), EAutomationExpectedErrorFlags::Contains, 1);
+    EventSubsystem->FlushEvents();
+    TestEqual(TEXT("Every queued event delivered"), NumDelivered, Capacity);
+    TestEqual(TEXT("Oldest events kept, newest dropped"), LastSequence, Capacity - 1);
+    TestEqual(TEXT("Frame counter reset by flush"), EventSubsystem->GetEventsThisFrame(), 0);
+
+    // Ring is reusable after the flush; the drop count does not grow
+    NumDelivered = 0;
+    EventSubsystem->BroadcastEntityEvent(EGSDCrowdEventType::Spawn, Capacity + NumOverflow, FVector::ZeroVector);
+    EventSubsystem->FlushEvents();
+    TestEqual(TEXT("Queue accepts events after flush"), NumDelivered, 1);
+    TestEqual(TEXT("Drop count unchanged"), EventSubsystem->GetTotalEventsDropped(), static_cast<int64>(NumOverflow));
+
+    EventSubsystem->UnregisterListener(Handle);
+    TestWorld->DestroyWorld(false);
+    return true;
+}
+
+// Test 3: Listener Buckets - Exact, any-type, any-tag and wildcard listeners each receive matching events exactly once
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdEventWildcardBucketTest,
+    "GSD.Crowds.Events.WildcardBuckets",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdEventWildcardBucketTest::RunTest(const FString& Parameters)
+{
+    const FGameplayTag AlertTag = FGameplayTag::RequestGameplayTag(FName("Event.Daily.ZombieRave"), false);
+    if (!AlertTag.IsValid())
+    {
+        AddWarning(TEXT("Daily event gameplay tags not registered, skipping wildcard bucket test"));
+        return true;
+    }
+
+    UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+    UGSDCrowdEventSubsystem* EventSubsystem = TestWorld ? TestWorld->GetSubsystem<UGSDCrowdEventSubsystem>() : nullptr;
+    if (!TestNotNull(TEXT("Event subsystem created for game world"), EventSubsystem))
+    {
+        if (TestWorld)
+        {
+            TestWorld->DestroyWorld(false);
+        }
+        return false;
+    }
+
+    // Listener -> entity IDs received (each event carries a unique ID)
+    TMap<FString, TArray<int32>> Received;
+    auto Register = [EventSubsystem, &Received](const FString& Name, EGSDCrowdEventType EventType, FGameplayTag EventTag)
+    {
+        Received.Add(Name);
+        return EventSubsystem->RegisterNativeBatchListener(EventType, EventTag,
+            FOnCrowdEventBatchNative::CreateLambda([&Received, Name](TConstArrayView<FGSDCrowdEvent> Events)
+            {
+                for (const FGSDCrowdEvent& Event : Events)
+                {
+                    Received[Name].Add(Event.EntityID);
+                }
+            }));
+    };
+
+    TArray<int32> Handles;
+    Handles.Add(Register(TEXT("AlertTagged"), EGSDCrowdEventType::Alert, AlertTag));
+    Handles.Add(Register(TEXT("AlertAnyTag"), EGSDCrowdEventType::Alert, FGameplayTag()));
+    Handles.Add(Register(TEXT("AnyTypeTagged"), EGSDCrowdEventType::None, AlertTag));
+    Handles.Add(Register(TEXT("Wildcard"), EGSDCrowdEventType::None, FGameplayTag()));
+    Handles.Add(Register(TEXT("AttackTagged"), EGSDCrowdEventType::Attack, AlertTag));
+
+    auto Broadcast = [EventSubsystem](int32 ID, EGSDCrowdEventType EventType, FGameplayTag EventTag)
+    {
+        FGSDCrowdEvent Event;
+        Event.EventType = EventType;
+        Event.EventTag = EventTag;
+        Event.EntityID = ID;
+        EventSubsystem->BroadcastEvent(Event);
+    };
+    Broadcast(1, EGSDCrowdEventType::Alert, AlertTag);
+    Broadcast(2, EGSDCrowdEventType::Alert, FGameplayTag());
+    Broadcast(3, EGSDCrowdEventType::Death, AlertTag);
+    Broadcast(4, EGSDCrowdEventType::Death, FGameplayTag());
+    Broadcast(5, EGSDCrowdEventType::None, FGameplayTag());
+    EventSubsystem->FlushEvents();
+
+    TestEqual(TEXT("Exact bucket gets only its type and tag"), Received[TEXT("AlertTagged")], TArray<int32>({ 1 }));
+    TestEqual(TEXT("Any-tag bucket gets its type with or without a tag"), Received[TEXT("AlertAnyTag")], TArray<int32>({ 1, 2 }));
+    TestEqual(TEXT("Any-type bucket gets its tag for every type"), Received[TEXT("AnyTypeTagged")], TArray<int32>({ 1, 3 }));
+    TestEqual(TEXT("Wildcard bucket gets every event once, in order"), Received[TEXT("Wildcard")], TArray<int32>({ 1, 2, 3, 4, 5 }));
+    TestEqual(TEXT("Non-matching bucket gets nothing"), Received[TEXT("AttackTagged")].Num(), 0);
+
+    // Unregistering rebuilds the buckets
+    EventSubsystem->UnregisterListener(Handles[3]);
+    Broadcast(6, EGSDCrowdEventType::Alert, AlertTag);
+    EventSubsystem->FlushEvents();
+    TestEqual(TEXT("Unregistered wildcard no longer receives"), Received[TEXT("Wildcard")].Num(), 5);
+    TestEqual(TEXT("Remaining buckets still receive"), Received[TEXT("AlertTagged")], TArray<int32>({ 1, 6 }));
+
+    for (const int32 Handle : Handles)
+    {
+        if (Handle != Handles[3])
+        {
+            EventSubsystem->UnregisterListener(Handle);
+        }
+    }
+    TestWorld->DestroyWorld(false);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
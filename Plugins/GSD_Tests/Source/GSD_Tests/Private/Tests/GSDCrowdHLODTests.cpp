@@ -49,6 +49,66 @@ bool FGSDCrowdHLODClusteringTest::RunTest(const FString& Parameters)
     return true;
 }
 
+/**
+ * Test O(n) clustering results and incremental cluster maintenance
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdHLODIncrementalClusteringTest,
+    "GSD.Crowds.HLOD.IncrementalClustering",
+    EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ContextMask)
+
+bool FGSDCrowdHLODIncrementalClusteringTest::RunTest(const FString& Parameters)
+{
+    // Clusters are maintained without a world (no proxies spawned)
+    UGSDCrowdHLODManager* Manager = NewObject<UGSDCrowdHLODManager>();
+
+    TArray<FMassEntityHandle> Entities;
+    TArray<FVector> Positions;
+
+    // Two clusters of 5 entities in different 1000-unit cells
+    for (int32 i = 0; i < 10; i++)
+    {
+        FMassEntityHandle Entity;
+        Entity.Index = i;
+        Entity.SerialNumber = 1;
+        Entities.Add(Entity);
+
+        const float Base = i < 5 ? 1000.0f : 5000.0f;
+        Positions.Add(FVector(Base + (i % 5) * 10.0f, Base + (i % 5) * 10.0f, 0.0f));
+    }
+
+    Manager->ClusterEntitiesForHLOD(Entities, Positions, nullptr);
+    TestEqual("Two clusters built", Manager->GetClusterCount(), 2);
+
+    const FGSDCrowdCluster* Cluster = Manager->FindClusterAt(FVector(1000.0f, 1000.0f, 0.0f));
+    TestNotNull("Cluster found at first group", Cluster);
+    if (Cluster)
+    {
+        TestEqual("First cluster entity count", Cluster->EntityCount, 5);
+        TestTrue("First cluster center", Cluster->Center.Equals(FVector(1020.0f, 1020.0f, 0.0f), 0.01f));
+        TestTrue("First cluster radius", FMath::IsNearlyEqual(Cluster->Radius, FMath::Sqrt(2.0f) * 20.0f, 0.01f));
+    }
+
+    // No membership change - nothing rebuilt
+    TestEqual("Unchanged update rebuilds nothing", Manager->UpdateEntitiesForHLOD(Entities, Positions, nullptr), 0);
+
+    // Move one entity into a new cell - old and new cells rebuilt
+    Positions[0] = FVector(9000.0f, 9000.0f, 0.0f);
+    TestEqual("Moved entity dirties two cells", Manager->UpdateEntitiesForHLOD(Entities, Positions, nullptr), 2);
+    TestEqual("Three clusters after move", Manager->GetClusterCount(), 3);
+
+    Cluster = Manager->FindClusterAt(FVector(1000.0f, 1000.0f, 0.0f));
+    TestTrue("Source cluster shrank", Cluster && Cluster->EntityCount == 4);
+
+    // Remove the moved entity - its cell empties and the cluster is dropped
+    Entities.RemoveAt(0);
+    Positions.RemoveAt(0);
+    TestEqual("Removed entity dirties its cell", Manager->UpdateEntitiesForHLOD(Entities, Positions, nullptr), 1);
+    TestEqual("Empty cluster removed", Manager->GetClusterCount(), 2);
+    TestNull("No cluster at emptied cell", Manager->FindClusterAt(FVector(9000.0f, 9000.0f, 0.0f)));
+
+    return true;
+}
+
 /**
  * Test HLOD proxy visibility based on distance
  */
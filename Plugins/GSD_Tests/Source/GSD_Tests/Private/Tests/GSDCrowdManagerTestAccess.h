@@ -0,0 +1,164 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GSDCrowdManagerSubsystem.h"
+#include "Fragments/GSDZombieStateFragment.h"
+#include "Fragments/GSDZombieMovementFragment.h"
+#include "Fragments/GSDNavigationFragment.h"
+#include "MassEntityManager.h"
+#include "MassCommonFragments.h"
+#include "HAL/PlatformProcess.h"
+#include "Engine/World.h"
+#include "WorldPartition/WorldPartitionSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Automation test access to UGSDCrowdManagerSubsystem internals.
+ *
+ * Routes crowd spawning through a standalone FMassEntityManager (transform, state,
+ * movement and navigation fragments) so the async spawn queue, cell tracking and
+ * hibernation paths run without a Mass-enabled world. Entities are created in
+ * transform order; MaxEntitiesPerBatch simulates Mass creating fewer than requested.
+ */
+struct FGSDCrowdManagerTestAccess
+{
+    TSharedRef<FMassEntityManager> EntityManager;
+    FMassArchetypeHandle Archetype;
+
+    // Entities created per batch at most (the tail of a larger batch is dropped)
+    int32 MaxEntitiesPerBatch = MAX_int32;
+
+    explicit FGSDCrowdManagerTestAccess(UGSDCrowdManagerSubsystem& InCrowdManager)
+        : EntityManager(MakeShareable(new FMassEntityManager()))
+        , CrowdManager(InCrowdManager)
+    {
+        EntityManager->Initialize();
+        Archetype = EntityManager->CreateArchetype({
+            FDataFragment_Transform::StaticStruct(),
+            FGSDZombieStateFragment::StaticStruct(),
+            FGSDZombieMovementFragment::StaticStruct(),
+            FGSDNavigationFragment::StaticStruct() });
+
+        CrowdManager.EntityManagerOverride = EntityManager;
+        CrowdManager.SpawnBatchOverride = [this](UGSDCrowdEntityConfig*, const TArray<FTransform>& Transforms, TArray<FMassEntityHandle>& OutEntities)
+        {
+            const int32 NumToCreate = FMath::Min(Transforms.Num(), MaxEntitiesPerBatch);
+            if (NumToCreate <= 0)
+            {
+                return;
+            }
+
+            const int32 FirstNew = OutEntities.Num();
+            EntityManager->BatchCreateEntities(Archetype, NumToCreate, OutEntities);
+            for (int32 i = 0; i < NumToCreate; ++i)
+            {
+                EntityManager->GetFragmentDataChecked<FDataFragment_Transform>(OutEntities[FirstNew + i]).GetMutableTransform() = Transforms[i];
+            }
+        };
+    }
+
+    ~FGSDCrowdManagerTestAccess()
+    {
+        CrowdManager.EntityManagerOverride.Reset();
+        CrowdManager.SpawnBatchOverride = nullptr;
+    }
+
+    /** Batch size the async queue spawns with. */
+    static int32 GetBatchSize() { return UGSDCrowdManagerSubsystem::GetAsyncSpawnBatchSize(); }
+
+    /** Run one async spawn tick (what the next-tick timer does in a world). */
+    void ProcessAsyncSpawnQueue() { CrowdManager.ProcessAsyncSpawnQueue(); }
+
+    /**
+     * Tick the async spawn queue until it is empty, waiting for background transform generation.
+     * @return False if the queue did not drain within MaxTicks
+     */
+    bool DrainAsyncSpawnQueue(int32 MaxTicks = 10000)
+    {
+        for (int32 Tick = 0; Tick < MaxTicks && CrowdManager.GetPendingAsyncSpawnCount() > 0; ++Tick)
+        {
+            const int32 NumBefore = CrowdManager.GetPendingAsyncSpawnCount();
+            CrowdManager.ProcessAsyncSpawnQueue();
+            if (CrowdManager.GetPendingAsyncSpawnCount() == NumBefore)
+            {
+                FPlatformProcess::Sleep(0.001f);
+            }
+        }
+        return CrowdManager.GetPendingAsyncSpawnCount() == 0;
+    }
+
+    /** Apply deferred destruction queued by the subsystem. */
+    void FlushCommands() { EntityManager->FlushCommands(); }
+
+    /** Simulate World Partition streaming events. */
+    void CellLoaded(const FName& CellName) { CrowdManager.OnCellLoaded(CellName); }
+    void CellUnloaded(const FName& CellName) { CrowdManager.OnCellUnloaded(CellName); }
+
+    /** Number of live entities tracked across all cells. */
+    int32 GetTrackedEntityCount() const
+    {
+        int32 NumTracked = 0;
+        for (const TPair<int64, FGSDCellCrowdList>& Pair : CrowdManager.CellToCrowdMapping)
+        {
+            for (const FGSDCellCrowd& Crowd : Pair.Value.Crowds)
+            {
+                NumTracked += Crowd.Entities.Num();
+            }
+        }
+        return NumTracked;
+    }
+
+    /** Number of live entities tracked for one cell. */
+    int32 GetTrackedEntityCount(int64 CellKey) const
+    {
+        int32 NumTracked = 0;
+        if (const FGSDCellCrowdList* CrowdList = CrowdManager.CellToCrowdMapping.Find(CellKey))
+        {
+            for (const FGSDCellCrowd& Crowd : CrowdList->Crowds)
+            {
+                NumTracked += Crowd.Entities.Num();
+            }
+        }
+        return NumTracked;
+    }
+
+    /** All entities the subsystem currently tracks as spawned. */
+    const TArray<FMassEntityHandle>& GetSpawnedEntities() const { return CrowdManager.SpawnedEntityHandles; }
+
+private:
+    UGSDCrowdManagerSubsystem& CrowdManager;
+};
+
+/**
+ * Game world with a World Partition, so its crowd manager gates spawns and entities
+ * on streaming cell residency. The world has no streaming sources: cells load and
+ * unload only through FGSDCrowdManagerTestAccess::CellLoaded/CellUnloaded.
+ */
+struct FGSDPartitionedTestWorld
+{
+    UWorld* World = nullptr;
+    UGSDCrowdManagerSubsystem* CrowdManager = nullptr;
+
+    FGSDPartitionedTestWorld()
+    {
+        UWorld::InitializationValues IVS;
+        IVS.CreateWorldPartition(true);
+        World = UWorld::CreateWorld(EWorldType::Game, false, NAME_None, nullptr, true, ERHIFeatureLevel::Num, &IVS);
+        CrowdManager = World ? World->GetSubsystem<UGSDCrowdManagerSubsystem>() : nullptr;
+    }
+
+    ~FGSDPartitionedTestWorld()
+    {
+        if (World)
+        {
+            World->DestroyWorld(false);
+        }
+    }
+
+    bool IsValid() const { return World && CrowdManager && World->GetSubsystem<UWorldPartitionSubsystem>(); }
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,711 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#include "GSD_Tests.h"
+#include "Misc/AutomationTest.h"
+#include "Processors/GSDNavigationProcessor.h"
+#include "Fragments/GSDNavigationFragment.h"
+#include "Managers/GSDDeterminismManager.h"
+#include "MassEntity/DataFragmentTypes.h"
+#include "Spatial/GSDFlowField.h"
+#include "Subsystems/GSDFlowFieldSubsystem.h"
+#include "DataAssets/GSDCrowdConfig.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "GSDZoneGraphTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Automation test access to UGSDNavigationProcessor internals.
+ * Runs lane selection and sampling against a test ZoneGraph without a Mass pipeline.
+ */
+struct FGSDNavigationProcessorTestAccess
+{
+    explicit FGSDNavigationProcessorTestAccess(UGSDNavigationProcessor& InProcessor)
+        : Processor(InProcessor)
+    {
+    }
+
+    float GetLaneSearchRadius() const { return Processor.LaneSearchRadius; }
+
+    /** Subscribe the lane candidate cache to ZoneGraph data changes (Execute does this on first run). */
+    void BindZoneGraphDelegates() { Processor.BindZoneGraphDelegates(); }
+
+    int32 GetCachedCellCount() const
+    {
+        FReadScopeLock ReadLock(Processor.LaneCandidateLock);
+        return Processor.LaneCandidateCells.Num();
+    }
+
+    FZoneGraphLaneHandle PickRandomNearbyLane(const FVector& Location, const UZoneGraphSubsystem* ZoneGraphSubsystem, uint64 EntityKey) const
+    {
+        FGSDCounterRandom Random(FGSDCounterRandom::MakeStreamKey(1234, UGSDDeterminismManager::NavigationCategory), EntityKey, 0);
+        return Processor.PickRandomNearbyLane(Location, ZoneGraphSubsystem, Random, nullptr);
+    }
+
+    /** Bind an off-lane entity at Location to a nearby lane. */
+    void FindNearestLane(FGSDNavigationFragment& Nav, const FVector& Location, const UZoneGraphSubsystem* ZoneGraphSubsystem, uint64 EntityKey) const
+    {
+        FDataFragment_Transform Transform;
+        Transform.GetMutableTransform().SetLocation(Location);
+        FGSDCounterRandom Random(FGSDCounterRandom::MakeStreamKey(1234, UGSDDeterminismManager::NavigationCategory), EntityKey, 0);
+        Processor.FindNearestLane(Nav, Transform, ZoneGraphSubsystem, Random, nullptr);
+    }
+
+    /** Refresh the fragment's lane cache and hand off to the next lane if the current one is finished. */
+    void CheckLaneProgress(FGSDNavigationFragment& Nav, const UZoneGraphSubsystem* ZoneGraphSubsystem, uint64 EntityKey) const
+    {
+        FGSDCounterRandom Random(FGSDCounterRandom::MakeStreamKey(1234, UGSDDeterminismManager::NavigationCategory), EntityKey, 0);
+        Processor.RefreshLaneCache(Nav, ZoneGraphSubsystem);
+        Processor.CheckLaneProgress(Nav, ZoneGraphSubsystem, Random, nullptr);
+    }
+
+    using FLaneSampleRequest = UGSDNavigationProcessor::FLaneSampleRequest;
+
+    void UpdateTransformsFromLanes(TArrayView<FLaneSampleRequest> Requests, TArrayView<FDataFragment_Transform> Transforms, const UZoneGraphSubsystem* ZoneGraphSubsystem) const
+    {
+        Processor.UpdateTransformsFromLanes(Requests, Transforms, ZoneGraphSubsystem);
+    }
+
+private:
+    UGSDNavigationProcessor& Processor;
+};
+
+/**
+ * Automation test access to UGSDFlowFieldSubsystem internals.
+ * Projects walkability through a stand-in for the NavMesh.
+ */
+struct FGSDFlowFieldSubsystemTestAccess
+{
+    explicit FGSDFlowFieldSubsystemTestAccess(UGSDFlowFieldSubsystem& InFlowFields)
+        : FlowFields(InFlowFields)
+    {
+    }
+
+    ~FGSDFlowFieldSubsystemTestAccess()
+    {
+        FlowFields.NavProjectionOverride = nullptr;
+    }
+
+    using FNavProjectionFunction = UGSDFlowFieldSubsystem::FNavProjectionFunction;
+
+    void SetNavProjection(FNavProjectionFunction Project) { FlowFields.NavProjectionOverride = MoveTemp(Project); }
+
+private:
+    UGSDFlowFieldSubsystem& FlowFields;
+};
+
+namespace GSDCrowdNavigationTests
+{
+    /** Straight two-point lane along Y at the given X */
+    TArray<FVector> MakeLaneAtX(float X, float Z = 100.0f)
+    {
+        return { FVector(X, -500.0f, Z), FVector(X, 500.0f, Z) };
+    }
+
+    /** Every lane picked for Location over many entity keys */
+    TSet<FZoneGraphLaneHandle> CollectPicks(const FGSDNavigationProcessorTestAccess& Access, const FVector& Location, const UZoneGraphSubsystem* ZoneGraphSubsystem)
+    {
+        TSet<FZoneGraphLaneHandle> Picked;
+        for (uint64 EntityKey = 1; EntityKey <= 128; ++EntityKey)
+        {
+            const FZoneGraphLaneHandle Lane = Access.PickRandomNearbyLane(Location, ZoneGraphSubsystem, EntityKey);
+            if (Lane.IsValid())
+            {
+                Picked.Add(Lane);
+            }
+        }
+        return Picked;
+    }
+}
+
+// Test 1: Lane Candidate Cache - One cell query serves every entity in the cell, filtered per entity by distance,
+// and ZoneGraph data being added or removed clears the cache
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdLaneCandidateCacheTest,
+    "GSD.Crowds.Navigation.LaneCandidateCache",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdLaneCandidateCacheTest::RunTest(const FString& Parameters)
+{
+    using namespace GSDCrowdNavigationTests;
+
+    FGSDZoneGraphTestWorld TestWorld;
+    if (!TestTrue(TEXT("Test world with ZoneGraph subsystem"), TestWorld.IsValid()))
+    {
+        return false;
+    }
+
+    UGSDNavigationProcessor* Processor = NewObject<UGSDNavigationProcessor>(TestWorld.World);
+    FGSDNavigationProcessorTestAccess Access(*Processor);
+    Access.BindZoneGraphDelegates();
+
+    const float Radius = Access.GetLaneSearchRadius();
+    TestEqual(TEXT("Default search radius"), Radius, 2000.0f);
+
+    // Both entities share the cell [0, Radius)^3
+    const FVector EntityA(100.0f, 100.0f, 100.0f);
+    const FVector EntityB(Radius - 100.0f, 100.0f, 100.0f);
+
+    AZoneGraphData* ZoneGraphData = TestWorld.AddZoneGraph({
+        MakeLaneAtX(100.0f),                    // 0: within radius of both
+        MakeLaneAtX(100.0f - 0.95f * Radius),   // 1: within radius of A only, beyond the cell edge
+        MakeLaneAtX(1.75f * Radius),            // 2: within radius of B only
+        MakeLaneAtX(10.0f * Radius) });         // 3: far from both
+    const FZoneGraphLaneHandle Lanes[] = {
+        FGSDZoneGraphTestWorld::GetLane(ZoneGraphData, 0),
+        FGSDZoneGraphTestWorld::GetLane(ZoneGraphData, 1),
+        FGSDZoneGraphTestWorld::GetLane(ZoneGraphData, 2),
+        FGSDZoneGraphTestWorld::GetLane(ZoneGraphData, 3) };
+
+    TestEqual(TEXT("Cache starts empty"), Access.GetCachedCellCount(), 0);
+
+    const TSet<FZoneGraphLaneHandle> PicksA = CollectPicks(Access, EntityA, TestWorld.ZoneGraphSubsystem);
+    TestEqual(TEXT("One cell cached"), Access.GetCachedCellCount(), 1);
+    TestEqual(TEXT("A picks only lanes within its search radius"), PicksA.Num(), 2);
+    TestTrue(TEXT("A picks the shared nearby lane"), PicksA.Contains(Lanes[0]));
+    TestTrue(TEXT("A reaches a lane past the cell edge"), PicksA.Contains(Lanes[1]));
+
+    const TSet<FZoneGraphLaneHandle> PicksB = CollectPicks(Access, EntityB, TestWorld.ZoneGraphSubsystem);
+    TestEqual(TEXT("Same cell reused for B"), Access.GetCachedCellCount(), 1);
+    TestEqual(TEXT("B picks only lanes within its search radius"), PicksB.Num(), 2);
+    TestTrue(TEXT("B picks the shared nearby lane"), PicksB.Contains(Lanes[0]));
+    TestTrue(TEXT("B picks its own nearby lane"), PicksB.Contains(Lanes[2]));
+    TestFalse(TEXT("Far lane never picked"), PicksA.Contains(Lanes[3]) || PicksB.Contains(Lanes[3]));
+
+    // Adding ZoneGraph data clears the cache; the next pick sees the new lane
+    AZoneGraphData* AddedData = TestWorld.AddZoneGraph({ MakeLaneAtX(200.0f) });
+    TestEqual(TEXT("Cache cleared when ZoneGraph data is added"), Access.GetCachedCellCount(), 0);
+
+    const TSet<FZoneGraphLaneHandle> PicksAfterAdd = CollectPicks(Access, EntityA, TestWorld.ZoneGraphSubsystem);
+    TestEqual(TEXT("Cell rebuilt on demand"), Access.GetCachedCellCount(), 1);
+    TestTrue(TEXT("Lane from added data is a candidate"), PicksAfterAdd.Contains(FGSDZoneGraphTestWorld::GetLane(AddedData, 0)));
+
+    // Removing ZoneGraph data clears it again
+    TestWorld.RemoveZoneGraph(AddedData);
+    TestEqual(TEXT("Cache cleared when ZoneGraph data is removed"), Access.GetCachedCellCount(), 0);
+
+    return true;
+}
+
+// Test 2: Lane Sampling - The chunk sampler matches ZoneGraph's own lane location query along a whole lane
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdLaneSamplingTest,
+    "GSD.Crowds.Navigation.LaneSampling",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdLaneSamplingTest::RunTest(const FString& Parameters)
+{
+    using FLaneSampleRequest = FGSDNavigationProcessorTestAccess::FLaneSampleRequest;
+
+    FGSDZoneGraphTestWorld TestWorld;
+    if (!TestTrue(TEXT("Test world with ZoneGraph subsystem"), TestWorld.IsValid()))
+    {
+        return false;
+    }
+
+    UGSDNavigationProcessor* Processor = NewObject<UGSDNavigationProcessor>(TestWorld.World);
+    FGSDNavigationProcessorTestAccess Access(*Processor);
+
+    // Bent, climbing lane with uneven segment lengths (300, 400, 700, 200), plus a second lane in the same batch
+    AZoneGraphData* ZoneGraphData = TestWorld.AddZoneGraph({
+        { FVector(0, 0, 0), FVector(300, 0, 0), FVector(300, 400, 0), FVector(1000, 400, 0), FVector(1000, 400, 200) },
+        { FVector(0, 2000, 0), FVector(500, 2000, 0) } });
+    const FZoneGraphLaneHandle BentLane = FGSDZoneGraphTestWorld::GetLane(ZoneGraphData, 0);
+    const FZoneGraphLaneHandle OtherLane = FGSDZoneGraphTestWorld::GetLane(ZoneGraphData, 1);
+
+    const float LaneLength = TestWorld.ZoneGraphSubsystem->GetLaneLength(BentLane);
+    TestEqual(TEXT("Lane length from progressions"), LaneLength, 1600.0f, 0.01f);
+
+    // Start, mid-segment, exactly on interior points, within the last segment, the end, past the end.
+    // Deliberately unsorted and interleaved with the other lane: the sampler sorts and walks forward
+    const TArray<float> Distances = { 1500.0f, 0.0f, 650.0f, 300.0f, 1800.0f, 150.0f, 1400.0f, 700.0f, 1600.0f, 1050.0f, -50.0f };
+
+    TArray<FLaneSampleRequest> Requests;
+    for (int32 i = 0; i < Distances.Num(); ++i)
+    {
+        Requests.Add({ BentLane, Distances[i], i });
+        if (i % 3 == 0)
+        {
+            Requests.Add({ OtherLane, 250.0f, Distances.Num() + i });
+        }
+    }
+
+    TArray<FDataFragment_Transform> Transforms;
+    Transforms.SetNum(Distances.Num() * 2);
+    Access.UpdateTransformsFromLanes(Requests, Transforms, TestWorld.ZoneGraphSubsystem);
+
+    for (int32 i = 0; i < Distances.Num(); ++i)
+    {
+        // Past either end the sampler clamps to the lane
+        const float ClampedDistance = FMath::Clamp(Distances[i], 0.0f, LaneLength);
+
+        FZoneGraphLaneLocation Expected;
+        if (!TestTrue(FString::Printf(TEXT("GetLaneLocation at %.0f"), Distances[i]),
+            TestWorld.ZoneGraphSubsystem->GetLaneLocation(BentLane, ClampedDistance, Expected)))
+        {
+            continue;
+        }
+
+        const FTransform& Sampled = Transforms[i].GetTransform();
+        TestTrue(FString::Printf(TEXT("Position at %.0f: sampled %s, expected %s"), Distances[i], *Sampled.GetLocation().ToString(), *Expected.Position.ToString()),
+            Sampled.GetLocation().Equals(Expected.Position, 0.1f));
+        TestTrue(FString::Printf(TEXT("Facing at %.0f: sampled %s, expected %s"), Distances[i], *Sampled.GetRotation().GetForwardVector().ToString(), *Expected.Direction.ToString()),
+            Sampled.GetRotation().GetForwardVector().Equals(Expected.Direction, 0.01f));
+    }
+
+    // Interleaved requests on the other lane are sampled from their own lane
+    FZoneGraphLaneLocation OtherExpected;
+    TestWorld.ZoneGraphSubsystem->GetLaneLocation(OtherLane, 250.0f, OtherExpected);
+    TestTrue(TEXT("Other lane sampled from its own points"), Transforms[Distances.Num()].GetTransform().GetLocation().Equals(OtherExpected.Position, 0.1f));
+
+    return true;
+}
+
+// Test 3: Lane Rebind - Entities joining a lane (off-lane rebind or lane-end hand-off) start where they are
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdLaneRebindTest,
+    "GSD.Crowds.Navigation.LaneRebind",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdLaneRebindTest::RunTest(const FString& Parameters)
+{
+    FGSDZoneGraphTestWorld TestWorld;
+    if (!TestTrue(TEXT("Test world with ZoneGraph subsystem"), TestWorld.IsValid()))
+    {
+        return false;
+    }
+
+    UGSDNavigationProcessor* Processor = NewObject<UGSDNavigationProcessor>(TestWorld.World);
+    FGSDNavigationProcessorTestAccess Access(*Processor);
+    const UZoneGraphSubsystem* ZoneGraphSubsystem = TestWorld.ZoneGraphSubsystem;
+
+    // Long straight lane, and a corner of two lanes meeting at (1000, 5000)
+    AZoneGraphData* ZoneGraphData = TestWorld.AddZoneGraph({
+        { FVector(0, 0, 100), FVector(2000, 0, 100) },
+        { FVector(0, 5000, 100), FVector(1000, 5000, 100) },
+        { FVector(1000, 5000, 100), FVector(1000, 6000, 100) } });
+    const FZoneGraphLaneHandle StraightLane = FGSDZoneGraphTestWorld::GetLane(ZoneGraphData, 0);
+    const FZoneGraphLaneHandle CornerIn = FGSDZoneGraphTestWorld::GetLane(ZoneGraphData, 1);
+
+    // Off-lane rebind (after spawn or when pursuit ends) joins at the nearest point, not the lane start
+    {
+        FGSDNavigationFragment Nav;
+        Access.FindNearestLane(Nav, FVector(1200.0f, 50.0f, 100.0f), ZoneGraphSubsystem, 1);
+        TestTrue(TEXT("Bound to a lane"), Nav.bIsOnLane);
+        TestTrue(TEXT("Bound to the only nearby lane"), Nav.CurrentLane == StraightLane);
+        TestEqual(TEXT("Starts at the projected distance"), Nav.LanePosition, 1200.0f, 1.0f);
+    }
+
+    // Lane-end hand-off continues from the end point on whichever lane is picked
+    const FVector CornerLocation(1000.0f, 5000.0f, 100.0f);
+    int32 NumHandOffs = 0;
+    for (uint64 EntityKey = 1; EntityKey <= 16; ++EntityKey)
+    {
+        FGSDNavigationFragment Nav;
+        Nav.CurrentLane = CornerIn;
+        Nav.bIsOnLane = true;
+        Nav.LanePosition = 1010.0f;
+        Access.CheckLaneProgress(Nav, ZoneGraphSubsystem, EntityKey);
+
+        if (!Nav.bIsOnLane)
+        {
+            continue;
+        }
+        NumHandOffs++;
+
+        FZoneGraphLaneLocation Joined;
+        ZoneGraphSubsystem->GetLaneLocation(Nav.CurrentLane, Nav.LanePosition, Joined);
+        TestTrue(FString::Printf(TEXT("Entity %llu joined at the corner, not at a lane start (%s)"), EntityKey, *Joined.Position.ToString()),
+            Joined.Position.Equals(CornerLocation, 1.0f));
+    }
+    TestTrue(TEXT("Lane-end hand-offs happened"), NumHandOffs > 0);
+
+    return true;
+}
+
+// Test 4: Flow Field Goal - A goal in a blocked cell is reachable for that build only
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdFlowFieldGoalWalkabilityTest,
+    "GSD.Crowds.Navigation.FlowFieldGoalWalkability",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdFlowFieldGoalWalkabilityTest::RunTest(const FString& Parameters)
+{
+    FGSDFlowField Field;
+    Field.Initialize(FVector::ZeroVector, 100.0f, 8);
+
+    const FIntPoint BlockedCell(4, 4);
+    const int32 BlockedIndex = Field.GetCellIndex(BlockedCell.X, BlockedCell.Y);
+    Field.SetWalkable(BlockedIndex, false);
+
+    // Target standing in a blocked cell (e.g. on a NavMesh gap) still gets a field
+    TestTrue(TEXT("Build toward blocked cell"), Field.Build(Field.GetCellCenter(BlockedCell)));
+    TestTrue(TEXT("Neighbours lead into the goal cell"), !Field.SampleDirection(Field.GetCellCenter(FIntPoint(2, 4))).IsZero());
+    TestFalse(TEXT("Goal cell stays blocked after the build"), Field.IsWalkable(BlockedIndex));
+
+    // Once the goal moves on, paths route around the blocked cell again
+    TestTrue(TEXT("Build toward another goal"), Field.Build(Field.GetCellCenter(FIntPoint(6, 4))));
+    TestTrue(TEXT("Old goal cell unreachable"), Field.GetIntegrationCost(BlockedCell) == FGSDFlowField::UnreachableCost);
+    TestTrue(TEXT("Path detours around the old goal cell"), Field.SampleDirection(Field.GetCellCenter(FIntPoint(3, 4))).Y != 0.0f);
+
+    return true;
+}
+
+// Test 5: Flow Field Re-centring - A target outrunning its grid keeps a built field while the re-centred one
+// waits for rebuild budget, and re-centred fields are rebuilt first
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdFlowFieldRecenterTest,
+    "GSD.Crowds.Navigation.FlowFieldRecenter",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdFlowFieldRecenterTest::RunTest(const FString& Parameters)
+{
+    const UGSDCrowdConfig* Config = UGSDCrowdConfig::GetDefaultConfig();
+    const int32 MinPursuers = Config ? Config->MinPursuersForFlowField : 32;
+    const int32 MaxFields = Config ? Config->MaxFlowFields : 8;
+    const int32 MaxRebuilds = Config ? Config->MaxFlowFieldRebuildsPerFrame : 2;
+    const float CellSize = Config ? Config->FlowFieldCellSize : 200.0f;
+    const int32 Dimension = Config ? Config->FlowFieldDimension : 128;
+
+    // One more target than the per-frame rebuild budget
+    const int32 NumTargets = MaxRebuilds + 1;
+    if (MaxRebuilds < 1 || MaxFields < NumTargets)
+    {
+        AddWarning(TEXT("Flow field config leaves no room to exceed the rebuild budget, skipping re-centring test"));
+        return true;
+    }
+
+    UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+    UGSDFlowFieldSubsystem* FlowFields = TestWorld ? TestWorld->GetSubsystem<UGSDFlowFieldSubsystem>() : nullptr;
+    if (!TestNotNull(TEXT("Flow field subsystem created for game world"), FlowFields))
+    {
+        if (TestWorld)
+        {
+            TestWorld->DestroyWorld(false);
+        }
+        return false;
+    }
+
+    // Targets far apart; no NavMesh, so every cell is walkable
+    const float GridExtent = CellSize * Dimension;
+    TArray<FGSDFlowFieldDemand> Demands;
+    for (int32 i = 0; i < NumTargets; ++i)
+    {
+        Demands.Add({ 100 + i, FVector(i * GridExtent * 4.0f, 0.0f, 0.0f), MinPursuers });
+    }
+
+    auto RunUntilAllBuilt = [&]()
+    {
+        for (int32 Frame = 0; Frame < NumTargets * 2; ++Frame)
+        {
+            FlowFields->UpdateFields(Demands, 0.016f);
+        }
+    };
+    RunUntilAllBuilt();
+
+    TArray<int32> FieldIndices;
+    TArray<uint32> Generations;
+    for (const FGSDFlowFieldDemand& Demand : Demands)
+    {
+        uint32 Generation = 0;
+        FieldIndices.Add(FlowFields->FindFieldForTarget(Demand.TargetID, Generation));
+        Generations.Add(Generation);
+    }
+    if (!TestFalse(TEXT("Every target has a built field"), FieldIndices.Contains(INDEX_NONE)))
+    {
+        TestWorld->DestroyWorld(false);
+        return false;
+    }
+
+    // Every target leaves its grid in the same frame: more re-centres than the budget can rebuild
+    const FVector CellOffset(CellSize * 3.0f, 0.0f, 0.0f);
+    TArray<FVector> OldLocations;
+    for (FGSDFlowFieldDemand& Demand : Demands)
+    {
+        OldLocations.Add(Demand.Location);
+        Demand.Location += FVector(0.0f, GridExtent * 2.0f, 0.0f);
+    }
+    const int64 RebuildsBefore = FlowFields->GetTotalRebuilds();
+    FlowFields->UpdateFields(Demands, 0.016f);
+    TestEqual(TEXT("Rebuilds capped per frame"), FlowFields->GetTotalRebuilds() - RebuildsBefore, static_cast<int64>(MaxRebuilds));
+
+    int32 NumStillOld = 0;
+    for (int32 i = 0; i < NumTargets; ++i)
+    {
+        uint32 Generation = 0;
+        const int32 FieldIndex = FlowFields->FindFieldForTarget(Demands[i].TargetID, Generation);
+        TestEqual(FString::Printf(TEXT("Target %d keeps its field while re-centring"), i), FieldIndex, FieldIndices[i]);
+        TestTrue(FString::Printf(TEXT("Target %d cached field stays valid"), i), FlowFields->IsFieldValid(FieldIndices[i], Generations[i]));
+
+        // Unbuilt re-centred fields leave the old one steering toward the last goal
+        if (FlowFields->SampleDirection(FieldIndices[i], Demands[i].Location + CellOffset).IsZero())
+        {
+            NumStillOld++;
+            TestFalse(FString::Printf(TEXT("Target %d old field still steers"), i), FlowFields->SampleDirection(FieldIndices[i], OldLocations[i] + CellOffset).IsZero());
+        }
+    }
+    TestEqual(TEXT("Targets beyond the budget wait with their old field"), NumStillOld, NumTargets - MaxRebuilds);
+
+    RunUntilAllBuilt();
+    for (int32 i = 0; i < NumTargets; ++i)
+    {
+        TestFalse(FString::Printf(TEXT("Target %d field re-centred once budget allows"), i),
+            FlowFields->SampleDirection(FieldIndices[i], Demands[i].Location + CellOffset).IsZero());
+    }
+
+    // One target re-centres while the others only change cell: the re-centred field is rebuilt first
+    Demands[NumTargets - 1].Location += FVector(0.0f, GridExtent * 2.0f, 0.0f);
+    for (int32 i = 0; i < NumTargets - 1; ++i)
+    {
+        Demands[i].Location += CellOffset;
+    }
+    FlowFields->UpdateFields(Demands, 0.016f);
+    TestFalse(TEXT("Re-centred field rebuilt ahead of goal-only rebuilds"),
+        FlowFields->SampleDirection(FieldIndices[NumTargets - 1], Demands[NumTargets - 1].Location + CellOffset).IsZero());
+
+    TestWorld->DestroyWorld(false);
+    return true;
+}
+
+// Test 6: Lane Offset - The separation offset eases back to the lane and keeps entities in place across lane changes
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdLaneOffsetTest,
+    "GSD.Crowds.Navigation.LaneOffset",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdLaneOffsetTest::RunTest(const FString& Parameters)
+{
+    const float MaxOffset = 150.0f;
+    const float RecoveryRate = 2.0f;
+    const float DeltaTime = 1.0f / 30.0f;
+
+    // Steering accumulates and is clamped in XY
+    {
+        FVector Offset = FVector::ZeroVector;
+        for (int32 Frame = 0; Frame < 300; ++Frame)
+        {
+            Offset = UGSDNavigationProcessor::UpdateLaneOffset(Offset, FVector(200.0f, 0.0f, 0.0f), DeltaTime, true, MaxOffset, RecoveryRate);
+        }
+        TestEqual(TEXT("Steered offset clamped to the maximum"), Offset.Size2D(), MaxOffset, 0.1f);
+    }
+
+    // No steering (crowd dispersed): the offset returns to the lane
+    {
+        FVector Offset(MaxOffset, 0.0f, 0.0f);
+        const FVector FirstFrame = UGSDNavigationProcessor::UpdateLaneOffset(Offset, FVector::ZeroVector, DeltaTime, true, MaxOffset, RecoveryRate);
+        TestTrue(TEXT("Offset shrinks on the first unsteered frame"), FirstFrame.Size2D() < MaxOffset);
+
+        for (int32 Frame = 0; Frame < 150; ++Frame)
+        {
+            Offset = UGSDNavigationProcessor::UpdateLaneOffset(Offset, FVector::ZeroVector, DeltaTime, true, MaxOffset, RecoveryRate);
+        }
+        TestTrue(FString::Printf(TEXT("Offset decayed to the lane after 5s (%s)"), *Offset.ToString()), Offset.IsZero());
+    }
+
+    // Separation disabled: steering is ignored and the offset eases back rather than snapping
+    {
+        const FVector Offset(0.0f, 100.0f, 0.0f);
+        const FVector Next = UGSDNavigationProcessor::UpdateLaneOffset(Offset, FVector(0.0f, 500.0f, 0.0f), DeltaTime, false, MaxOffset, RecoveryRate);
+        TestTrue(TEXT("Disabled separation does not steer"), Next.Y < Offset.Y);
+        TestTrue(TEXT("Disabled separation does not snap to the lane"), Next.Y > 0.0f);
+    }
+
+    // Frame-rate independence: one 0.1s frame decays like three 1/30s frames
+    {
+        const FVector Offset(100.0f, 0.0f, 0.0f);
+        FVector Stepped = Offset;
+        for (int32 Frame = 0; Frame < 3; ++Frame)
+        {
+            Stepped = UGSDNavigationProcessor::UpdateLaneOffset(Stepped, FVector::ZeroVector, 0.1f / 3.0f, true, MaxOffset, RecoveryRate);
+        }
+        const FVector Single = UGSDNavigationProcessor::UpdateLaneOffset(Offset, FVector::ZeroVector, 0.1f, true, MaxOffset, RecoveryRate);
+        TestEqual(TEXT("Decay independent of frame rate"), Stepped.X, Single.X, 0.01f);
+    }
+
+    FGSDZoneGraphTestWorld TestWorld;
+    if (!TestTrue(TEXT("Test world with ZoneGraph subsystem"), TestWorld.IsValid()))
+    {
+        return false;
+    }
+
+    UGSDNavigationProcessor* Processor = NewObject<UGSDNavigationProcessor>(TestWorld.World);
+    FGSDNavigationProcessorTestAccess Access(*Processor);
+    const UZoneGraphSubsystem* ZoneGraphSubsystem = TestWorld.ZoneGraphSubsystem;
+
+    AZoneGraphData* ZoneGraphData = TestWorld.AddZoneGraph({
+        { FVector(0, 0, 100), FVector(2000, 0, 100) },
+        { FVector(0, 5000, 100), FVector(1000, 5000, 100) },
+        { FVector(1000, 5000, 100), FVector(1000, 6000, 100) } });
+    const FZoneGraphLaneHandle CornerIn = FGSDZoneGraphTestWorld::GetLane(ZoneGraphData, 1);
+
+    // Returns the XY position the processor renders: lane sample plus offset
+    auto RenderedPosition = [ZoneGraphSubsystem](const FGSDNavigationFragment& Nav)
+    {
+        FZoneGraphLaneLocation Sample;
+        ZoneGraphSubsystem->GetLaneLocation(Nav.CurrentLane, Nav.LanePosition, Sample);
+        const FVector Position = Sample.Position + Nav.LaneOffset;
+        return FVector(Position.X, Position.Y, 0.0f);
+    };
+
+    // Off-lane rebind keeps the entity where it stands beside the lane
+    {
+        const FVector Location(1200.0f, 80.0f, 100.0f);
+        FGSDNavigationFragment Nav;
+        Access.FindNearestLane(Nav, Location, ZoneGraphSubsystem, 1);
+        if (TestTrue(TEXT("Bound to a lane"), Nav.bIsOnLane))
+        {
+            TestTrue(TEXT("Offset re-projected onto the new lane"), Nav.LaneOffset.Equals(FVector(0.0f, 80.0f, 0.0f), 1.0f));
+            TestTrue(TEXT("No jump on rebind"), RenderedPosition(Nav).Equals(FVector(Location.X, Location.Y, 0.0f), 1.0f));
+        }
+    }
+
+    // Lane-end hand-off keeps the entity's offset position, whichever lane is picked
+    const FVector EndPosition(1000.0f, 5060.0f, 0.0f);
+    for (uint64 EntityKey = 1; EntityKey <= 16; ++EntityKey)
+    {
+        FGSDNavigationFragment Nav;
+        Nav.CurrentLane = CornerIn;
+        Nav.bIsOnLane = true;
+        Nav.LanePosition = 1010.0f;
+        Nav.LaneOffset = FVector(0.0f, 60.0f, 0.0f);
+        Access.CheckLaneProgress(Nav, ZoneGraphSubsystem, EntityKey);
+
+        if (!Nav.bIsOnLane)
+        {
+            TestTrue(TEXT("Offset cleared when leaving the lane"), Nav.LaneOffset.IsZero());
+            continue;
+        }
+
+        const FVector Rendered = RenderedPosition(Nav);
+        TestTrue(FString::Printf(TEXT("Entity %llu keeps its position across the hand-off (%s)"), EntityKey, *Rendered.ToString()),
+            Rendered.Equals(EndPosition, 1.0f));
+        TestTrue(TEXT("Re-projected offset within the lane separation limit"), Nav.LaneOffset.Size2D() <= MaxOffset);
+    }
+
+    return true;
+}
+
+// Test 7: Flow Field Walkability - Projection is spread across frames, cached per height band,
+// dropped where the NavMesh changes, and small target drift retargets without a rebuild
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdFlowFieldWalkabilityTest,
+    "GSD.Crowds.Navigation.FlowFieldWalkability",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdFlowFieldWalkabilityTest::RunTest(const FString& Parameters)
+{
+    const UGSDCrowdConfig* Config = UGSDCrowdConfig::GetDefaultConfig();
+    const int32 MinPursuers = Config ? Config->MinPursuersForFlowField : 32;
+    const int32 MaxFields = Config ? Config->MaxFlowFields : 8;
+    const int32 MaxProjections = Config ? Config->MaxFlowFieldProjectionsPerFrame : 4096;
+    const int32 GoalTolerance = Config ? Config->FlowFieldGoalToleranceCells : 1;
+    const float CellSize = Config ? Config->FlowFieldCellSize : 200.0f;
+    const int32 Dimension = Config ? Config->FlowFieldDimension : 128;
+    const int32 NumCells = Dimension * Dimension;
+    const int32 FramesToFill = FMath::DivideAndRoundUp(NumCells, MaxProjections);
+
+    if (MaxFields < 2)
+    {
+        AddWarning(TEXT("Flow field config allows a single field, skipping walkability test"));
+        return true;
+    }
+
+    UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+    UGSDFlowFieldSubsystem* FlowFields = TestWorld ? TestWorld->GetSubsystem<UGSDFlowFieldSubsystem>() : nullptr;
+    if (!TestNotNull(TEXT("Flow field subsystem created for game world"), FlowFields))
+    {
+        if (TestWorld)
+        {
+            TestWorld->DestroyWorld(false);
+        }
+        return false;
+    }
+
+    // Stand-in NavMesh: a ground floor at Z=0 everywhere (optionally split by a wall one cell wide
+    // at X in [3, 4) cells), and an upper deck at Z = 10 cells covering only X < 0
+    const float DeckZ = CellSize * 10.0f;
+    const float WallMinX = CellSize * 3.0f;
+    bool bWallBuilt = false;
+    int32 LargestBatch = 0;
+    {
+        FGSDFlowFieldSubsystemTestAccess Access(*FlowFields);
+        Access.SetNavProjection([&](TArray<FNavigationProjectionWork>& Workload, const FVector& Extent)
+        {
+            LargestBatch = FMath::Max(LargestBatch, Workload.Num());
+            for (FNavigationProjectionWork& Work : Workload)
+            {
+                const bool bInWall = bWallBuilt && Work.Point.X >= WallMinX && Work.Point.X < WallMinX + CellSize;
+                const bool bOnGround = FMath::Abs(Work.Point.Z) <= Extent.Z && !bInWall;
+                const bool bOnDeck = FMath::Abs(Work.Point.Z - DeckZ) <= Extent.Z && Work.Point.X < 0.0f;
+                Work.bResult = bOnGround || bOnDeck;
+            }
+        });
+
+        const FVector GroundTarget(CellSize * 0.5f, CellSize * 0.5f, 0.0f);
+        const FVector DeckTarget(CellSize * 0.5f, CellSize * 0.5f, DeckZ);
+        TArray<FGSDFlowFieldDemand> Demands;
+        Demands.Add({ 1, GroundTarget, MinPursuers });
+
+        // Test 1: A new field fills over several frames within the projection budget
+        uint32 Generation = 0;
+        for (int32 Frame = 1; Frame < FramesToFill; ++Frame)
+        {
+            FlowFields->UpdateFields(Demands, 0.016f);
+            TestEqual(FString::Printf(TEXT("Frame %d: field waits for its walkability"), Frame), FlowFields->FindFieldForTarget(1, Generation), INDEX_NONE);
+        }
+        FlowFields->UpdateFields(Demands, 0.016f);
+        const int32 GroundField = FlowFields->FindFieldForTarget(1, Generation);
+        TestNotEqual(TEXT("Field built once filled"), GroundField, INDEX_NONE);
+        TestEqual(TEXT("Every cell projected once"), FlowFields->GetTotalProjections(), static_cast<int64>(NumCells));
+        TestTrue(TEXT("Batches stay within the per-frame budget"), LargestBatch <= MaxProjections);
+
+        // Test 2: The same cells at another height are projected separately, not served from the ground cache
+        Demands.Add({ 2, DeckTarget, MinPursuers });
+        for (int32 Frame = 0; Frame < FramesToFill; ++Frame)
+        {
+            FlowFields->UpdateFields(Demands, 0.016f);
+        }
+        const int32 DeckField = FlowFields->FindFieldForTarget(2, Generation);
+        if (!TestNotEqual(TEXT("Deck field built"), DeckField, INDEX_NONE) || GroundField == INDEX_NONE)
+        {
+            TestWorld->DestroyWorld(false);
+            return false;
+        }
+        TestEqual(TEXT("Deck cells projected at their own height"), FlowFields->GetTotalProjections(), static_cast<int64>(NumCells) * 2);
+
+        const FVector EastProbe(CellSize * 5.5f, CellSize * 0.5f, 0.0f);
+        const FVector WestProbe(CellSize * -3.5f, CellSize * 0.5f, 0.0f);
+        TestFalse(TEXT("Ground is walkable east of the target"), FlowFields->SampleDirection(GroundField, EastProbe).IsZero());
+        TestTrue(TEXT("Deck is blocked east of the target"), FlowFields->SampleDirection(DeckField, EastProbe).IsZero());
+        TestFalse(TEXT("Deck is walkable west of the target"), FlowFields->SampleDirection(DeckField, WestProbe).IsZero());
+
+        // Test 3: Invalidating the NavMesh under a new wall re-projects only those cells and rebuilds the field
+        bWallBuilt = true;
+        const int64 ProjectionsBefore = FlowFields->GetTotalProjections();
+        FlowFields->InvalidateWalkability(FBox(
+            FVector(WallMinX, -CellSize * Dimension, -CellSize),
+            FVector(WallMinX + CellSize * 0.5f, CellSize * Dimension, CellSize)));
+        TestFalse(TEXT("Last build keeps steering until the refill is built"), FlowFields->SampleDirection(GroundField, EastProbe).IsZero());
+
+        for (int32 Frame = 0; Frame < FMath::DivideAndRoundUp(Dimension, MaxProjections); ++Frame)
+        {
+            FlowFields->UpdateFields(Demands, 0.016f);
+        }
+        TestEqual(TEXT("Only the wall column is re-projected"), FlowFields->GetTotalProjections() - ProjectionsBefore, static_cast<int64>(Dimension));
+        TestTrue(TEXT("Rebuilt field is cut off by the wall"), FlowFields->SampleDirection(GroundField, EastProbe).IsZero());
+        TestFalse(TEXT("Deck field untouched"), FlowFields->SampleDirection(DeckField, WestProbe).IsZero());
+
+        // Test 4: Drift within the goal tolerance retargets in place; further drift rebuilds
+        if (GoalTolerance > 0)
+        {
+            const int64 RebuildsBefore = FlowFields->GetTotalRebuilds();
+            Demands[0].Location = GroundTarget + FVector(0.0f, CellSize * GoalTolerance, 0.0f);
+            FlowFields->UpdateFields(Demands, 0.016f);
+            TestEqual(TEXT("Drift within tolerance does not rebuild"), FlowFields->GetTotalRebuilds(), RebuildsBefore);
+            TestTrue(TEXT("Built goal cell steers straight at the drifted target"),
+                FlowFields->SampleDirection(GroundField, GroundTarget).Equals(FVector(0.0f, 1.0f, 0.0f), KINDA_SMALL_NUMBER));
+
+            Demands[0].Location = GroundTarget + FVector(0.0f, CellSize * (GoalTolerance + 1), 0.0f);
+            FlowFields->UpdateFields(Demands, 0.016f);
+            TestEqual(TEXT("Drift beyond tolerance rebuilds"), FlowFields->GetTotalRebuilds(), RebuildsBefore + 1);
+        }
+    }
+
+    TestWorld->DestroyWorld(false);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
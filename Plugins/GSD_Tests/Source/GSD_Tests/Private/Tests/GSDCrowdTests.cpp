@@ -3,14 +3,64 @@
 #include "GSD_Tests.h"
 #include "Misc/AutomationTest.h"
 #include "Fragments/GSDZombieStateFragment.h"
+#include "Fragments/GSDZombieMovementFragment.h"
 #include "Fragments/GSDNavigationFragment.h"
 #include "Fragments/GSDSmartObjectFragment.h"
 #include "Processors/GSDCrowdLODProcessor.h"
+#include "Processors/GSDZombieBehaviorProcessor.h"
+#include "Processors/GSDSeparationProcessor.h"
+#include "Fragments/GSDBehaviorLODTags.h"
+#include "DataAssets/GSDCrowdConfig.h"
 #include "Subsystems/GSDCrowdManagerSubsystem.h"
 #include "DataAssets/GSDCrowdEntityConfig.h"
+#include "Spatial/GSDSpatialHash.h"
+#include "Spatial/GSDFlowField.h"
+#include "GSDCrowdManagerTestAccess.h"
+#include "MassEntityManager.h"
+#include "MassExecutionContext.h"
+#include "MassCommonFragments.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
+/**
+ * Automation test access to UGSDZombieBehaviorProcessor internals.
+ * Runs target acquisition against a hand-built candidate hash without a Mass pipeline.
+ */
+struct FGSDZombieBehaviorProcessorTestAccess
+{
+    explicit FGSDZombieBehaviorProcessorTestAccess(UGSDZombieBehaviorProcessor& InProcessor)
+        : Processor(InProcessor)
+    {
+    }
+
+    /** Player pawn locations, indexed by player target ID (GatherPlayerTargets does this from the world). */
+    void SetPlayerTargetLocations(const TArray<FVector>& Locations)
+    {
+        Processor.PlayerTargetLocations.Reset();
+        Processor.PlayerTargetLocations.Append(Locations);
+    }
+
+    bool AcquireTarget(const UGSDSpatialHash& SearchHash, const FVector& Location, float DetectionRange, FGSDZombieMovementFragment& State) const
+    {
+        return Processor.AcquireTarget(SearchHash, Location, DetectionRange, State);
+    }
+
+    /** Use Config instead of the default config asset. */
+    void SetConfig(UGSDCrowdConfig* Config) { Processor.CachedConfig = Config; }
+
+    void ConfigureQueries() { Processor.ConfigureQueries(); }
+
+    /** Run one processor frame over every entity in EntityManager (ConfigureQueries must have run). */
+    void Execute(FMassEntityManager& EntityManager, float DeltaTime)
+    {
+        FMassExecutionContext Context(EntityManager, DeltaTime);
+        Processor.Execute(EntityManager, Context);
+    }
+
+private:
+    UGSDZombieBehaviorProcessor& Processor;
+};
+
 // Test 1: Entity Spawning - Basic crowd entity spawn test
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdEntitySpawnTest,
     "GSD.Crowds.EntitySpawning.Basic",
@@ -56,22 +106,25 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdStateFragmentTest,
 
 bool FGSDCrowdStateFragmentTest::RunTest(const FString& Parameters)
 {
-    // Test FGSDZombieStateFragment default values
+    // Test FGSDZombieStateFragment (cold) and FGSDZombieMovementFragment (hot) default values
     FGSDZombieStateFragment StateFragment;
+    FGSDZombieMovementFragment MovementFragment;
 
     // Verify default state values
     TestEqual(TEXT("Default health is 100.0"), StateFragment.Health, 100.0f);
-    TestEqual(TEXT("Default movement speed is 150.0"), StateFragment.MovementSpeed, 150.0f);
-    TestEqual(TEXT("Default target movement speed is 150.0"), StateFragment.TargetMovementSpeed, 150.0f);
+    TestEqual(TEXT("Default movement speed is 150.0"), MovementFragment.MovementSpeed, 150.0f);
+    TestEqual(TEXT("Default target movement speed is 150.0"), MovementFragment.TargetMovementSpeed, 150.0f);
 
     // Verify default flags
-    TestFalse(TEXT("Not aggressive by default"), StateFragment.bIsAggressive);
-    TestTrue(TEXT("Alive by default"), StateFragment.bIsAlive);
-    TestTrue(TEXT("Active by default"), StateFragment.bIsActive);
+    TestFalse(TEXT("Not aggressive by default"), static_cast<bool>(MovementFragment.bIsAggressive));
+    TestTrue(TEXT("Alive by default"), static_cast<bool>(MovementFragment.bIsAlive));
+    TestTrue(TEXT("Active by default"), static_cast<bool>(MovementFragment.bIsActive));
 
     // Verify behavior defaults
-    TestEqual(TEXT("Default wander direction is 0.0"), StateFragment.WanderDirection, 0.0f);
-    TestEqual(TEXT("Default time since last behavior update is 0.0"), StateFragment.TimeSinceLastBehaviorUpdate, 0.0f);
+    TestEqual(TEXT("Default wander direction is 0.0"), MovementFragment.WanderDirection, 0.0f);
+    TestEqual(TEXT("Default time since last behavior update is 0.0"), MovementFragment.TimeSinceLastBehaviorUpdate, 0.0f);
+    TestFalse(TEXT("No target by default"), MovementFragment.HasTarget());
+    TestFalse(TEXT("No target search granted by default"), static_cast<bool>(MovementFragment.bTargetSearchGranted));
 
     // Test speed randomization (20% variation per VelocityRandomRange = 0.2)
     // The variation should be within 20% of base speed (150 * 0.2 = 30)
@@ -130,6 +183,8 @@ bool FGSDCrowdNavigationFragmentTest::RunTest(const FString& Parameters)
     TestFalse(TEXT("Not on lane by default"), NavFragment.bIsOnLane);
     TestFalse(TEXT("Not reached destination by default"), NavFragment.bReachedDestination);
     TestEqual(TEXT("Default lane position is 0.0"), NavFragment.LanePosition, 0.0f);
+    TestFalse(TEXT("No cached lane by default"), NavFragment.CachedLaneHandle.IsValid());
+    TestEqual(TEXT("Default cached lane length is 0.0"), NavFragment.CachedLaneLength, 0.0f);
 
     // Verify movement config
     TestEqual(TEXT("Default desired speed is 150.0"), NavFragment.DesiredSpeed, 150.0f);
@@ -201,4 +256,720 @@ bool FGSDCrowdEntityConfigTest::RunTest(const FString& Parameters)
     return true;
 }
 
+// Test 8: Spatial Hash - CSR rebuild, exact filtering and buffer reuse
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdSpatialHashTest,
+    "GSD.Crowds.Spatial.HashQueries",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdSpatialHashTest::RunTest(const FString& Parameters)
+{
+    UGSDSpatialHash* Hash = NewObject<UGSDSpatialHash>();
+    FGSDSpatialHashConfig Config;
+    Config.CellSize = 100.0f;
+    Hash->Initialize(Config);
+
+    const FMassEntityHandle Near(1, 1);
+    const FMassEntityHandle Corner(2, 1);   // Same cell range as Near, outside the sphere
+    const FMassEntityHandle Far(3, 1);
+
+    Hash->Insert(Near, FVector(50.0f, 0.0f, 0.0f));
+    Hash->Insert(Corner, FVector(90.0f, 90.0f, 0.0f));
+    Hash->Insert(Far, FVector(1000.0f, 1000.0f, 0.0f));
+
+    // Queries read the last Rebuild
+    TArray<FMassEntityHandle> Results;
+    TestTrue(TEXT("Hash needs rebuild after insert"), Hash->NeedsRebuild());
+    TestEqual(TEXT("No results before rebuild"), Hash->QueryRadius(FVector::ZeroVector, 100.0f, Results), 0);
+
+    Hash->Rebuild();
+    TestFalse(TEXT("Rebuild clears dirty flag"), Hash->NeedsRebuild());
+    TestEqual(TEXT("Three entities staged"), Hash->GetTotalEntityCount(), 3);
+    TestEqual(TEXT("Two occupied cells"), Hash->GetOccupiedCellCount(), 2);
+
+    // Radius filtering is exact, not per-cell
+    TestEqual(TEXT("Radius query finds only the near entity"), Hash->QueryRadius(FVector::ZeroVector, 100.0f, Results), 1);
+    TestTrue(TEXT("Near entity returned"), Results.Num() == 1 && Results[0] == Near);
+
+    // Box query uses exact bounds
+    Results.Reset();
+    TestEqual(TEXT("Box query finds near and corner"), Hash->QueryBox(FVector(0.0f, -10.0f, -10.0f), FVector(100.0f, 100.0f, 10.0f), Results), 2);
+
+    // Output buffer is reused without reallocation
+    const int32 CapacityBefore = Results.Max();
+    Results.Reset();
+    Hash->QueryRadius(FVector::ZeroVector, 200.0f, Results);
+    TestEqual(TEXT("Reused buffer keeps its capacity"), Results.Max(), CapacityBefore);
+
+    // Move and remove
+    Hash->UpdatePosition(Far, FVector(10.0f, 10.0f, 0.0f));
+    Hash->Remove(Near);
+    Hash->Rebuild();
+
+    Results.Reset();
+    Hash->QueryRadius(FVector::ZeroVector, 100.0f, Results);
+    TestEqual(TEXT("Moved entity found after rebuild"), Results.Num(), 1);
+    TestTrue(TEXT("Removed entity not returned"), !Results.Contains(Near) && Results.Contains(Far));
+    TestEqual(TEXT("Two entities remain"), Hash->GetTotalEntityCount(), 2);
+
+    // Visitor reports distances
+    int32 Visited = 0;
+    Hash->ForEachEntityInRadius(FVector::ZeroVector, 200.0f,
+        [&Visited](const FMassEntityHandle& Entity, const FVector& Position, float DistanceSq)
+        {
+            Visited++;
+        });
+    TestEqual(TEXT("Visitor sees both remaining entities"), Visited, 2);
+
+    return true;
+}
+
+// Test 9: Target Acquisition Data - Target handles and bulk candidate hash
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdTargetAcquisitionTest,
+    "GSD.Crowds.Pursuit.TargetAcquisition",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdTargetAcquisitionTest::RunTest(const FString& Parameters)
+{
+    // Player targets never collide with entity targets or the invalid handle
+    const FGSDCrowdTargetHandle PlayerTarget = FGSDCrowdTargetHandle::MakePlayer(0);
+    const FGSDCrowdTargetHandle EntityTarget = FGSDCrowdTargetHandle::MakeEntity(FMassEntityHandle(0, 1));
+    TestTrue(TEXT("Player handle is a player target"), PlayerTarget.IsPlayer());
+    TestFalse(TEXT("Invalid handle is not a player target"), FGSDCrowdTargetHandle().IsPlayer());
+    TestFalse(TEXT("Entity handle is not a player target"), EntityTarget.IsPlayer());
+    TestTrue(TEXT("Player and entity handles differ"), PlayerTarget != EntityTarget);
+    TestEqual(TEXT("Player index round-trips"), FGSDCrowdTargetHandle::MakePlayer(3).GetPlayerIndex(), 3);
+    TestEqual(TEXT("Invalid handle ID is INDEX_NONE"), FGSDCrowdTargetHandle().GetID(), static_cast<int32>(INDEX_NONE));
+
+    // Entity handles keep serial bits so a recycled index is detected
+    const FGSDCrowdTargetHandle EntityHandle = FGSDCrowdTargetHandle::MakeEntity(FMassEntityHandle(42, 5));
+    TestEqual(TEXT("Entity index round-trips"), EntityHandle.GetEntityIndex(), 42);
+    TestTrue(TEXT("Handle matches its entity"), EntityHandle.MatchesEntity(FMassEntityHandle(42, 5)));
+    TestFalse(TEXT("Handle rejects a recycled index"), EntityHandle.MatchesEntity(FMassEntityHandle(42, 6)));
+    TestEqual(TEXT("Target handle is 4 bytes"), static_cast<int32>(sizeof(FGSDCrowdTargetHandle)), 4);
+
+    // Candidate targets are bulk-built from gathered arrays
+    UGSDSpatialHash* TargetHash = NewObject<UGSDSpatialHash>();
+    FGSDSpatialHashConfig Config;
+    Config.CellSize = 1000.0f;
+    TargetHash->Initialize(Config);
+
+    const TArray<FMassEntityHandle> Candidates = { FMassEntityHandle(10, 1), FMassEntityHandle(11, 1), FMassEntityHandle(12, 1), FMassEntityHandle(9, 1) };
+    const TArray<FVector> Positions = { FVector(300.0f, 0.0f, 0.0f), FVector(800.0f, 0.0f, 0.0f), FVector(5000.0f, 0.0f, 0.0f), FVector(0.0f, 300.0f, 0.0f) };
+    TargetHash->RebuildFromEntities(Candidates, Positions);
+
+    TestTrue(TEXT("Bulk build flagged"), TargetHash->GetLastBuildStats().bBulkBuild);
+    TestEqual(TEXT("All candidates staged"), TargetHash->GetTotalEntityCount(), 4);
+
+    // The processor's search: nearest within detection range, equal distances go to the lower entity index
+    UGSDZombieBehaviorProcessor* Processor = NewObject<UGSDZombieBehaviorProcessor>();
+    FGSDZombieBehaviorProcessorTestAccess Access(*Processor);
+    {
+        FGSDZombieMovementFragment State;
+        TestTrue(TEXT("Target acquired in range"), Access.AcquireTarget(*TargetHash, FVector::ZeroVector, 1000.0f, State));
+        TestTrue(TEXT("Nearest candidate selected, tie broken on entity index"),
+            State.Target == FGSDCrowdTargetHandle::MakeEntity(FMassEntityHandle(9, 1)));
+        TestTrue(TEXT("Target location written"), FVector(State.TargetLocation).Equals(FVector(0.0f, 300.0f, 0.0f)));
+    }
+
+    // Nothing within range leaves the state untouched
+    {
+        FGSDZombieMovementFragment State;
+        TestFalse(TEXT("No target beyond detection range"), Access.AcquireTarget(*TargetHash, FVector(0.0f, 0.0f, 20000.0f), 1000.0f, State));
+        TestFalse(TEXT("State has no target"), State.HasTarget());
+    }
+
+    // A closer player wins over entities
+    {
+        Access.SetPlayerTargetLocations({ FVector(5000.0f, 5000.0f, 0.0f), FVector(-100.0f, 0.0f, 0.0f) });
+        FGSDZombieMovementFragment State;
+        TestTrue(TEXT("Player target acquired"), Access.AcquireTarget(*TargetHash, FVector::ZeroVector, 1000.0f, State));
+        TestTrue(TEXT("Nearest player selected"), State.Target == FGSDCrowdTargetHandle::MakePlayer(1));
+        TestTrue(TEXT("Player target is a player handle"), State.Target.IsPlayer());
+    }
+
+    return true;
+}
+
+// Test 10: Behavior LOD Buckets - LOD significance to update bucket mapping
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdBehaviorLODBucketTest,
+    "GSD.Crowds.LOD.BehaviorBuckets",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdBehaviorLODBucketTest::RunTest(const FString& Parameters)
+{
+    UGSDCrowdLODProcessor* LODProcessor = NewObject<UGSDCrowdLODProcessor>();
+
+    // Buckets follow the LOD processor's significance bands
+    TestEqual(TEXT("High actor is bucket 0"), GSDBehaviorLOD::GetBucketForSignificance(LODProcessor->CalculateLODSignificance(100.0f)), 0);
+    TestEqual(TEXT("Low actor is bucket 0"), GSDBehaviorLOD::GetBucketForSignificance(LODProcessor->CalculateLODSignificance(3000.0f)), 0);
+    TestEqual(TEXT("ISM is bucket 1"), GSDBehaviorLOD::GetBucketForSignificance(LODProcessor->CalculateLODSignificance(7000.0f)), 1);
+    TestEqual(TEXT("Culled is bucket 2"), GSDBehaviorLOD::GetBucketForSignificance(LODProcessor->CalculateLODSignificance(15000.0f)), 2);
+    TestEqual(TEXT("Far culled is bucket 3"), GSDBehaviorLOD::GetBucketForSignificance(LODProcessor->CalculateLODSignificance(50000.0f)), 3);
+    TestEqual(TEXT("Out of range significance clamps"), GSDBehaviorLOD::GetBucketForSignificance(10.0f), GSDBehaviorLOD::NumBuckets - 1);
+
+    // Far buckets update less often by default
+    const UGSDCrowdConfig* Config = GetDefault<UGSDCrowdConfig>();
+    TestTrue(TEXT("Buckets enabled by default"), Config->bEnableBehaviorLODBuckets);
+    TestTrue(TEXT("LOD2 updates less often than LOD1"), Config->BehaviorLOD2FrameInterval > Config->BehaviorLOD1FrameInterval);
+    TestTrue(TEXT("LOD3 updates less often than LOD2"), Config->BehaviorLOD3FrameInterval > Config->BehaviorLOD2FrameInterval);
+
+    // Elapsed time is per entity, so it is the same whichever bucket the entity ran in last
+    const float Wrap = UGSDZombieBehaviorProcessor::BehaviorClockWrapSeconds;
+    TestEqual(TEXT("Never-updated entity advances one frame"),
+        UGSDZombieBehaviorProcessor::GetElapsedBehaviorTime(-1.0f, 10.0f, 0.016f), 0.016f);
+    TestEqual(TEXT("Elapsed since last update"),
+        UGSDZombieBehaviorProcessor::GetElapsedBehaviorTime(10.0f, 10.25f, 0.016f), 0.25f);
+    TestTrue(TEXT("Elapsed across the clock wrap"),
+        FMath::IsNearlyEqual(UGSDZombieBehaviorProcessor::GetElapsedBehaviorTime(Wrap - 0.1f, 0.15f, 0.016f), 0.25f, 1.0e-3f));
+    TestTrue(TEXT("Fresh fragment has no behavior timestamp"), FGSDZombieMovementFragment().LastBehaviorTime < 0.0f);
+
+    return true;
+}
+
+// Test 11: Batched LOD Significance - SIMD kernel matches scalar path, nearest viewer wins
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdLODBatchSignificanceTest,
+    "GSD.Crowds.LOD.BatchSignificance",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdLODBatchSignificanceTest::RunTest(const FString& Parameters)
+{
+    UGSDCrowdLODProcessor* LODProcessor = NewObject<UGSDCrowdLODProcessor>();
+    const FGSDLODSquaredThresholds Thresholds = LODProcessor->GetSquaredLODThresholds();
+
+    // 7 entities exercises both the 4-wide SIMD loop and the scalar tail
+    const TArray<FVector> Positions = {
+        FVector(100.0f, 0.0f, 0.0f),
+        FVector(3000.0f, 0.0f, 0.0f),
+        FVector(7000.0f, 0.0f, 0.0f),
+        FVector(15000.0f, 0.0f, 0.0f),
+        FVector(50000.0f, 0.0f, 0.0f),
+        FVector(0.0f, 4000.0f, 0.0f),
+        FVector(60000.0f, 0.0f, 0.0f)
+    };
+
+    // Single viewer matches the scalar distance path
+    const TArray<FVector> SingleViewer = { FVector::ZeroVector };
+    TArray<float> Significance;
+    Significance.SetNumUninitialized(Positions.Num());
+    UGSDCrowdLODProcessor::CalculateLODSignificanceBatch(Positions, SingleViewer, Thresholds, Significance);
+
+    for (int32 i = 0; i < Positions.Num(); i++)
+    {
+        const float Expected = LODProcessor->CalculateLODSignificance(Positions[i].Size());
+        TestEqual(FString::Printf(TEXT("Entity %d matches scalar significance"), i), Significance[i], Expected);
+    }
+
+    // Second viewer near the far entities pulls them to full detail
+    const TArray<FVector> TwoViewers = { FVector::ZeroVector, FVector(51000.0f, 0.0f, 0.0f) };
+    UGSDCrowdLODProcessor::CalculateLODSignificanceBatch(Positions, TwoViewers, Thresholds, Significance);
+    TestEqual(TEXT("Near entity still full detail"), Significance[0], 0.0f);
+    TestEqual(TEXT("Far entity uses nearest viewer"), Significance[4], 0.0f);
+    TestEqual(TEXT("Tail entity uses nearest viewer"), Significance[6], 1.75f);
+
+    return true;
+}
+
+// Test 12: Async Spawn Transforms - Worker-safe generation is seeded and stays in the spawn area
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdAsyncSpawnTransformsTest,
+    "GSD.Crowds.Spawning.AsyncTransforms",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdAsyncSpawnTransformsTest::RunTest(const FString& Parameters)
+{
+    const FVector Center(1000.0f, -2000.0f, 50.0f);
+    const float Radius = 500.0f;
+    constexpr int32 Count = 64;
+
+    FRandomStream StreamA(1234);
+    FRandomStream StreamB(1234);
+    TArray<FTransform> TransformsA;
+    TArray<FTransform> TransformsB;
+    UGSDCrowdManagerSubsystem::GenerateSpawnTransformsFromStream(Count, Center, Radius, StreamA, TransformsA);
+    UGSDCrowdManagerSubsystem::GenerateSpawnTransformsFromStream(Count, Center, Radius, StreamB, TransformsB);
+
+    TestEqual(TEXT("Requested count generated"), TransformsA.Num(), Count);
+
+    bool bAllInArea = true;
+    bool bAllMatch = true;
+    for (int32 i = 0; i < TransformsA.Num(); i++)
+    {
+        const FVector Location = TransformsA[i].GetLocation();
+        bAllInArea &= FVector::Dist2D(Location, Center) <= Radius + KINDA_SMALL_NUMBER;
+        bAllInArea &= FMath::IsNearlyEqual(Location.Z, Center.Z);
+        bAllMatch &= TransformsA[i].Equals(TransformsB[i]);
+    }
+    TestTrue(TEXT("All transforms inside spawn radius"), bAllInArea);
+    TestTrue(TEXT("Same seed produces same transforms"), bAllMatch);
+
+    // Output buffer is reset, not appended to
+    UGSDCrowdManagerSubsystem::GenerateSpawnTransformsFromStream(8, Center, Radius, StreamA, TransformsA);
+    TestEqual(TEXT("Output buffer reset on reuse"), TransformsA.Num(), 8);
+
+    return true;
+}
+
+// Test 13: Density Modifier Index - Grid lookup and batch API match brute force
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdDensityModifierIndexTest,
+    "GSD.Crowds.Manager.DensityModifierIndex",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdDensityModifierIndexTest::RunTest(const FString& Parameters)
+{
+    UGSDCrowdManagerSubsystem* CrowdManager = NewObject<UGSDCrowdManagerSubsystem>();
+    CrowdManager->AddToRoot();  // Prevent GC
+
+    const FGameplayTag BlockPartyTag = FGameplayTag::RequestGameplayTag(FName("Event.Daily.BlockParty"), false);
+    const FGameplayTag ConstructionTag = FGameplayTag::RequestGameplayTag(FName("Event.Daily.Construction"), false);
+    const FGameplayTag BonfireTag = FGameplayTag::RequestGameplayTag(FName("Event.Daily.Bonfire"), false);
+    if (!BlockPartyTag.IsValid() || !ConstructionTag.IsValid() || !BonfireTag.IsValid())
+    {
+        AddWarning(TEXT("Daily event gameplay tags not registered, skipping density index test"));
+        CrowdManager->RemoveFromRoot();
+        return true;
+    }
+
+    // Overlapping modifiers straddling grid cell borders, plus one far away
+    CrowdManager->AddDensityModifier(BlockPartyTag, FVector(4900.0f, 0.0f, 0.0f), 1000.0f, 2.0f);
+    CrowdManager->AddDensityModifier(ConstructionTag, FVector(5200.0f, 300.0f, 0.0f), 800.0f, 0.5f);
+    CrowdManager->AddDensityModifier(BonfireTag, FVector(-90000.0f, 40000.0f, 0.0f), 3000.0f, 3.0f);
+
+    TestEqual(TEXT("Outside all modifiers"), CrowdManager->GetDensityMultiplierAtLocation(FVector(20000.0f, 0.0f, 0.0f)), 1.0f);
+    TestEqual(TEXT("Block party only"), CrowdManager->GetDensityMultiplierAtLocation(FVector(4100.0f, 0.0f, 0.0f)), 2.0f);
+    TestEqual(TEXT("Overlap across cell border"), CrowdManager->GetDensityMultiplierAtLocation(FVector(5050.0f, 100.0f, 0.0f)), 1.0f);
+    TestEqual(TEXT("Far modifier"), CrowdManager->GetDensityMultiplierAtLocation(FVector(-90000.0f, 41000.0f, 0.0f)), 3.0f);
+
+    // Batch results match single queries, including cache hits on repeated cells
+    TArray<FVector> Locations;
+    for (int32 i = 0; i < 200; i++)
+    {
+        Locations.Add(FVector(3500.0f + i * 15.0f, (i % 7) * 100.0f, 0.0f));
+    }
+    TArray<float> Multipliers;
+    Multipliers.SetNumUninitialized(Locations.Num());
+    CrowdManager->GetDensityMultipliersAtLocations(Locations, Multipliers);
+
+    bool bBatchMatches = true;
+    for (int32 i = 0; i < Locations.Num(); i++)
+    {
+        bBatchMatches &= Multipliers[i] == CrowdManager->GetDensityMultiplierAtLocation(Locations[i]);
+    }
+    TestTrue(TEXT("Batch matches single queries"), bBatchMatches);
+
+    // Removing a modifier updates the index
+    CrowdManager->RemoveDensityModifier(BlockPartyTag);
+    TestEqual(TEXT("Removed modifier no longer applies"), CrowdManager->GetDensityMultiplierAtLocation(FVector(4100.0f, 0.0f, 0.0f)), 1.0f);
+    TestEqual(TEXT("Remaining modifier still applies"), CrowdManager->GetDensityMultiplierAtLocation(FVector(5050.0f, 100.0f, 0.0f)), 0.5f);
+
+    CrowdManager->RemoveFromRoot();
+    return true;
+}
+
+// Test 14: Flow Field - Directions descend to the goal around walls, blocked/outside cells sample zero
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdFlowFieldTest,
+    "GSD.Crowds.Navigation.FlowField",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdFlowFieldTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 Dimension = 16;
+    constexpr float CellSize = 100.0f;
+
+    FGSDFlowField Field;
+    Field.Initialize(FVector::ZeroVector, CellSize, Dimension);
+
+    // Wall at X = 8 with a gap at the top (Y >= 13)
+    for (int32 Y = 0; Y < 13; Y++)
+    {
+        Field.SetWalkable(Field.GetCellIndex(8, Y), false);
+    }
+
+    // Enclosed cell at (1, 14)
+    for (int32 DY = -1; DY <= 1; DY++)
+    {
+        for (int32 DX = -1; DX <= 1; DX++)
+        {
+            if (DX != 0 || DY != 0)
+            {
+                Field.SetWalkable(Field.GetCellIndex(1 + DX, 14 + DY), false);
+            }
+        }
+    }
+
+    const FVector GoalLocation = Field.GetCellCenter(FIntPoint(12, 4));
+    TestTrue(TEXT("Build succeeds"), Field.Build(GoalLocation));
+    TestTrue(TEXT("Goal cell"), Field.GetGoalCell() == FIntPoint(12, 4));
+
+    // Straight line is blocked - the path detours through the gap
+    const FIntPoint Start(4, 4);
+    TestTrue(TEXT("Detour costs more than the straight line"), Field.GetIntegrationCost(Start) > 8.0f);
+    TestTrue(TEXT("Start heads toward the gap"), Field.SampleDirection(Field.GetCellCenter(Start)).Y > 0.0f);
+
+    // Following the field reaches the goal without entering blocked cells
+    FIntPoint Cell = Start;
+    bool bStayedWalkable = true;
+    for (int32 Step = 0; Step < Dimension * Dimension && Cell != Field.GetGoalCell(); Step++)
+    {
+        const FVector Direction = Field.SampleDirection(Field.GetCellCenter(Cell));
+        if (Direction.IsNearlyZero())
+        {
+            break;
+        }
+        Cell += FIntPoint(FMath::RoundToInt(Direction.X), FMath::RoundToInt(Direction.Y));
+        bStayedWalkable &= Field.IsWalkable(Field.GetCellIndex(Cell.X, Cell.Y));
+    }
+    TestTrue(TEXT("Field leads to the goal cell"), Cell == Field.GetGoalCell());
+    TestTrue(TEXT("Path stays on walkable cells"), bStayedWalkable);
+
+    // Inside the goal cell the sample points at the goal itself
+    const FVector NearGoal = GoalLocation + FVector(-30.0f, 0.0f, 0.0f);
+    TestTrue(TEXT("Goal cell points at goal"), Field.SampleDirection(NearGoal).Equals(FVector(1.0f, 0.0f, 0.0f), KINDA_SMALL_NUMBER));
+
+    // No path or outside the grid
+    TestTrue(TEXT("Enclosed cell unreachable"), Field.GetIntegrationCost(FIntPoint(1, 14)) == FGSDFlowField::UnreachableCost);
+    TestTrue(TEXT("Enclosed cell samples zero"), Field.SampleDirection(Field.GetCellCenter(FIntPoint(1, 14))).IsZero());
+    TestTrue(TEXT("Outside grid samples zero"), Field.SampleDirection(FVector(-50.0f, 50.0f, 0.0f)).IsZero());
+
+    // Moving the goal rebuilds in place (walkability kept)
+    TestTrue(TEXT("Rebuild succeeds"), Field.Build(Field.GetCellCenter(FIntPoint(2, 2))));
+    TestTrue(TEXT("Wall still blocked after rebuild"), !Field.IsWalkable(Field.GetCellIndex(8, 0)));
+    TestTrue(TEXT("Goal outside grid fails"), !Field.Build(FVector(5000.0f, 0.0f, 0.0f)));
+
+    return true;
+}
+
+// Test 15: Separation - SIMD kernel matches scalar reference, neighbor gathers are bounded
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdSeparationTest,
+    "GSD.Crowds.Navigation.Separation",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdSeparationTest::RunTest(const FString& Parameters)
+{
+    constexpr float Radius = 100.0f;
+    const FVector Location(1000.0f, 2000.0f, 50.0f);
+
+    // Mix of in-range, out-of-range and coincident neighbors (SIMD body + scalar tail)
+    const TArray<FVector2f> Offsets = {
+        FVector2f(30.0f, 0.0f), FVector2f(-10.0f, 45.0f), FVector2f(150.0f, 0.0f), FVector2f(0.0f, -60.0f),
+        FVector2f(0.0f, 0.0f), FVector2f(70.0f, 70.0f), FVector2f(-20.0f, -5.0f)
+    };
+
+    TArray<float> NeighborX;
+    TArray<float> NeighborY;
+    FVector Expected = FVector::ZeroVector;
+    for (const FVector2f& Offset : Offsets)
+    {
+        NeighborX.Add(static_cast<float>(Location.X) + Offset.X);
+        NeighborY.Add(static_cast<float>(Location.Y) + Offset.Y);
+
+        const float Dist = Offset.Size();
+        if (Dist > 0.0f && Dist < Radius)
+        {
+            // Away from the neighbor, 1 at full overlap falling to 0 at Radius
+            Expected -= FVector(Offset.X, Offset.Y, 0.0f) / Dist * (1.0f - Dist / Radius);
+        }
+    }
+
+    const FVector Push = UGSDSeparationProcessor::ComputeSeparation(Location, NeighborX, NeighborY, Radius);
+    TestTrue(TEXT("Kernel matches scalar reference"), Push.Equals(Expected, 1.0e-3f));
+    TestEqual(TEXT("Push stays in the ground plane"), Push.Z, 0.0);
+
+    // Symmetric neighbors cancel; no neighbors push nothing
+    const TArray<float> SymmetricX = { static_cast<float>(Location.X) - 40.0f, static_cast<float>(Location.X) + 40.0f };
+    const TArray<float> SymmetricY = { static_cast<float>(Location.Y), static_cast<float>(Location.Y) };
+    TestTrue(TEXT("Symmetric neighbors cancel"), UGSDSeparationProcessor::ComputeSeparation(Location, SymmetricX, SymmetricY, Radius).IsNearlyZero(1.0e-3f));
+    TestTrue(TEXT("No neighbors, no push"), UGSDSeparationProcessor::ComputeSeparation(Location, TArray<float>(), TArray<float>(), Radius).IsZero());
+
+    // Bounded gather stops at the visit budget in a dense cell
+    UGSDSpatialHash* Hash = NewObject<UGSDSpatialHash>();
+    FGSDSpatialHashConfig Config;
+    Config.CellSize = Radius;
+    Config.MaxCellSearchRadius = 1;
+    Hash->Initialize(Config);
+
+    for (int32 i = 0; i < 50; i++)
+    {
+        Hash->Insert(FMassEntityHandle(i + 1, 1), FVector(10.0f + (i % 5) * 10.0f, 10.0f + (i / 5) * 5.0f, 0.0f));
+    }
+    Hash->Rebuild();
+
+    int32 Visited = 0;
+    const int32 Returned = Hash->ForEachEntityInRadiusBounded(FVector(30.0f, 30.0f, 0.0f), Radius, 9,
+        [&Visited](const FMassEntityHandle& Entity, const FVector& Position, float DistanceSq)
+        {
+            Visited++;
+        });
+    TestEqual(TEXT("Bounded gather stops at budget"), Visited, 9);
+    TestEqual(TEXT("Bounded gather returns visit count"), Returned, 9);
+
+    Visited = 0;
+    Hash->ForEachEntityInRadiusBounded(FVector(30.0f, 30.0f, 0.0f), Radius, 1000,
+        [&Visited](const FMassEntityHandle& Entity, const FVector& Position, float DistanceSq)
+        {
+            Visited++;
+        });
+    TestEqual(TEXT("Bounded gather under budget visits all in range"), Visited, 50);
+
+    return true;
+}
+
+// Test 16: Async Spawn Queue - Batching, completion/cancel delivery, listeners that queue mid-broadcast
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdAsyncSpawnQueueTest,
+    "GSD.Crowds.Spawning.AsyncQueue",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdAsyncSpawnQueueTest::RunTest(const FString& Parameters)
+{
+    UWorld* TestWorld = NewObject<UWorld>();
+    TestWorld->SetWorldType(EWorldType::Game);
+
+    UGSDCrowdManagerSubsystem* CrowdManager = NewObject<UGSDCrowdManagerSubsystem>(TestWorld);
+    CrowdManager->AddToRoot();
+    UGSDCrowdEntityConfig* EntityConfig = NewObject<UGSDCrowdEntityConfig>();
+    EntityConfig->AddToRoot();
+
+    {
+        FGSDCrowdManagerTestAccess TestAccess(*CrowdManager);
+        const int32 BatchSize = FGSDCrowdManagerTestAccess::GetBatchSize();
+        const int32 Count = BatchSize * 2 + 3;
+        const FVector Center(1000.0f, 1000.0f, 0.0f);
+        int32 ExpectedActive = 0;
+
+        struct FFinishedRequest
+        {
+            int32 RequestId;
+            int32 NumSpawned;
+            bool bCancelled;
+        };
+        TArray<FFinishedRequest> Finished;
+        TMap<int32, TArray<int32>> Progress;
+
+        const FDelegateHandle FinishedHandle = CrowdManager->GetOnCrowdSpawnFinished().AddLambda(
+            [&Finished](int32 RequestId, int32 NumSpawned, bool bCancelled)
+            {
+                Finished.Add({ RequestId, NumSpawned, bCancelled });
+            });
+        const FDelegateHandle ProgressHandle = CrowdManager->GetOnCrowdSpawnProgress().AddLambda(
+            [&Progress](int32 RequestId, int32 NumProcessed, int32 NumRequested)
+            {
+                Progress.FindOrAdd(RequestId).Add(NumProcessed);
+            });
+
+        // Batching: one progress event per EntitiesPerBatch, then a single completion
+        const int32 RequestA = CrowdManager->SpawnEntitiesAsync(Count, Center, 500.0f, EntityConfig, FOnCrowdSpawnComplete());
+        TestNotEqual(TEXT("Async request queued"), RequestA, static_cast<int32>(INDEX_NONE));
+        TestTrue(TEXT("Queue drains"), TestAccess.DrainAsyncSpawnQueue());
+        ExpectedActive += Count;
+
+        const TArray<int32>* ProgressA = Progress.Find(RequestA);
+        TestEqual(TEXT("One progress event per batch"), ProgressA ? ProgressA->Num() : 0, 3);
+        if (ProgressA && ProgressA->Num() == 3)
+        {
+            TestEqual(TEXT("First batch is EntitiesPerBatch"), (*ProgressA)[0], BatchSize);
+            TestEqual(TEXT("Second batch is EntitiesPerBatch"), (*ProgressA)[1], BatchSize * 2);
+            TestEqual(TEXT("Last batch takes the remainder"), (*ProgressA)[2], Count);
+        }
+        TestEqual(TEXT("Completion delivered once"), Finished.Num(), 1);
+        if (Finished.Num() == 1)
+        {
+            TestEqual(TEXT("Completion for the request"), Finished[0].RequestId, RequestA);
+            TestEqual(TEXT("Completion reports every entity"), Finished[0].NumSpawned, Count);
+            TestFalse(TEXT("Completion not flagged cancelled"), Finished[0].bCancelled);
+        }
+        TestEqual(TEXT("Spawned entities tracked"), CrowdManager->GetActiveEntityCount(), ExpectedActive);
+        TestEqual(TEXT("Spawned entities tracked per cell"), TestAccess.GetTrackedEntityCount(), ExpectedActive);
+
+        // Cancel before any batch: delivered once with nothing spawned
+        Finished.Reset();
+        const int32 RequestB = CrowdManager->SpawnEntitiesAsync(Count, Center, 500.0f, EntityConfig, FOnCrowdSpawnComplete());
+        TestTrue(TEXT("Queued request cancels"), CrowdManager->CancelAsyncSpawn(RequestB));
+        TestFalse(TEXT("Second cancel is a no-op"), CrowdManager->CancelAsyncSpawn(RequestB));
+        TestEqual(TEXT("Cancelled request left the queue"), CrowdManager->GetPendingAsyncSpawnCount(), 0);
+        TestEqual(TEXT("Cancelled request reports complete progress"), CrowdManager->GetAsyncSpawnProgress(RequestB), 1.0f);
+        TestEqual(TEXT("Cancel delivered once"), Finished.Num(), 1);
+        if (Finished.Num() == 1)
+        {
+            TestTrue(TEXT("Cancel flagged"), Finished[0].bCancelled);
+            TestEqual(TEXT("Nothing spawned before cancel"), Finished[0].NumSpawned, 0);
+        }
+
+        // Listener cancels the request being spawned from inside its progress broadcast
+        Finished.Reset();
+        int32 RequestC = INDEX_NONE;
+        const FDelegateHandle CancelHandle = CrowdManager->GetOnCrowdSpawnProgress().AddLambda(
+            [CrowdManager, &RequestC](int32 RequestId, int32 NumProcessed, int32 NumRequested)
+            {
+                if (RequestId == RequestC)
+                {
+                    CrowdManager->CancelAsyncSpawn(RequestC);
+                }
+            });
+        RequestC = CrowdManager->SpawnEntitiesAsync(Count, Center, 500.0f, EntityConfig, FOnCrowdSpawnComplete());
+        TestTrue(TEXT("Queue drains after mid-broadcast cancel"), TestAccess.DrainAsyncSpawnQueue());
+        CrowdManager->GetOnCrowdSpawnProgress().Remove(CancelHandle);
+        ExpectedActive += BatchSize;
+
+        TestEqual(TEXT("Mid-broadcast cancel delivered once"), Finished.Num(), 1);
+        if (Finished.Num() == 1)
+        {
+            TestTrue(TEXT("Mid-broadcast cancel flagged"), Finished[0].bCancelled);
+            TestEqual(TEXT("First batch kept on cancel"), Finished[0].NumSpawned, BatchSize);
+        }
+        TestEqual(TEXT("Entities from the cancelled request stay tracked"), CrowdManager->GetActiveEntityCount(), ExpectedActive);
+
+        // Listeners queue requests mid-broadcast; enough to reallocate the queue under the processor
+        Finished.Reset();
+        constexpr int32 NumRequeued = 32;
+        TArray<int32> QueuedIds;
+        int32 RequestD = INDEX_NONE;
+        const FDelegateHandle RequeueHandle = CrowdManager->GetOnCrowdSpawnProgress().AddLambda(
+            [CrowdManager, EntityConfig, &RequestD, &QueuedIds](int32 RequestId, int32 NumProcessed, int32 NumRequested)
+            {
+                if (RequestId == RequestD && QueuedIds.Num() == 0)
+                {
+                    for (int32 i = 0; i < NumRequeued; i++)
+                    {
+                        QueuedIds.Add(CrowdManager->SpawnEntitiesAsync(1, FVector(2000.0f, 2000.0f, 0.0f), 100.0f, EntityConfig, FOnCrowdSpawnComplete()));
+                    }
+                }
+            });
+        const FDelegateHandle RequeueOnFinishHandle = CrowdManager->GetOnCrowdSpawnFinished().AddLambda(
+            [CrowdManager, EntityConfig, &RequestD, &QueuedIds](int32 RequestId, int32 NumSpawned, bool bCancelled)
+            {
+                if (RequestId == RequestD)
+                {
+                    QueuedIds.Add(CrowdManager->SpawnEntitiesAsync(2, FVector(2000.0f, 2000.0f, 0.0f), 100.0f, EntityConfig, FOnCrowdSpawnComplete()));
+                }
+            });
+        RequestD = CrowdManager->SpawnEntitiesAsync(Count, Center, 500.0f, EntityConfig, FOnCrowdSpawnComplete());
+        TestTrue(TEXT("Queue drains after re-entrant queueing"), TestAccess.DrainAsyncSpawnQueue());
+        CrowdManager->GetOnCrowdSpawnProgress().Remove(RequeueHandle);
+        CrowdManager->GetOnCrowdSpawnFinished().Remove(RequeueOnFinishHandle);
+        ExpectedActive += Count + NumRequeued + 2;
+
+        TestEqual(TEXT("Every request queued from a listener"), QueuedIds.Num(), NumRequeued + 1);
+        TestEqual(TEXT("Every request completes exactly once"), Finished.Num(), NumRequeued + 2);
+        if (Finished.Num() > 0)
+        {
+            TestEqual(TEXT("Front request completes first"), Finished[0].RequestId, RequestD);
+            TestEqual(TEXT("Front request spawned fully"), Finished[0].NumSpawned, Count);
+        }
+        for (const int32 QueuedId : QueuedIds)
+        {
+            const int32 NumDelivered = Finished.FilterByPredicate([QueuedId](const FFinishedRequest& Request)
+            {
+                return Request.RequestId == QueuedId && !Request.bCancelled;
+            }).Num();
+            TestEqual(FString::Printf(TEXT("Request %d completed once"), QueuedId), NumDelivered, 1);
+        }
+        TestEqual(TEXT("All re-entrant spawns tracked"), CrowdManager->GetActiveEntityCount(), ExpectedActive);
+
+        CrowdManager->GetOnCrowdSpawnProgress().Remove(ProgressHandle);
+        CrowdManager->GetOnCrowdSpawnFinished().Remove(FinishedHandle);
+
+        CrowdManager->DespawnAllEntities();
+        TestAccess.FlushCommands();
+    }
+
+    EntityConfig->RemoveFromRoot();
+    CrowdManager->RemoveFromRoot();
+    return true;
+}
+
+// Test 17: Behavior LOD Execution - Only due buckets run, and elapsed time is per entity across skipped frames
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDCrowdBehaviorBucketExecutionTest,
+    "GSD.Crowds.LOD.BehaviorBucketExecution",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDCrowdBehaviorBucketExecutionTest::RunTest(const FString& Parameters)
+{
+    // Long behavior interval so no wander update resets the timers under test
+    UGSDCrowdConfig* Config = NewObject<UGSDCrowdConfig>();
+    Config->bEnablePursuitBehavior = false;
+    Config->bEnableBehaviorLODBuckets = true;
+    Config->bParallelBehavior = false;
+    Config->BehaviorUpdateInterval = 100.0f;
+    Config->BehaviorLOD3FrameInterval = 4;
+
+    UGSDZombieBehaviorProcessor* Processor = NewObject<UGSDZombieBehaviorProcessor>();
+    FGSDZombieBehaviorProcessorTestAccess Access(*Processor);
+    Access.SetConfig(Config);
+    Access.ConfigureQueries();
+
+    TSharedRef<FMassEntityManager> EntityManager = MakeShareable(new FMassEntityManager());
+    EntityManager->Initialize();
+
+    const FMassArchetypeHandle NearArchetype = EntityManager->CreateArchetype({
+        FDataFragment_Transform::StaticStruct(),
+        FGSDZombieMovementFragment::StaticStruct() });
+    const FMassArchetypeHandle FarArchetype = EntityManager->CreateArchetype({
+        FDataFragment_Transform::StaticStruct(),
+        FGSDZombieMovementFragment::StaticStruct(),
+        FGSDBehaviorLODBucket3Tag::StaticStruct() });
+
+    const int32 NumPerBucket = 16;
+    TArray<FMassEntityHandle> NearEntities;
+    TArray<FMassEntityHandle> FarEntities;
+    EntityManager->BatchCreateEntities(NearArchetype, NumPerBucket, NearEntities);
+    EntityManager->BatchCreateEntities(FarArchetype, NumPerBucket, FarEntities);
+
+    auto SeedState = [&EntityManager](const FMassEntityHandle& Entity, int32 Index)
+    {
+        FGSDZombieMovementFragment& State = EntityManager->GetFragmentDataChecked<FGSDZombieMovementFragment>(Entity);
+        State.bIsAlive = true;
+        State.bIsActive = true;
+        State.bIsAggressive = false;
+        State.MovementSpeed = 100.0f;
+        State.TargetMovementSpeed = 200.0f;
+        EntityManager->GetFragmentDataChecked<FDataFragment_Transform>(Entity).GetMutableTransform().SetLocation(FVector(Index * 100.0f, 0.0f, 0.0f));
+    };
+    for (int32 i = 0; i < NumPerBucket; ++i)
+    {
+        SeedState(NearEntities[i], i);
+        SeedState(FarEntities[i], i);
+    }
+
+    auto GetState = [&EntityManager](const FMassEntityHandle& Entity) -> const FGSDZombieMovementFragment&
+    {
+        return EntityManager->GetFragmentDataChecked<FGSDZombieMovementFragment>(Entity);
+    };
+
+    // Bucket 3 runs when (frame + 3) % 4 == 0: frames 1 and 5 of 1..8
+    const float DeltaTime = 0.1f;
+    for (int32 Frame = 1; Frame <= 8; ++Frame)
+    {
+        Access.Execute(*EntityManager, DeltaTime);
+        const float Clock = Frame * DeltaTime;
+
+        for (int32 i = 0; i < NumPerBucket; ++i)
+        {
+            const FGSDZombieMovementFragment& Near = GetState(NearEntities[i]);
+            const FGSDZombieMovementFragment& Far = GetState(FarEntities[i]);
+
+            if (!TestTrue(FString::Printf(TEXT("Frame %d: bucket 0 entity %d updated"), Frame, i),
+                FMath::IsNearlyEqual(Near.LastBehaviorTime, Clock, 1.0e-4f)))
+            {
+                return false;
+            }
+            TestTrue(FString::Printf(TEXT("Frame %d: bucket 0 entity %d timer advanced every frame"), Frame, i),
+                FMath::IsNearlyEqual(Near.TimeSinceLastBehaviorUpdate, Clock, 1.0e-4f));
+
+            const float ExpectedFarLastTime = Frame >= 5 ? 0.5f : 0.1f;
+            TestTrue(FString::Printf(TEXT("Frame %d: bucket 3 entity %d only updated on due frames"), Frame, i),
+                FMath::IsNearlyEqual(Far.LastBehaviorTime, ExpectedFarLastTime, 1.0e-4f));
+
+            // The skipped frames are caught up in one step, so the timer matches bucket 0's at the update
+            TestTrue(FString::Printf(TEXT("Frame %d: bucket 3 entity %d timer covers skipped frames"), Frame, i),
+                FMath::IsNearlyEqual(Far.TimeSinceLastBehaviorUpdate, ExpectedFarLastTime, 1.0e-4f));
+        }
+    }
+
+    // Speed interpolation ran with each bucket's own elapsed time
+    const FGSDZombieMovementFragment& Near = GetState(NearEntities[0]);
+    const FGSDZombieMovementFragment& Far = GetState(FarEntities[0]);
+    TestTrue(TEXT("Bucket 0 speed moved toward its target"), Near.MovementSpeed > 100.0f && Near.MovementSpeed < 200.0f);
+    TestTrue(TEXT("Bucket 3 speed moved toward its target"), Far.MovementSpeed > 100.0f && Far.MovementSpeed < 200.0f);
+
+    return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
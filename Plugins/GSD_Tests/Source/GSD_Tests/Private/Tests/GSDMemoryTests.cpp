@@ -3,6 +3,8 @@
 #include "GSD_Tests.h"
 #include "Misc/AutomationTest.h"
 #include "HAL/PlatformMemory.h"
+#include "Fragments/GSDZombieStateFragment.h"
+#include "Fragments/GSDZombieMovementFragment.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -160,4 +162,55 @@ bool FGSDVehiclePoolMemoryTest::RunTest(const FString& Parameters)
     return true;
 }
 
+// Test 3: Zombie Fragment Footprint - Bytes per entity before/after the hot/cold split
+namespace GSDMemoryTests
+{
+    /** Field-for-field copy of the former combined FGSDZombieStateFragment layout */
+    struct FLegacyZombieStateLayout
+    {
+        float Health;
+        float MovementSpeed;
+        float TargetMovementSpeed;
+        uint8 bIsAggressive : 1;
+        uint8 bIsAlive : 1;
+        uint8 bIsActive : 1;
+        float WanderDirection;
+        float TimeSinceLastBehaviorUpdate;
+        FVector TargetLocation;
+        int32 TargetEntityID;
+        float PursuitSpeed;
+        float AttackRange;
+        float DetectionRange;
+        float TimeSinceLastAttack;
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDZombieFragmentFootprintTest,
+    "GSD.Memory.ZombieFragments.BytesPerEntity",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDZombieFragmentFootprintTest::RunTest(const FString& Parameters)
+{
+    const int32 LegacyBytes = static_cast<int32>(sizeof(GSDMemoryTests::FLegacyZombieStateLayout));
+    const int32 HotBytes = static_cast<int32>(sizeof(FGSDZombieMovementFragment));
+    const int32 ColdBytes = static_cast<int32>(sizeof(FGSDZombieStateFragment));
+    const int32 TotalBytes = HotBytes + ColdBytes;
+
+    // Per-frame processors (behavior, navigation) only stream the hot fragment
+    const int32 EntityCount = 10000;
+    const FString Summary = FString::Printf(
+        TEXT("Zombie fragment bytes/entity: before %d, after %d hot + %d cold = %d (per-frame stream for %d entities: %d KB -> %d KB)"),
+        LegacyBytes, HotBytes, ColdBytes, TotalBytes,
+        EntityCount, LegacyBytes * EntityCount / 1024, HotBytes * EntityCount / 1024);
+
+    UE_LOG(LogTemp, Log, TEXT("%s"), *Summary);
+    AddInfo(Summary);
+
+    TestEqual(TEXT("Target handle is 4 bytes"), static_cast<int32>(sizeof(FGSDCrowdTargetHandle)), 4);
+    TestTrue(TEXT("Hot fragment is smaller than the legacy fragment"), HotBytes < LegacyBytes);
+    TestTrue(TEXT("Hot + cold is smaller than the legacy fragment"), TotalBytes < LegacyBytes);
+
+    return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -6,6 +6,8 @@
 #include "DataAssets/GSDNetworkBudgetConfig.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "Async/ParallelFor.h"
+#include <atomic>
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDNetworkBudgetTrackingTest,
     "GSD.Network.Budget.Tracking",
@@ -146,3 +148,153 @@ bool FGSDNetworkBudgetConfigTest::RunTest(const FString& Parameters)
 
     return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDNetworkBudgetConcurrentTrackingTest,
+    "GSD.Network.Budget.ConcurrentTracking",
+    EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ContextMask)
+
+bool FGSDNetworkBudgetConcurrentTrackingTest::RunTest(const FString& Parameters)
+{
+    // Create test config with a budget large enough to never block
+    UGSDNetworkBudgetConfig* Config = NewObject<UGSDNetworkBudgetConfig>();
+    Config->TotalBitsPerSecond = 100000000;
+    Config->CategoryAllocations.Add(EGSDBudgetCategory::Crowd, 1.0f);
+    Config->bLogBandwidthWarnings = false;
+
+    UGSDNetworkBudgetSubsystem* Subsystem = NewObject<UGSDNetworkBudgetSubsystem>();
+    Subsystem->SetConfig(Config);
+
+    // Simulate parallel LOD processor chunks tracking replication concurrently
+    constexpr int32 NumChunks = 64;
+    constexpr int32 EntitiesPerChunk = 128;
+    constexpr int32 BitsPerEntity = 104;
+
+    ParallelFor(NumChunks, [Subsystem](int32 ChunkIndex)
+    {
+        for (int32 i = 0; i < EntitiesPerChunk; ++i)
+        {
+            Subsystem->TrackReplication(EGSDBudgetCategory::Crowd, BitsPerEntity);
+        }
+    });
+
+    TestEqual("No tracked bits lost under concurrency",
+        Subsystem->GetCurrentBandwidthUsage(EGSDBudgetCategory::Crowd),
+        static_cast<float>(NumChunks * EntitiesPerChunk * BitsPerEntity));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDNetworkBudgetPrioritySchedulerTest,
+    "GSD.Network.Budget.PriorityScheduler",
+    EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ContextMask)
+
+bool FGSDNetworkBudgetPrioritySchedulerTest::RunTest(const FString& Parameters)
+{
+    // Budget fits exactly two 100-bit candidates per frame
+    UGSDNetworkBudgetConfig* Config = NewObject<UGSDNetworkBudgetConfig>();
+    Config->TotalBitsPerSecond = 200;
+    Config->CategoryAllocations.Add(EGSDBudgetCategory::Crowd, 1.0f);
+    Config->bLogBandwidthWarnings = false;
+
+    UGSDNetworkBudgetSubsystem* Subsystem = NewObject<UGSDNetworkBudgetSubsystem>();
+    Subsystem->SetConfig(Config);
+
+    // Submitted far-first, as if far entities lived in early chunks
+    auto MakeCandidate = [](uint64 Key, float Significance)
+    {
+        FGSDReplicationCandidate Candidate;
+        Candidate.EntityKey = Key;
+        Candidate.Significance = Significance;
+        Candidate.LODLevel = FMath::FloorToInt(Significance);
+        Candidate.EstimatedBits = 100;
+        return Candidate;
+    };
+    const TArray<FGSDReplicationCandidate> Candidates = {
+        MakeCandidate(1, 3.0f),
+        MakeCandidate(2, 0.0f),
+        MakeCandidate(3, 1.75f),
+        MakeCandidate(4, 0.75f)
+    };
+
+    // Frame 1: nearest two win regardless of submission order
+    TArray<FGSDReplicationCandidate> Approved;
+    Subsystem->SubmitReplicationCandidates(EGSDBudgetCategory::Crowd, Candidates);
+    TestEqual("Two candidates approved", Subsystem->ScheduleReplication(EGSDBudgetCategory::Crowd, Approved), 2);
+    TestTrue("Highest priority first", Approved.Num() == 2 && Approved[0].EntityKey == 2 && Approved[1].EntityKey == 4);
+    TestEqual("Far candidate starved once", Subsystem->GetStarvationFrames(EGSDBudgetCategory::Crowd, 1), 1);
+    TestEqual("Approved candidate not starved", Subsystem->GetStarvationFrames(EGSDBudgetCategory::Crowd, 2), 0);
+    TestEqual("Budget spent", Subsystem->GetRemainingBudget(EGSDBudgetCategory::Crowd), 0);
+
+    // Staleness eventually lets every candidate win a slot
+    TSet<uint64> EverApproved;
+    for (const FGSDReplicationCandidate& Candidate : Approved)
+    {
+        EverApproved.Add(Candidate.EntityKey);
+    }
+    for (int32 Frame = 0; Frame < 10; ++Frame)
+    {
+        Subsystem->ResetFrameCounters();
+        Subsystem->SubmitReplicationCandidates(EGSDBudgetCategory::Crowd, Candidates);
+        Subsystem->ScheduleReplication(EGSDBudgetCategory::Crowd, Approved);
+        for (const FGSDReplicationCandidate& Candidate : Approved)
+        {
+            EverApproved.Add(Candidate.EntityKey);
+        }
+    }
+    TestEqual("No candidate starves forever", EverApproved.Num(), Candidates.Num());
+    TestTrue("Starvation stays bounded", Subsystem->GetLastScheduleStats(EGSDBudgetCategory::Crowd).MaxStarvationFrames < 10);
+
+    // Candidates not resubmitted are forgotten
+    Subsystem->ResetFrameCounters();
+    Subsystem->SubmitReplicationCandidates(EGSDBudgetCategory::Crowd, MakeArrayView(&Candidates[0], 1));
+    Subsystem->ScheduleReplication(EGSDBudgetCategory::Crowd, Approved);
+    TestEqual("Despawned candidate forgotten", Subsystem->GetStarvationFrames(EGSDBudgetCategory::Crowd, 3), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSDNetworkBudgetConcurrentLODLimitTest,
+    "GSD.Network.Budget.ConcurrentLODLimit",
+    EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ContextMask)
+
+bool FGSDNetworkBudgetConcurrentLODLimitTest::RunTest(const FString& Parameters)
+{
+    // Create test config where only the LOD limit can block
+    UGSDNetworkBudgetConfig* Config = NewObject<UGSDNetworkBudgetConfig>();
+    Config->TotalBitsPerSecond = 100000000;
+    Config->CategoryAllocations.Add(EGSDBudgetCategory::Crowd, 1.0f);
+    Config->bLogBandwidthWarnings = false;
+
+    constexpr int32 MaxEntitiesAtLOD0 = 100;
+    Config->LODConfigs.Empty();
+    FGSDLODReplicationConfig LOD0;
+    LOD0.MaxEntitiesPerFrame = MaxEntitiesAtLOD0;
+    Config->LODConfigs.Add(LOD0);
+
+    UGSDNetworkBudgetSubsystem* Subsystem = NewObject<UGSDNetworkBudgetSubsystem>();
+    Subsystem->SetConfig(Config);
+
+    // Many chunks race for the same LOD slots; exactly the limit must be granted
+    constexpr int32 NumChunks = 64;
+    constexpr int32 EntitiesPerChunk = 32;
+    std::atomic<int32> Granted = 0;
+
+    ParallelFor(NumChunks, [Subsystem, &Granted](int32 ChunkIndex)
+    {
+        for (int32 i = 0; i < EntitiesPerChunk; ++i)
+        {
+            if (Subsystem->CanReplicateThisFrame(EGSDBudgetCategory::Crowd, 0))
+            {
+                Granted.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    TestEqual("LOD limit granted exactly under concurrency", Granted.load(), MaxEntitiesAtLOD0);
+
+    // Slots free up again after the frame reset
+    Subsystem->ResetFrameCounters();
+    TestTrue("LOD slot available after reset", Subsystem->CanReplicateThisFrame(EGSDBudgetCategory::Crowd, 0));
+
+    return true;
+}
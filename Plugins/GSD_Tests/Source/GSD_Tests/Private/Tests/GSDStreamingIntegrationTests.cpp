@@ -3,6 +3,9 @@
 #include "CoreMinimal.h"
 #include "Misc/AutomationTest.h"
 #include "Subsystems/GSDCrowdManagerSubsystem.h"
+#include "DataAssets/GSDCrowdConfig.h"
+#include "DataAssets/GSDCrowdEntityConfig.h"
+#include "GSDCrowdManagerTestAccess.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -198,4 +201,292 @@ bool FGSDStreamingCellUnloadedTest::RunTest(const FString& Parameters)
     return true;
 }
 
+/**
+ * Test 6: Batch residency check and integer cell keys
+ * Verifies that ArePositionsInLoadedCells matches the single-position check
+ * and that cell keys follow the same grid as cell names
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FGSDStreamingBatchResidencyTest,
+    "GSD.Streaming.BatchResidencyCheck",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDStreamingBatchResidencyTest::RunTest(const FString& Parameters)
+{
+    // Create a test world
+    UWorld* TestWorld = NewObject<UWorld>();
+    TestWorld->SetWorldType(EWorldType::Game);
+
+    // Create crowd manager subsystem
+    UGSDCrowdManagerSubsystem* CrowdManager = NewObject<UGSDCrowdManagerSubsystem>(TestWorld);
+    CrowdManager->AddToRoot();
+
+    // Test 1: Positions in the same cell share a key
+    TestEqual(TEXT("(100,100) and (12000,12000) share Cell_0_0 key"),
+        CrowdManager->GetCellKeyForPosition(FVector(100.0f, 100.0f, 0.0f)),
+        CrowdManager->GetCellKeyForPosition(FVector(12000.0f, 12000.0f, 0.0f)));
+
+    // Test 2: Neighbouring and negative cells get distinct keys
+    TestNotEqual(TEXT("Cell_1_0 and Cell_0_1 keys differ"),
+        CrowdManager->GetCellKeyForPosition(FVector(12800.0f, 0.0f, 0.0f)),
+        CrowdManager->GetCellKeyForPosition(FVector(0.0f, 12800.0f, 0.0f)));
+    TestNotEqual(TEXT("Cell_-1_-1 and Cell_0_0 keys differ"),
+        CrowdManager->GetCellKeyForPosition(FVector(-100.0f, -100.0f, 0.0f)),
+        CrowdManager->GetCellKeyForPosition(FVector(100.0f, 100.0f, 0.0f)));
+
+    // Test 3: Batch check agrees with single-position check
+    TArray<FVector> Positions;
+    Positions.Add(FVector(0.0f, 0.0f, 0.0f));
+    Positions.Add(FVector(25600.0f, 12800.0f, 0.0f));
+    Positions.Add(FVector(-12800.0f, 25600.0f, 0.0f));
+
+    TBitArray<> Loaded;
+    CrowdManager->ArePositionsInLoadedCells(Positions, Loaded);
+    TestEqual(TEXT("Batch result sized to input"), Loaded.Num(), Positions.Num());
+
+    for (int32 i = 0; i < Positions.Num(); ++i)
+    {
+        TestEqual(FString::Printf(TEXT("Batch result %d matches IsPositionInLoadedCell"), i),
+            static_cast<bool>(Loaded[i]), CrowdManager->IsPositionInLoadedCell(Positions[i]));
+    }
+
+    CrowdManager->RemoveFromRoot();
+    return true;
+}
+
+/**
+ * Test 7: Pending cell spawns through a load/unload cycle
+ * Verifies that spawns for an unloaded cell wait, replay on load, are tracked
+ * per cell, and leave the simulation again when the cell unloads
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FGSDStreamingCellLifecycleTest,
+    "GSD.Streaming.PendingSpawnLoadUnloadCycle",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDStreamingCellLifecycleTest::RunTest(const FString& Parameters)
+{
+    // World Partition world: the crowd manager gates on cell residency, and no cell is loaded yet
+    FGSDPartitionedTestWorld TestWorld;
+    if (!TestTrue(TEXT("Partitioned test world with crowd manager"), TestWorld.IsValid()))
+    {
+        return false;
+    }
+
+    UGSDCrowdManagerSubsystem* CrowdManager = TestWorld.CrowdManager;
+    UGSDCrowdEntityConfig* EntityConfig = NewObject<UGSDCrowdEntityConfig>();
+    EntityConfig->AddToRoot();
+
+    const UGSDCrowdConfig* Config = UGSDCrowdConfig::GetDefaultConfig();
+    const bool bHibernate = Config ? Config->bEnableCellHibernation : true;
+
+    {
+        FGSDCrowdManagerTestAccess TestAccess(*CrowdManager);
+
+        // Cell_3_3 stays unloaded at first, Cell_0_0 is loaded throughout
+        const FName StreamedCell(TEXT("Cell_3_3"));
+        const FVector StreamedCenter(3.5f * 12800.0f, 3.5f * 12800.0f, 0.0f);
+        const FVector ResidentCenter(6400.0f, 6400.0f, 0.0f);
+        const int64 StreamedKey = CrowdManager->GetCellKeyForPosition(StreamedCenter);
+        const int64 ResidentKey = CrowdManager->GetCellKeyForPosition(ResidentCenter);
+        TestAccess.CellLoaded(FName(TEXT("Cell_0_0")));
+
+        TestEqual(TEXT("Resident cell spawns immediately"), CrowdManager->SpawnEntities(4, ResidentCenter, 500.0f, EntityConfig), 4);
+
+        // Test 1: Spawns for the unloaded cell wait (sync and async paths)
+        TestFalse(TEXT("Streamed cell starts unloaded"), CrowdManager->IsPositionInLoadedCell(StreamedCenter));
+        TestEqual(TEXT("Sync spawn deferred"), CrowdManager->SpawnEntities(12, StreamedCenter, 500.0f, EntityConfig), 0);
+        TestEqual(TEXT("Async spawn deferred"),
+            CrowdManager->SpawnEntitiesAsync(5, StreamedCenter, 500.0f, EntityConfig, FOnCrowdSpawnComplete()), static_cast<int32>(INDEX_NONE));
+        TestEqual(TEXT("Both spawns pending"), CrowdManager->GetPendingCellSpawnCount(), 2);
+        TestEqual(TEXT("Nothing tracked in the unloaded cell"), TestAccess.GetTrackedEntityCount(StreamedKey), 0);
+
+        // Test 2: Unloading before the replay streams in puts the requests back to pending
+        TestAccess.CellLoaded(StreamedCell);
+        TestEqual(TEXT("Load replays pending spawns"), CrowdManager->GetPendingCellSpawnCount(), 0);
+        TestEqual(TEXT("Replayed spawns queued async"), CrowdManager->GetPendingAsyncSpawnCount(), 2);
+        TestAccess.CellUnloaded(StreamedCell);
+        TestEqual(TEXT("Unload returns unstarted spawns to pending"), CrowdManager->GetPendingCellSpawnCount(), 2);
+        TestEqual(TEXT("Unload cancels in-flight spawns"), CrowdManager->GetPendingAsyncSpawnCount(), 0);
+
+        // Test 3: Load spawns everything into the cell
+        TestAccess.CellLoaded(StreamedCell);
+        TestTrue(TEXT("Replay drains"), TestAccess.DrainAsyncSpawnQueue());
+        TestEqual(TEXT("Streamed cell tracks replayed entities"), TestAccess.GetTrackedEntityCount(StreamedKey), 17);
+        TestEqual(TEXT("Resident cell unchanged"), TestAccess.GetTrackedEntityCount(ResidentKey), 4);
+        TestEqual(TEXT("Active count includes both cells"), CrowdManager->GetActiveEntityCount(), 21);
+
+        // Test 4: Unload releases only the streamed cell's entities
+        const TArray<FMassEntityHandle> EntitiesBeforeUnload = TestAccess.GetSpawnedEntities();
+        TestAccess.CellUnloaded(StreamedCell);
+        TestAccess.FlushCommands();
+
+        TestEqual(TEXT("Streamed cell no longer tracked"), TestAccess.GetTrackedEntityCount(StreamedKey), 0);
+        TestEqual(TEXT("Resident cell still tracked"), TestAccess.GetTrackedEntityCount(ResidentKey), 4);
+        TestEqual(TEXT("Active count drops to resident cell"), CrowdManager->GetActiveEntityCount(), 4);
+        TestEqual(TEXT("Released entities hibernated when enabled"), CrowdManager->GetHibernatedEntityCount(), bHibernate ? 17 : 0);
+
+        int32 NumDestroyed = 0;
+        for (const FMassEntityHandle& Entity : EntitiesBeforeUnload)
+        {
+            NumDestroyed += TestAccess.EntityManager->IsEntityValid(Entity) ? 0 : 1;
+        }
+        TestEqual(TEXT("Released entities destroyed"), NumDestroyed, 17);
+
+        CrowdManager->DespawnAllEntities();
+        TestAccess.FlushCommands();
+    }
+
+    EntityConfig->RemoveFromRoot();
+    return true;
+}
+
+/**
+ * Test 8: Hibernate and restore round trip
+ * Verifies that HibernateEntities releases only the given tracked entities and that
+ * restored entities get their recorded state back, including when Mass creates
+ * fewer entities than a restore batch asked for
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FGSDStreamingHibernateRestoreTest,
+    "GSD.Streaming.HibernateRestoreRoundTrip",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGSDStreamingHibernateRestoreTest::RunTest(const FString& Parameters)
+{
+    // World Partition world: the crowd manager gates on cell residency, and no cell is loaded yet
+    FGSDPartitionedTestWorld TestWorld;
+    if (!TestTrue(TEXT("Partitioned test world with crowd manager"), TestWorld.IsValid()))
+    {
+        return false;
+    }
+
+    UGSDCrowdManagerSubsystem* CrowdManager = TestWorld.CrowdManager;
+    UGSDCrowdEntityConfig* EntityConfig = NewObject<UGSDCrowdEntityConfig>();
+    EntityConfig->AddToRoot();
+
+    {
+        FGSDCrowdManagerTestAccess TestAccess(*CrowdManager);
+
+        const FName CellName(TEXT("Cell_1_1"));
+        const FVector Center(1.5f * 12800.0f, 1.5f * 12800.0f, 0.0f);
+        const int32 BatchSize = FGSDCrowdManagerTestAccess::GetBatchSize();
+        const int32 Count = BatchSize * 2 + 3;
+        TestAccess.CellLoaded(CellName);
+
+        TestEqual(TEXT("Crowd spawned"), CrowdManager->SpawnEntities(Count, Center, 500.0f, EntityConfig), Count);
+        FMassEntityManager& EntityManager = *TestAccess.EntityManager;
+
+        // Give every entity distinct state; the last one is dead and must not be hibernated
+        struct FExpectedState
+        {
+            FVector Location;
+            float Health;
+            float MovementSpeed;
+            float LanePosition;
+        };
+        TArray<FExpectedState> Expected;
+        const TArray<FMassEntityHandle> Entities = TestAccess.GetSpawnedEntities();
+        for (int32 i = 0; i < Entities.Num(); i++)
+        {
+            FGSDZombieStateFragment& State = EntityManager.GetFragmentDataChecked<FGSDZombieStateFragment>(Entities[i]);
+            FGSDZombieMovementFragment& Movement = EntityManager.GetFragmentDataChecked<FGSDZombieMovementFragment>(Entities[i]);
+            FGSDNavigationFragment& Navigation = EntityManager.GetFragmentDataChecked<FGSDNavigationFragment>(Entities[i]);
+            State.Health = 10.0f + i;
+            Movement.MovementSpeed = 100.0f + i;
+            Navigation.LanePosition = 5.0f * i;
+            if (i == Entities.Num() - 1)
+            {
+                Movement.bIsAlive = false;
+                continue;
+            }
+
+            const FVector Location = EntityManager.GetFragmentDataChecked<FDataFragment_Transform>(Entities[i]).GetTransform().GetLocation();
+            Expected.Add({ Location, State.Health, Movement.MovementSpeed, Navigation.LanePosition });
+        }
+
+        // Restored entities must carry the state recorded for their location
+        auto CheckRestoredStates = [this, &TestAccess, &EntityManager, &Expected](const TCHAR* Phase)
+        {
+            int32 NumMatched = 0;
+            for (const FMassEntityHandle& Entity : TestAccess.GetSpawnedEntities())
+            {
+                const FVector Location = EntityManager.GetFragmentDataChecked<FDataFragment_Transform>(Entity).GetTransform().GetLocation();
+                const FExpectedState* Record = Expected.FindByPredicate([&Location](const FExpectedState& Candidate)
+                {
+                    return Candidate.Location.Equals(Location, 1.0f);
+                });
+                if (!Record)
+                {
+                    continue;
+                }
+
+                NumMatched++;
+                TestEqual(FString::Printf(TEXT("%s: health restored"), Phase),
+                    EntityManager.GetFragmentDataChecked<FGSDZombieStateFragment>(Entity).Health, Record->Health);
+                TestEqual(FString::Printf(TEXT("%s: movement restored"), Phase),
+                    EntityManager.GetFragmentDataChecked<FGSDZombieMovementFragment>(Entity).MovementSpeed, Record->MovementSpeed);
+                TestEqual(FString::Printf(TEXT("%s: lane position restored"), Phase),
+                    EntityManager.GetFragmentDataChecked<FGSDNavigationFragment>(Entity).LanePosition, Record->LanePosition);
+            }
+            TestEqual(FString::Printf(TEXT("%s: every restored entity matches a record"), Phase), NumMatched, TestAccess.GetSpawnedEntities().Num());
+        };
+
+        // Test 1: Only the given tracked handles are released; unknown and repeated handles are ignored
+        const int32 NumKept = 2;
+        TArray<FMassEntityHandle> ToHibernate = Entities;
+        ToHibernate.RemoveAt(0, NumKept);
+        ToHibernate.Add(Entities[NumKept]);
+        ToHibernate.Add(FMassEntityHandle(Entities.Last().Index + 1000, 1));
+
+        TestEqual(TEXT("Hibernate releases the given tracked entities"), CrowdManager->HibernateEntities(ToHibernate), Count - NumKept);
+        TestAccess.FlushCommands();
+        TestEqual(TEXT("Dead entity released without a record"), CrowdManager->GetHibernatedEntityCount(), Count - NumKept - 1);
+        TestEqual(TEXT("Entities not passed in stay active"), CrowdManager->GetActiveEntityCount(), NumKept);
+        TestEqual(TEXT("Entities not passed in stay tracked"), TestAccess.GetTrackedEntityCount(), NumKept);
+        TestTrue(TEXT("Kept entity still valid"), EntityManager.IsEntityValid(Entities[1]));
+        TestFalse(TEXT("Hibernated entity destroyed"), EntityManager.IsEntityValid(Entities[NumKept]));
+
+        // Slots stay consistent after swap-removal: the kept entities can still be hibernated
+        TestEqual(TEXT("Kept entities hibernate by handle"), CrowdManager->HibernateEntities(MakeArrayView(Entities.GetData(), NumKept)), NumKept);
+        TestAccess.FlushCommands();
+        TestEqual(TEXT("No entities left active"), CrowdManager->GetActiveEntityCount(), 0);
+        TestEqual(TEXT("No entities left tracked"), TestAccess.GetTrackedEntityCount(), 0);
+        TestEqual(TEXT("All living entities hibernated"), CrowdManager->GetHibernatedEntityCount(), Count - 1);
+
+        // Test 2: Reloading the cell restores every record with its state
+        TestAccess.CellUnloaded(CellName);
+        TestAccess.CellLoaded(CellName);
+        TestTrue(TEXT("Restore drains"), TestAccess.DrainAsyncSpawnQueue());
+        TestEqual(TEXT("Hibernated records consumed"), CrowdManager->GetHibernatedEntityCount(), 0);
+        TestEqual(TEXT("Every living entity restored"), CrowdManager->GetActiveEntityCount(), Count - 1);
+        CheckRestoredStates(TEXT("Full batches"));
+
+        // Test 3: Mass creating fewer entities than a batch still restores state to the ones it created
+        if (BatchSize > 1)
+        {
+            TestAccess.CellUnloaded(CellName);
+            TestAccess.FlushCommands();
+            TestEqual(TEXT("Unload hibernates restored entities"), CrowdManager->GetHibernatedEntityCount(), Count - 1);
+
+            TestAccess.MaxEntitiesPerBatch = BatchSize - 1;
+            const int32 NumRecords = Count - 1;
+            const int32 ExpectedRestored = (NumRecords / BatchSize) * (BatchSize - 1) + FMath::Min(NumRecords % BatchSize, BatchSize - 1);
+
+            AddExpectedError(TEXT("remaining records are dropped"), EAutomationExpectedErrorFlags::Contains, 0);
+            TestAccess.CellLoaded(CellName);
+            TestTrue(TEXT("Partial restore drains"), TestAccess.DrainAsyncSpawnQueue());
+            TestEqual(TEXT("Partial batches restore what Mass created"), CrowdManager->GetActiveEntityCount(), ExpectedRestored);
+            CheckRestoredStates(TEXT("Partial batches"));
+            TestAccess.MaxEntitiesPerBatch = MAX_int32;
+        }
+
+        CrowdManager->DespawnAllEntities();
+        TestAccess.FlushCommands();
+    }
+
+    EntityConfig->RemoveFromRoot();
+    return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
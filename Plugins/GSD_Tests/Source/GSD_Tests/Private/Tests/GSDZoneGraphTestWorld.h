@@ -0,0 +1,103 @@
+// Copyright Bret Bouchard. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "ZoneGraph/ZoneGraphData.h"
+#include "ZoneGraph/ZoneGraphSubsystem.h"
+#include "ZoneGraph/ZoneGraphStorage.h"
+
+/**
+ * Game world with hand-built ZoneGraph data for automation tests.
+ *
+ * Each AddZoneGraph call registers one AZoneGraphData holding a single zone whose
+ * lanes are the given polylines (progressions, tangents and bounds filled in the
+ * way the ZoneGraph builder does), firing the subsystem's data-added delegate.
+ */
+struct FGSDZoneGraphTestWorld
+{
+    UWorld* World = nullptr;
+    UZoneGraphSubsystem* ZoneGraphSubsystem = nullptr;
+
+    FGSDZoneGraphTestWorld()
+    {
+        World = UWorld::CreateWorld(EWorldType::Game, false);
+        ZoneGraphSubsystem = World ? World->GetSubsystem<UZoneGraphSubsystem>() : nullptr;
+    }
+
+    ~FGSDZoneGraphTestWorld()
+    {
+        if (World)
+        {
+            World->DestroyWorld(false);
+        }
+    }
+
+    bool IsValid() const { return World && ZoneGraphSubsystem; }
+
+    /**
+     * Register ZoneGraph data with one lane per polyline.
+     * @return The data actor (lane handles are (Data->GetStorage().DataHandle, polyline index))
+     */
+    AZoneGraphData* AddZoneGraph(const TArray<TArray<FVector>>& LanePolylines, float LaneWidth = 100.0f)
+    {
+        AZoneGraphData* ZoneGraphData = World->SpawnActorDeferred<AZoneGraphData>(AZoneGraphData::StaticClass(), FTransform::Identity);
+        FZoneGraphStorage& Storage = ZoneGraphData->GetStorageMutable();
+
+        auto& Zone = Storage.Zones.AddDefaulted_GetRef();
+        Zone.LanesBegin = 0;
+        Zone.Bounds = FBox(ForceInit);
+
+        for (const TArray<FVector>& Polyline : LanePolylines)
+        {
+            check(Polyline.Num() >= 2);
+
+            auto& Lane = Storage.Lanes.AddDefaulted_GetRef();
+            Lane.ZoneIndex = 0;
+            Lane.Width = LaneWidth;
+            Lane.PointsBegin = Storage.LanePoints.Num();
+
+            float Progression = 0.0f;
+            for (int32 i = 0; i < Polyline.Num(); ++i)
+            {
+                if (i > 0)
+                {
+                    Progression += FVector::Dist(Polyline[i - 1], Polyline[i]);
+                }
+
+                // Tangent: average of adjacent segment directions (segment direction at the ends)
+                const FVector Prev = Polyline[FMath::Max(i - 1, 0)];
+                const FVector Next = Polyline[FMath::Min(i + 1, Polyline.Num() - 1)];
+
+                Storage.LanePoints.Add(Polyline[i]);
+                Storage.LaneTangentVectors.Add((Next - Prev).GetSafeNormal());
+                Storage.LaneUpVectors.Add(FVector::UpVector);
+                Storage.LanePointProgressions.Add(Progression);
+                Zone.Bounds += Polyline[i];
+            }
+
+            Lane.PointsEnd = Storage.LanePoints.Num();
+        }
+
+        Zone.LanesEnd = Storage.Lanes.Num();
+        Zone.Bounds = Zone.Bounds.ExpandBy(LaneWidth);
+        Storage.Bounds = Zone.Bounds;
+        Storage.ZoneBVTree.Build(MakeStridedView(Storage.Zones, &FZoneData::Bounds));
+
+        // Registers with the subsystem (data-added delegate fires here)
+        ZoneGraphData->FinishSpawning(FTransform::Identity);
+        return ZoneGraphData;
+    }
+
+    /** Unregister and destroy ZoneGraph data (data-removed delegate fires) */
+    void RemoveZoneGraph(AZoneGraphData* ZoneGraphData)
+    {
+        ZoneGraphData->Destroy();
+    }
+
+    static FZoneGraphLaneHandle GetLane(const AZoneGraphData* ZoneGraphData, int32 LaneIndex)
+    {
+        return FZoneGraphLaneHandle(LaneIndex, ZoneGraphData->GetStorage().DataHandle);
+    }
+};